@@ -60,9 +60,18 @@ public static partial class Ckzg
     private static extern unsafe KzgResult VerifyBlobKzgProofBatch(out bool result, byte* blobs, byte* commitments,
         byte* proofs, UInt64 count, IntPtr ts);
 
+    [DllImport("ckzg", EntryPoint = "blob_to_kzg_commitments", CallingConvention = CallingConvention.Cdecl)]
+    private static extern unsafe KzgResult BlobToKzgCommitments(byte* commitments, byte* blobs, UInt64 count,
+        IntPtr ts);
+
     [DllImport("ckzg", EntryPoint = "compute_cells_and_kzg_proofs", CallingConvention = CallingConvention.Cdecl)]
     private static extern unsafe KzgResult ComputeCellsAndKzgProofs(byte* cells, byte* proofs, byte* blob, IntPtr ts);
 
+    [DllImport("ckzg", EntryPoint = "compute_cells_and_kzg_proofs_batch",
+        CallingConvention = CallingConvention.Cdecl)]
+    private static extern unsafe KzgResult ComputeCellsAndKzgProofsBatch(byte* cells, byte* proofs, byte* blobs,
+        UInt64 count, IntPtr ts);
+
     [DllImport("ckzg", EntryPoint = "recover_cells_and_kzg_proofs", CallingConvention = CallingConvention.Cdecl)]
     private static extern unsafe KzgResult RecoverCellsAndKzgProofs(byte* recovered_cells, byte* recovered_proofs,
         UInt64* cell_indices, byte* cells, UInt64 num_cells, IntPtr ts);
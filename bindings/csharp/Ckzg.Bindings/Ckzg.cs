@@ -62,6 +62,31 @@ public static partial class Ckzg
         }
     }
 
+    /// <summary>
+    ///     Calculates commitments for a batch of blobs with a single native call.
+    /// </summary>
+    /// <param name="commitments">Preallocated buffer of <paramref name="count"/> * <inheritdoc cref="BytesPerCommitment"/> bytes to receive the commitments</param>
+    /// <param name="blobs">Blobs as a flattened byte array</param>
+    /// <param name="count">The number of blobs</param>
+    /// <param name="ckzgSetup">Trusted setup settings</param>
+    /// <exception cref="ArgumentException">Thrown when length of an argument is not correct or settings are not correct</exception>
+    /// <exception cref="ApplicationException">Thrown when the library returns unexpected Error code</exception>
+    /// <exception cref="InsufficientMemoryException">Thrown when the library has no enough memory to process</exception>
+    public static unsafe void BlobToKzgCommitments(Span<byte> commitments, ReadOnlySpan<byte> blobs, int count,
+        IntPtr ckzgSetup)
+    {
+        ThrowOnUninitializedTrustedSetup(ckzgSetup);
+        ThrowOnInvalidCount(count, nameof(count));
+        ThrowOnInvalidLength(commitments, nameof(commitments), BytesPerCommitment * count);
+        ThrowOnInvalidLength(blobs, nameof(blobs), BytesPerBlob * count);
+
+        fixed (byte* commitmentsPtr = commitments, blobsPtr = blobs)
+        {
+            KzgResult result = BlobToKzgCommitments(commitmentsPtr, blobsPtr, (UInt64)count, ckzgSetup);
+            ThrowOnError(result);
+        }
+    }
+
     /// <summary>
     ///     Compute KZG proof at point `z` for the polynomial represented by `blob`.
     /// </summary>
@@ -247,6 +272,59 @@ public static partial class Ckzg
         }
     }
 
+    /// <summary>
+    ///     Given a batch of blobs, get all of their cells with a single native call.
+    /// </summary>
+    /// <param name="cells">Cells as a flattened byte array, <inheritdoc cref="CellsPerExtBlob"/> cells per blob</param>
+    /// <param name="blobs">Blobs as a flattened byte array</param>
+    /// <param name="count">The number of blobs</param>
+    /// <param name="ckzgSetup">Trusted setup settings</param>
+    /// <exception cref="ArgumentException">Thrown when length of an argument is not correct or settings are not correct</exception>
+    /// <exception cref="ApplicationException">Thrown when the library returns unexpected Error code</exception>
+    /// <exception cref="InsufficientMemoryException">Thrown when the library has no enough memory to process</exception>
+    public static unsafe void ComputeCellsBatch(Span<byte> cells, ReadOnlySpan<byte> blobs, int count,
+        IntPtr ckzgSetup)
+    {
+        ThrowOnUninitializedTrustedSetup(ckzgSetup);
+        ThrowOnInvalidCount(count, nameof(count));
+        ThrowOnInvalidLength(cells, nameof(cells), BytesPerCell * CellsPerExtBlob * count);
+        ThrowOnInvalidLength(blobs, nameof(blobs), BytesPerBlob * count);
+
+        fixed (byte* cellsPtr = cells, blobsPtr = blobs)
+        {
+            KzgResult result = ComputeCellsAndKzgProofsBatch(cellsPtr, null, blobsPtr, (UInt64)count, ckzgSetup);
+            ThrowOnError(result);
+        }
+    }
+
+    /// <summary>
+    ///     Given a batch of blobs, get all of their cells and proofs with a single native call.
+    /// </summary>
+    /// <param name="cells">Cells as a flattened byte array, <inheritdoc cref="CellsPerExtBlob"/> cells per blob</param>
+    /// <param name="proofs">Proofs as a flattened byte array, <inheritdoc cref="CellsPerExtBlob"/> proofs per blob</param>
+    /// <param name="blobs">Blobs as a flattened byte array</param>
+    /// <param name="count">The number of blobs</param>
+    /// <param name="ckzgSetup">Trusted setup settings</param>
+    /// <exception cref="ArgumentException">Thrown when length of an argument is not correct or settings are not correct</exception>
+    /// <exception cref="ApplicationException">Thrown when the library returns unexpected Error code</exception>
+    /// <exception cref="InsufficientMemoryException">Thrown when the library has no enough memory to process</exception>
+    public static unsafe void ComputeCellsAndKzgProofsBatch(Span<byte> cells, Span<byte> proofs,
+        ReadOnlySpan<byte> blobs, int count, IntPtr ckzgSetup)
+    {
+        ThrowOnUninitializedTrustedSetup(ckzgSetup);
+        ThrowOnInvalidCount(count, nameof(count));
+        ThrowOnInvalidLength(cells, nameof(cells), BytesPerCell * CellsPerExtBlob * count);
+        ThrowOnInvalidLength(proofs, nameof(proofs), BytesPerProof * CellsPerExtBlob * count);
+        ThrowOnInvalidLength(blobs, nameof(blobs), BytesPerBlob * count);
+
+        fixed (byte* cellsPtr = cells, proofsPtr = proofs, blobsPtr = blobs)
+        {
+            KzgResult result =
+                ComputeCellsAndKzgProofsBatch(cellsPtr, proofsPtr, blobsPtr, (UInt64)count, ckzgSetup);
+            ThrowOnError(result);
+        }
+    }
+
     /// <summary>
     ///     Given some cells for a blob, recover all cells/proofs.
     /// </summary>
@@ -333,6 +411,13 @@ public static partial class Ckzg
             throw new ArgumentException("Trusted setup is not initialized", nameof(ckzgSetup));
     }
 
+    private static void ThrowOnInvalidCount(int count, string fieldName)
+    {
+        // The expected lengths are computed as count * item size, which must not overflow.
+        if (count < 0 || count > Array.MaxLength / (BytesPerCell * CellsPerExtBlob))
+            throw new ArgumentOutOfRangeException(fieldName, count, "Invalid count");
+    }
+
     private static void ThrowOnInvalidLength(ReadOnlySpan<byte> data, string fieldName, int expectedLength)
     {
         if (data.Length != expectedLength)
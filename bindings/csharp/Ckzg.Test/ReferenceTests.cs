@@ -573,4 +573,57 @@ public class ReferenceTests
     }
 
     #endregion
+
+    #region Batches
+
+    [Test]
+    public void TestBatchMethods()
+    {
+        List<ComputeCellsAndKzgProofsTest> tests =
+            GetComputeCellsAndKzgProofsTests().Where(test => test.Output != null).ToList();
+        Assert.That(tests, Is.Not.Empty);
+        int count = tests.Count;
+
+        byte[] blobs = GetFlatBytes(tests.Select(test => test.Input.Blob).ToList());
+        byte[] expectedCells = tests.SelectMany(test => GetFlatBytes(test.Output!.ElementAt(0))).ToArray();
+        byte[] expectedProofs = tests.SelectMany(test => GetFlatBytes(test.Output!.ElementAt(1))).ToArray();
+
+        byte[] commitments = new byte[count * Ckzg.BytesPerCommitment];
+        Ckzg.BlobToKzgCommitments(commitments, blobs, count, _ts);
+        for (int i = 0; i < count; i++)
+        {
+            byte[] commitment = new byte[Ckzg.BytesPerCommitment];
+            Ckzg.BlobToKzgCommitment(commitment, blobs.AsSpan(i * Ckzg.BytesPerBlob, Ckzg.BytesPerBlob), _ts);
+            Assert.That(commitments.AsSpan(i * Ckzg.BytesPerCommitment, Ckzg.BytesPerCommitment).ToArray(),
+                Is.EqualTo(commitment));
+        }
+
+        byte[] cells = new byte[count * CellsPerExtBlob * Ckzg.BytesPerCell];
+        byte[] proofs = new byte[count * CellsPerExtBlob * Ckzg.BytesPerProof];
+        Ckzg.ComputeCellsAndKzgProofsBatch(cells, proofs, blobs, count, _ts);
+        Assert.That(cells, Is.EqualTo(expectedCells));
+        Assert.That(proofs, Is.EqualTo(expectedProofs));
+
+        byte[] cellsOnly = new byte[cells.Length];
+        Ckzg.ComputeCellsBatch(cellsOnly, blobs, count, _ts);
+        Assert.That(cellsOnly, Is.EqualTo(expectedCells));
+
+        /* Verify every cell of every blob with a single call */
+        int numCells = count * CellsPerExtBlob;
+        byte[] cellCommitments = new byte[numCells * Ckzg.BytesPerCommitment];
+        UInt64[] cellIndices = new UInt64[numCells];
+        for (int i = 0; i < numCells; i++)
+        {
+            commitments.AsSpan((i / CellsPerExtBlob) * Ckzg.BytesPerCommitment, Ckzg.BytesPerCommitment)
+                .CopyTo(cellCommitments.AsSpan(i * Ckzg.BytesPerCommitment));
+            cellIndices[i] = (UInt64)(i % CellsPerExtBlob);
+        }
+        Assert.That(Ckzg.VerifyCellKzgProofBatch(cellCommitments, cellIndices, cells, proofs, numCells, _ts),
+            Is.True);
+
+        Assert.Throws<ArgumentException>(() => Ckzg.BlobToKzgCommitments(commitments, blobs, count + 1, _ts));
+        Assert.Throws<ArgumentOutOfRangeException>(() => Ckzg.ComputeCellsBatch(cells, blobs, -1, _ts));
+    }
+
+    #endregion
 }
\ No newline at end of file
@@ -275,4 +275,55 @@ defmodule KZG do
   def verify_cell_kzg_proof_batch(_commitments, _cell_indices, _cells, _proofs, _settings) do
     :erlang.nif_error(:not_loaded)
   end
+
+  @doc """
+  Computes cells and KZG proofs for a batch of blobs.
+
+  All cells and proofs are written into one shared binary, and the returned
+  cells and proofs are sub-binaries of it. The NIF reschedules itself after
+  each blob, so a large batch does not hold a dirty scheduler for its whole
+  duration.
+
+  ## Parameters
+
+    - `blobs` is a binary containing concatenated blobs.
+    - `settings` is the trusted settings reference.
+
+  ## Returns
+
+    - `{:ok, cells, proofs}` on success, where `cells` and `proofs` hold one list of 128 binaries per blob.
+    - `{:error, reason}` on error.
+  """
+  @spec compute_cells_and_kzg_proofs_batch(binary, settings) ::
+          {:ok, [[binary()]], [[binary()]]} | {:error, atom()}
+  def compute_cells_and_kzg_proofs_batch(_blobs, _settings) do
+    :erlang.nif_error(:not_loaded)
+  end
+
+  @doc """
+  Verifies several batches of cell proofs, such as the columns of a block.
+
+  The binaries of each column are read in place. Columns are verified
+  independently, and the NIF reschedules itself between groups of columns so
+  that a large call does not hold a dirty scheduler for its whole duration.
+
+  ## Parameters
+
+    - `columns` is a list of `{commitments, cell_indices, cells, proofs}` tuples, where `commitments`,
+        `cells` and `proofs` are binaries of concatenated items and `cell_indices` is a list of
+        non-negative integers.
+    - `settings` is the trusted settings reference.
+
+  ## Returns
+
+    - `{:ok, results}` on success, where `results` has one boolean per column.
+    - `{:error, reason}` if any column is malformed.
+  """
+  @spec verify_cell_kzg_proof_batch_columns(
+          [{binary, [non_neg_integer()], binary, binary}],
+          settings
+        ) :: {:ok, [boolean]} | {:error, atom()}
+  def verify_cell_kzg_proof_batch_columns(_columns, _settings) do
+    :erlang.nif_error(:not_loaded)
+  end
 end
@@ -40,9 +40,12 @@ typedef struct {
     ERL_NIF_TERM invalid_cell_length;
     ERL_NIF_TERM commitments_not_list;
     ERL_NIF_TERM proofs_not_list;
+    ERL_NIF_TERM columns_not_list;
+    ERL_NIF_TERM column_not_tuple;
 } ckzg_atoms_t;
 
 ErlNifResourceType *KZGSETTINGS_RES_TYPE;
+ErlNifResourceType *BATCH_BUFFER_RES_TYPE;
 static ckzg_atoms_t ckzg_atoms;
 
 #define MAKE_ATOM_2(item, name) ckzg_atoms.item = enif_make_atom(env, #name)
@@ -103,6 +106,12 @@ static int load(ErlNifEnv *env, void **priv_data, ERL_NIF_TERM load_info) {
     );
     if (KZGSETTINGS_RES_TYPE == NULL) return -1;
 
+    // Batch results are written into a plain resource and exposed as resource binaries.
+    BATCH_BUFFER_RES_TYPE = enif_open_resource_type(
+        env, NULL, "ckzg_batch_buffer", NULL, ERL_NIF_RT_CREATE | ERL_NIF_RT_TAKEOVER, NULL
+    );
+    if (BATCH_BUFFER_RES_TYPE == NULL) return -1;
+
     MAKE_ATOM(ok);
     MAKE_ATOM(error);
     MAKE_ATOM_2(a_true, true);
@@ -136,6 +145,8 @@ static int load(ErlNifEnv *env, void **priv_data, ERL_NIF_TERM load_info) {
     MAKE_ATOM(invalid_cell_length);
     MAKE_ATOM(commitments_not_list);
     MAKE_ATOM(proofs_not_list);
+    MAKE_ATOM(columns_not_list);
+    MAKE_ATOM(column_not_tuple);
 
     return 0;
 }
@@ -866,6 +877,292 @@ out:
     return msg;
 }
 
+// Upper bound on the number of cells verified before a batch NIF reschedules itself.
+#define CELLS_PER_SCHEDULE CELLS_PER_EXT_BLOB
+
+#define BATCH_CELLS_SIZE (CELLS_PER_EXT_BLOB * BYTES_PER_CELL)
+#define BATCH_PROOFS_SIZE (CELLS_PER_EXT_BLOB * BYTES_PER_PROOF)
+
+// Split `size` bytes of `bin` into a list of `item_size` sub-binaries.
+static ERL_NIF_TERM make_sub_binary_list(
+    ErlNifEnv *env, ERL_NIF_TERM bin, size_t offset, size_t size, size_t item_size
+) {
+    ERL_NIF_TERM list = enif_make_list(env, 0);
+    for (size_t i = size / item_size; i > 0; i--) {
+        ERL_NIF_TERM item = enif_make_sub_binary(env, bin, offset + (i - 1) * item_size, item_size);
+        list = enif_make_list_cell(env, item, list);
+    }
+    return list;
+}
+
+// argv: blobs, settings, buffer, index of the next blob to compute
+static ERL_NIF_TERM compute_cells_and_kzg_proofs_batch_step(
+    ErlNifEnv *env, int argc, const ERL_NIF_TERM argv[]
+) {
+    (void)argc;
+
+    ErlNifBinary blobs;
+    KZGSettings *settings;
+    uint8_t *buffer;
+    unsigned long index;
+    if (!enif_inspect_binary(env, argv[0], &blobs) ||
+        !enif_get_resource(env, argv[1], KZGSETTINGS_RES_TYPE, (void **)&settings) ||
+        !enif_get_resource(env, argv[2], BATCH_BUFFER_RES_TYPE, (void **)&buffer) ||
+        !enif_get_ulong(env, argv[3], &index))
+        return enif_make_badarg(env);
+
+    size_t count = blobs.size / BYTES_PER_BLOB;
+    uint8_t *cells = buffer;
+    uint8_t *proofs = buffer + count * BATCH_CELLS_SIZE;
+
+    // Compute one blob per call, then give the dirty scheduler back.
+    C_KZG_RET ret = compute_cells_and_kzg_proofs(
+        (Cell *)(cells + index * BATCH_CELLS_SIZE),
+        (KZGProof *)(proofs + index * BATCH_PROOFS_SIZE),
+        (const Blob *)(blobs.data + index * BYTES_PER_BLOB),
+        settings
+    );
+    if (ret != C_KZG_OK) return make_kzg_error(env, ret);
+
+    if (++index < count) {
+        ERL_NIF_TERM next_argv[4] = {argv[0], argv[1], argv[2], enif_make_ulong(env, index)};
+        return enif_schedule_nif(
+            env,
+            "compute_cells_and_kzg_proofs_batch",
+            ERL_NIF_DIRTY_JOB_CPU_BOUND,
+            compute_cells_and_kzg_proofs_batch_step,
+            4,
+            next_argv
+        );
+    }
+
+    // Every cell and proof is a sub-binary of the single buffer, no per-item allocation.
+    ERL_NIF_TERM buffer_bin = enif_make_resource_binary(
+        env, buffer, buffer, count * (BATCH_CELLS_SIZE + BATCH_PROOFS_SIZE)
+    );
+    ERL_NIF_TERM cells_list = enif_make_list(env, 0);
+    ERL_NIF_TERM proofs_list = enif_make_list(env, 0);
+    for (size_t i = count; i > 0; i--) {
+        size_t cells_offset = (i - 1) * BATCH_CELLS_SIZE;
+        size_t proofs_offset = count * BATCH_CELLS_SIZE + (i - 1) * BATCH_PROOFS_SIZE;
+        ERL_NIF_TERM blob_cells = make_sub_binary_list(
+            env, buffer_bin, cells_offset, BATCH_CELLS_SIZE, BYTES_PER_CELL
+        );
+        ERL_NIF_TERM blob_proofs = make_sub_binary_list(
+            env, buffer_bin, proofs_offset, BATCH_PROOFS_SIZE, BYTES_PER_PROOF
+        );
+        cells_list = enif_make_list_cell(env, blob_cells, cells_list);
+        proofs_list = enif_make_list_cell(env, blob_proofs, proofs_list);
+    }
+
+    return enif_make_tuple3(env, ckzg_atoms.ok, cells_list, proofs_list);
+}
+
+static ERL_NIF_TERM compute_cells_and_kzg_proofs_batch_nif(
+    ErlNifEnv *env, int argc, const ERL_NIF_TERM argv[]
+) {
+    if (argc != 2) return make_error(env, ckzg_atoms.incorrect_arg_count);
+
+    ErlNifBinary blobs;
+    if (!enif_inspect_binary(env, argv[0], &blobs))
+        return make_error(env, ckzg_atoms.blob_not_binary);
+
+    if (blobs.size % BYTES_PER_BLOB != 0) return make_error(env, ckzg_atoms.invalid_blob_length);
+
+    KZGSettings *settings;
+    if (!enif_get_resource(env, argv[1], KZGSETTINGS_RES_TYPE, (void **)&settings))
+        return make_error(env, ckzg_atoms.failed_get_settings_resource);
+
+    size_t count = blobs.size / BYTES_PER_BLOB;
+    if (count == 0) {
+        ERL_NIF_TERM empty = enif_make_list(env, 0);
+        return enif_make_tuple3(env, ckzg_atoms.ok, empty, empty);
+    }
+
+    void *buffer = enif_alloc_resource(
+        BATCH_BUFFER_RES_TYPE, count * (BATCH_CELLS_SIZE + BATCH_PROOFS_SIZE)
+    );
+    if (buffer == NULL) return make_error(env, ckzg_atoms.out_of_memory);
+
+    ERL_NIF_TERM step_argv[4] = {
+        argv[0], argv[1], enif_make_resource(env, buffer), enif_make_ulong(env, 0)
+    };
+    enif_release_resource(buffer);
+
+    return compute_cells_and_kzg_proofs_batch_step(env, 4, step_argv);
+}
+
+// Verify a single `{commitments, cell_indices, cells, proofs}` column without copying its binaries.
+static bool verify_cell_column(
+    ErlNifEnv *env,
+    ERL_NIF_TERM column,
+    KZGSettings *settings,
+    bool *ok,
+    unsigned int *num_cells,
+    ERL_NIF_TERM *error
+) {
+    uint64_t *cell_indices = NULL;
+    bool success = false;
+
+    const ERL_NIF_TERM *fields;
+    int arity;
+    if (!enif_get_tuple(env, column, &arity, &fields) || arity != 4) {
+        *error = make_error(env, ckzg_atoms.column_not_tuple);
+        goto out;
+    }
+
+    ErlNifBinary commitments;
+    if (!enif_inspect_binary(env, fields[0], &commitments)) {
+        *error = make_error(env, ckzg_atoms.commitment_not_binary);
+        goto out;
+    }
+
+    if (commitments.size % BYTES_PER_COMMITMENT != 0) {
+        *error = make_error(env, ckzg_atoms.invalid_commitment_length);
+        goto out;
+    }
+
+    unsigned int cell_indices_len;
+    if (!enif_get_list_length(env, fields[1], &cell_indices_len)) {
+        *error = make_error(env, ckzg_atoms.cell_indices_not_list);
+        goto out;
+    }
+
+    ErlNifBinary cells;
+    if (!enif_inspect_binary(env, fields[2], &cells)) {
+        *error = make_error(env, ckzg_atoms.cells_value_not_binary);
+        goto out;
+    }
+
+    if (cells.size % BYTES_PER_CELL != 0) {
+        *error = make_error(env, ckzg_atoms.invalid_cell_length);
+        goto out;
+    }
+
+    ErlNifBinary proofs;
+    if (!enif_inspect_binary(env, fields[3], &proofs)) {
+        *error = make_error(env, ckzg_atoms.proof_not_binary);
+        goto out;
+    }
+
+    if (proofs.size % BYTES_PER_PROOF != 0) {
+        *error = make_error(env, ckzg_atoms.invalid_proof_length);
+        goto out;
+    }
+
+    if (commitments.size / BYTES_PER_COMMITMENT != cell_indices_len ||
+        cells.size / BYTES_PER_CELL != cell_indices_len ||
+        proofs.size / BYTES_PER_PROOF != cell_indices_len) {
+        *error = make_error(env, ckzg_atoms.expected_same_array_size);
+        goto out;
+    }
+
+    *num_cells = cell_indices_len;
+    if (cell_indices_len == 0) {
+        *ok = true;
+        success = true;
+        goto out;
+    }
+
+    cell_indices = enif_alloc(cell_indices_len * sizeof(uint64_t));
+    if (cell_indices == NULL) {
+        *error = make_error(env, ckzg_atoms.out_of_memory);
+        goto out;
+    }
+
+    ERL_NIF_TERM head;
+    ERL_NIF_TERM tail = fields[1];
+    for (int i = 0; enif_get_list_cell(env, tail, &head, &tail); i++) {
+        ErlNifUInt64 current_u;
+        if (!enif_get_uint64(env, head, &current_u)) {
+            *error = make_error(env, ckzg_atoms.cell_indices_value_not_uint64);
+            goto out;
+        }
+
+        cell_indices[i] = (uint64_t)current_u;
+    }
+
+    C_KZG_RET ret = verify_cell_kzg_proof_batch(
+        ok,
+        (const Bytes48 *)commitments.data,
+        cell_indices,
+        (const Cell *)cells.data,
+        (const Bytes48 *)proofs.data,
+        cell_indices_len,
+        settings
+    );
+    if (ret != C_KZG_OK) {
+        *error = make_kzg_error(env, ret);
+        goto out;
+    }
+
+    success = true;
+
+out:
+    enif_free(cell_indices);
+    return success;
+}
+
+// argv: remaining columns, settings, results so far (reversed)
+static ERL_NIF_TERM verify_cell_kzg_proof_batch_columns_step(
+    ErlNifEnv *env, int argc, const ERL_NIF_TERM argv[]
+) {
+    (void)argc;
+
+    KZGSettings *settings;
+    if (!enif_get_resource(env, argv[1], KZGSETTINGS_RES_TYPE, (void **)&settings))
+        return enif_make_badarg(env);
+
+    ERL_NIF_TERM head;
+    ERL_NIF_TERM tail = argv[0];
+    ERL_NIF_TERM results = argv[2];
+    unsigned int cells_done = 0;
+    while (cells_done < CELLS_PER_SCHEDULE && enif_get_list_cell(env, tail, &head, &tail)) {
+        bool ok;
+        unsigned int num_cells;
+        ERL_NIF_TERM error;
+        if (!verify_cell_column(env, head, settings, &ok, &num_cells, &error)) return error;
+
+        results = enif_make_list_cell(env, ok ? ckzg_atoms.a_true : ckzg_atoms.a_false, results);
+        // Count empty columns as one cell so that every call makes progress.
+        cells_done += num_cells > 0 ? num_cells : 1;
+    }
+
+    if (!enif_is_empty_list(env, tail)) {
+        ERL_NIF_TERM next_argv[3] = {tail, argv[1], results};
+        return enif_schedule_nif(
+            env,
+            "verify_cell_kzg_proof_batch_columns",
+            ERL_NIF_DIRTY_JOB_CPU_BOUND,
+            verify_cell_kzg_proof_batch_columns_step,
+            3,
+            next_argv
+        );
+    }
+
+    ERL_NIF_TERM ordered;
+    enif_make_reverse_list(env, results, &ordered);
+    return make_success(env, ordered);
+}
+
+static ERL_NIF_TERM verify_cell_kzg_proof_batch_columns_nif(
+    ErlNifEnv *env, int argc, const ERL_NIF_TERM argv[]
+) {
+    if (argc != 2) return make_error(env, ckzg_atoms.incorrect_arg_count);
+
+    // Also rejects improper lists, whose tail the steps would otherwise reschedule on forever.
+    unsigned int num_columns;
+    if (!enif_get_list_length(env, argv[0], &num_columns))
+        return make_error(env, ckzg_atoms.columns_not_list);
+
+    KZGSettings *settings;
+    if (!enif_get_resource(env, argv[1], KZGSETTINGS_RES_TYPE, (void **)&settings))
+        return make_error(env, ckzg_atoms.failed_get_settings_resource);
+
+    ERL_NIF_TERM step_argv[3] = {argv[0], argv[1], enif_make_list(env, 0)};
+    return verify_cell_kzg_proof_batch_columns_step(env, 3, step_argv);
+}
+
 static ErlNifFunc nif_funcs[] = {
     {"load_trusted_setup", 2, load_trusted_setup_nif, ERL_NIF_DIRTY_JOB_CPU_BOUND},
     {"blob_to_kzg_commitment", 2, blob_to_kzg_commitment_nif, ERL_NIF_DIRTY_JOB_CPU_BOUND},
@@ -884,6 +1181,17 @@ static ErlNifFunc nif_funcs[] = {
      3,
      recover_cells_and_kzg_proofs_nif,
      ERL_NIF_DIRTY_JOB_CPU_BOUND},
-    {"verify_cell_kzg_proof_batch", 5, verify_cell_kzg_proof_batch_nif, ERL_NIF_DIRTY_JOB_CPU_BOUND}
+    {"verify_cell_kzg_proof_batch",
+     5,
+     verify_cell_kzg_proof_batch_nif,
+     ERL_NIF_DIRTY_JOB_CPU_BOUND},
+    {"compute_cells_and_kzg_proofs_batch",
+     2,
+     compute_cells_and_kzg_proofs_batch_nif,
+     ERL_NIF_DIRTY_JOB_CPU_BOUND},
+    {"verify_cell_kzg_proof_batch_columns",
+     2,
+     verify_cell_kzg_proof_batch_columns_nif,
+     ERL_NIF_DIRTY_JOB_CPU_BOUND}
 };
 ERL_NIF_INIT(Elixir.KZG, nif_funcs, load, NULL, NULL, NULL);
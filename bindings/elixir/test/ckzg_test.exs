@@ -292,4 +292,60 @@ defmodule KZGTest do
       end
     end
   end
+
+  test "compute_cells_and_kzg_proofs_batch/2 and verify_cell_kzg_proof_batch_columns/2",
+       %{setup: setup} do
+    valid_tests =
+      @compute_cells_and_kzg_proofs_tests
+      |> Enum.map(fn file ->
+        {:ok, test_data} = YamlElixir.read_from_file(file)
+        test_data
+      end)
+      |> Enum.reject(&(&1["output"] == nil))
+
+    assert length(valid_tests) > 0
+
+    blobs = Enum.map(valid_tests, &bytes_from_hex(&1["input"]["blob"]))
+    {:ok, cells, proofs} = KZG.compute_cells_and_kzg_proofs_batch(Enum.join(blobs), setup)
+
+    for {test_data, blob_cells, blob_proofs} <- Enum.zip([valid_tests, cells, proofs]) do
+      assert blob_cells == Enum.map(List.first(test_data["output"]), &bytes_from_hex/1)
+      assert blob_proofs == Enum.map(List.last(test_data["output"]), &bytes_from_hex/1)
+    end
+
+    assert {:ok, [], []} == KZG.compute_cells_and_kzg_proofs_batch(<<>>, setup)
+    assert {:error, _} = KZG.compute_cells_and_kzg_proofs_batch(<<0>>, setup)
+
+    commitments =
+      Enum.map(blobs, fn blob ->
+        {:ok, commitment} = KZG.blob_to_kzg_commitment(blob, setup)
+        commitment
+      end)
+
+    # One column per cell index, each holding that cell of every blob.
+    columns =
+      for index <- 0..127 do
+        {
+          Enum.join(commitments),
+          List.duplicate(index, length(blobs)),
+          cells |> Enum.map(&Enum.at(&1, index)) |> Enum.join(),
+          proofs |> Enum.map(&Enum.at(&1, index)) |> Enum.join()
+        }
+      end
+
+    {:ok, results} = KZG.verify_cell_kzg_proof_batch_columns(columns, setup)
+    assert results == List.duplicate(true, 128)
+
+    {column_commitments, indices, column_cells, column_proofs} = hd(columns)
+    wrong_index = {column_commitments, Enum.map(indices, &(&1 + 1)), column_cells, column_proofs}
+
+    assert {:ok, [false, true]} ==
+             KZG.verify_cell_kzg_proof_batch_columns([wrong_index, hd(columns)], setup)
+
+    assert {:ok, []} == KZG.verify_cell_kzg_proof_batch_columns([], setup)
+    assert {:error, _} = KZG.verify_cell_kzg_proof_batch_columns([{<<>>, [0], <<>>, <<>>}], setup)
+    assert {:error, _} = KZG.verify_cell_kzg_proof_batch_columns([:not_a_column], setup)
+    assert {:error, :columns_not_list} ==
+             KZG.verify_cell_kzg_proof_batch_columns([hd(columns) | :not_a_list], setup)
+  end
 end
@@ -10,6 +10,8 @@ import (
 	"encoding/hex"
 	"errors"
 	"fmt"
+	"runtime"
+	"sync"
 	"unsafe"
 
 	// So its functions are available during compilation.
@@ -334,6 +336,42 @@ func VerifyKZGProof(commitmentBytes Bytes48, zBytes, yBytes Bytes32, proofBytes
 	return bool(result), nil
 }
 
+/*
+VerifyKZGProofBatch is the binding for:
+
+	C_KZG_RET verify_kzg_proof_batch(
+	    bool *ok,
+	    const Bytes48 *commitments_bytes,
+	    const Bytes32 *zs_bytes,
+	    const Bytes32 *ys_bytes,
+	    const Bytes48 *proofs_bytes,
+	    uint64_t n,
+	    const KZGSettings *s);
+*/
+func VerifyKZGProofBatch(commitmentsBytes []Bytes48, zsBytes, ysBytes []Bytes32, proofsBytes []Bytes48) (bool, error) {
+	if !loaded {
+		panic("trusted setup isn't loaded")
+	}
+	if len(commitmentsBytes) != len(zsBytes) || len(commitmentsBytes) != len(ysBytes) || len(commitmentsBytes) != len(proofsBytes) {
+		return false, ErrBadArgs
+	}
+
+	var result C.bool
+	ret := C.verify_kzg_proof_batch(
+		&result,
+		*(**C.Bytes48)(unsafe.Pointer(&commitmentsBytes)),
+		*(**C.Bytes32)(unsafe.Pointer(&zsBytes)),
+		*(**C.Bytes32)(unsafe.Pointer(&ysBytes)),
+		*(**C.Bytes48)(unsafe.Pointer(&proofsBytes)),
+		(C.uint64_t)(len(commitmentsBytes)),
+		&settings)
+
+	if ret != C.C_KZG_OK {
+		return false, makeErrorFromRet(ret)
+	}
+	return bool(result), nil
+}
+
 /*
 VerifyBlobKZGProof is the binding for:
 
@@ -565,6 +603,312 @@ func VerifyCellKZGProofBatch(commitmentsBytes []Bytes48, cellIndices []uint64, c
 	return bool(result), nil
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Explicit Settings
+///////////////////////////////////////////////////////////////////////////////
+
+// Settings is a trusted setup which is owned by the caller, instead of the
+// package-level one used by the functions above. Several can be loaded side by
+// side, e.g. a verify-only one without precomputation and a heavily
+// precomputed one for proof generation. A loaded Settings is safe for
+// concurrent use; call Free once it is no longer used.
+type Settings struct {
+	s *C.KZGSettings
+}
+
+/*
+NewSettings is the binding for:
+
+	C_KZG_RET load_trusted_setup(
+	    KZGSettings *out,
+	    const uint8_t *g1_monomial_bytes,
+	    uint64_t num_g1_monomial_bytes,
+	    const uint8_t *g1_lagrange_bytes,
+	    uint64_t num_g1_lagrange_bytes,
+	    const uint8_t *g2_monomial_bytes,
+	    uint64_t num_g2_monomial_bytes,
+	    uint64_t precompute);
+*/
+func NewSettings(g1MonomialBytes, g1LagrangeBytes, g2MonomialBytes []byte, precompute uint) (*Settings, error) {
+	s := (*C.KZGSettings)(C.calloc(1, C.sizeof_KZGSettings))
+	if s == nil {
+		return nil, ErrMalloc
+	}
+	ret := C.load_trusted_setup(
+		s,
+		*(**C.uint8_t)(unsafe.Pointer(&g1MonomialBytes)),
+		(C.uint64_t)(len(g1MonomialBytes)),
+		*(**C.uint8_t)(unsafe.Pointer(&g1LagrangeBytes)),
+		(C.uint64_t)(len(g1LagrangeBytes)),
+		*(**C.uint8_t)(unsafe.Pointer(&g2MonomialBytes)),
+		(C.uint64_t)(len(g2MonomialBytes)),
+		(C.uint64_t)(precompute))
+	if ret != C.C_KZG_OK {
+		C.free(unsafe.Pointer(s))
+		return nil, makeErrorFromRet(ret)
+	}
+	return &Settings{s: s}, nil
+}
+
+/*
+NewSettingsFromFile is the binding for:
+
+	C_KZG_RET load_trusted_setup_file(
+	    KZGSettings *out,
+	    FILE *in,
+	    uint64_t precompute);
+*/
+func NewSettingsFromFile(trustedSetupFile string, precompute uint) (*Settings, error) {
+	cTrustedSetupFile := C.CString(trustedSetupFile)
+	defer C.free(unsafe.Pointer(cTrustedSetupFile))
+	cMode := C.CString("r")
+	defer C.free(unsafe.Pointer(cMode))
+	fp := C.fopen(cTrustedSetupFile, cMode)
+	if fp == nil {
+		return nil, fmt.Errorf("error reading trusted setup: %s", trustedSetupFile)
+	}
+	defer C.fclose(fp)
+
+	s := (*C.KZGSettings)(C.calloc(1, C.sizeof_KZGSettings))
+	if s == nil {
+		return nil, ErrMalloc
+	}
+	ret := C.load_trusted_setup_file(s, fp, (C.uint64_t)(precompute))
+	if ret != C.C_KZG_OK {
+		C.free(unsafe.Pointer(s))
+		return nil, makeErrorFromRet(ret)
+	}
+	return &Settings{s: s}, nil
+}
+
+/*
+Free is the binding for:
+
+	void free_trusted_setup(
+	    KZGSettings *s);
+*/
+func (s *Settings) Free() {
+	if s.s == nil {
+		panic("settings were already freed")
+	}
+	C.free_trusted_setup(s.s)
+	C.free(unsafe.Pointer(s.s))
+	s.s = nil
+}
+
+// parallelFor splits [0, n) into one contiguous chunk per available CPU and
+// calls fn for each chunk on its own goroutine. Each fn makes one cgo call for
+// its whole chunk, which runs on its own OS thread, so a batch costs one cgo
+// transition per CPU rather than one per item. Returns the first error.
+func parallelFor(n int, fn func(start, end int) C.C_KZG_RET) error {
+	workers := runtime.GOMAXPROCS(0)
+	if workers > n {
+		workers = n
+	}
+	if workers <= 1 {
+		if n == 0 {
+			return nil
+		}
+		if ret := fn(0, n); ret != C.C_KZG_OK {
+			return makeErrorFromRet(ret)
+		}
+		return nil
+	}
+
+	chunkSize := (n + workers - 1) / workers
+	rets := make([]C.C_KZG_RET, workers)
+	var wg sync.WaitGroup
+	for w := 0; w < workers; w++ {
+		start := w * chunkSize
+		end := start + chunkSize
+		if end > n {
+			end = n
+		}
+		rets[w] = C.C_KZG_OK
+		if start >= end {
+			continue
+		}
+		wg.Add(1)
+		go func(w, start, end int) {
+			defer wg.Done()
+			rets[w] = fn(start, end)
+		}(w, start, end)
+	}
+	wg.Wait()
+
+	for _, ret := range rets {
+		if ret != C.C_KZG_OK {
+			return makeErrorFromRet(ret)
+		}
+	}
+	return nil
+}
+
+/*
+BlobToKZGCommitments computes the commitment for each blob, in parallel, into
+commitments, which must have the same length as blobs. It is the batch binding
+for:
+
+	C_KZG_RET blob_to_kzg_commitment(
+	    KZGCommitment *out,
+	    const Blob *blob,
+	    const KZGSettings *s);
+*/
+func (s *Settings) BlobToKZGCommitments(blobs []Blob, commitments []KZGCommitment) error {
+	if len(commitments) != len(blobs) {
+		return ErrBadArgs
+	}
+	return parallelFor(len(blobs), func(start, end int) C.C_KZG_RET {
+		return C.blob_to_kzg_commitments(
+			(*C.KZGCommitment)(unsafe.Pointer(&commitments[start])),
+			(*C.Blob)(unsafe.Pointer(&blobs[start])),
+			(C.uint64_t)(end-start),
+			s.s)
+	})
+}
+
+/*
+ComputeCellsAndKZGProofsBatch computes the cells and proofs for each blob, in
+parallel. The cells and proofs for blobs[i] are written to
+cells[i*CellsPerExtBlob:] and proofs[i*CellsPerExtBlob:]. Pass a nil proofs
+slice to only compute cells. It is the batch binding for:
+
+	C_KZG_RET compute_cells_and_kzg_proofs(
+	    Cell *cells,
+	    KZGProof *proofs,
+	    const Blob *blob,
+	    const KZGSettings *s);
+*/
+func (s *Settings) ComputeCellsAndKZGProofsBatch(blobs []Blob, cells []Cell, proofs []KZGProof) error {
+	if len(cells) != len(blobs)*CellsPerExtBlob {
+		return ErrBadArgs
+	}
+	if proofs != nil && len(proofs) != len(blobs)*CellsPerExtBlob {
+		return ErrBadArgs
+	}
+	return parallelFor(len(blobs), func(start, end int) C.C_KZG_RET {
+		proofsPtr := (*C.KZGProof)(nil)
+		if proofs != nil {
+			proofsPtr = (*C.KZGProof)(unsafe.Pointer(&proofs[start*CellsPerExtBlob]))
+		}
+		return C.compute_cells_and_kzg_proofs_batch(
+			(*C.Cell)(unsafe.Pointer(&cells[start*CellsPerExtBlob])),
+			proofsPtr,
+			(*C.Blob)(unsafe.Pointer(&blobs[start])),
+			(C.uint64_t)(end-start),
+			s.s)
+	})
+}
+
+/*
+RecoverCellsAndKZGProofsBatch recovers the cells and proofs of several blobs,
+in parallel. The inputs for blob i are cellIndices[i] and cells[i], and its
+recovered cells and proofs are written to recoveredCells[i*CellsPerExtBlob:]
+and recoveredProofs[i*CellsPerExtBlob:]. It is the batch binding for:
+
+	C_KZG_RET recover_cells_and_kzg_proofs(
+	    Cell *recovered_cells,
+	    KZGProof *recovered_proofs,
+	    const uint64_t *cell_indices,
+	    const Cell *cells,
+	    uint64_t num_cells,
+	    const KZGSettings *s);
+*/
+func (s *Settings) RecoverCellsAndKZGProofsBatch(cellIndices [][]uint64, cells [][]Cell, recoveredCells []Cell, recoveredProofs []KZGProof) error {
+	if len(cellIndices) != len(cells) {
+		return ErrBadArgs
+	}
+	if len(recoveredCells) != len(cells)*CellsPerExtBlob || len(recoveredProofs) != len(cells)*CellsPerExtBlob {
+		return ErrBadArgs
+	}
+	for i := range cells {
+		if len(cellIndices[i]) != len(cells[i]) {
+			return ErrBadArgs
+		}
+	}
+
+	// The inputs are slices of slices, which cgo can't pass to C in one call,
+	// so each worker makes one call per blob. Recovery dominates the cost.
+	return parallelFor(len(cells), func(start, end int) C.C_KZG_RET {
+		for i := start; i < end; i++ {
+			ret := C.recover_cells_and_kzg_proofs(
+				(*C.Cell)(unsafe.Pointer(&recoveredCells[i*CellsPerExtBlob])),
+				(*C.KZGProof)(unsafe.Pointer(&recoveredProofs[i*CellsPerExtBlob])),
+				*(**C.uint64_t)(unsafe.Pointer(&cellIndices[i])),
+				*(**C.Cell)(unsafe.Pointer(&cells[i])),
+				(C.uint64_t)(len(cells[i])),
+				s.s)
+			if ret != C.C_KZG_OK {
+				return ret
+			}
+		}
+		return C.C_KZG_OK
+	})
+}
+
+/*
+VerifyBlobKZGProofBatch is the binding for:
+
+	C_KZG_RET verify_blob_kzg_proof_batch(
+	    bool *out,
+	    const Blob *blobs,
+	    const Bytes48 *commitments_bytes,
+	    const Bytes48 *proofs_bytes,
+	    const KZGSettings *s);
+*/
+func (s *Settings) VerifyBlobKZGProofBatch(blobs []Blob, commitmentsBytes, proofsBytes []Bytes48) (bool, error) {
+	if len(blobs) != len(commitmentsBytes) || len(blobs) != len(proofsBytes) {
+		return false, ErrBadArgs
+	}
+
+	var result C.bool
+	ret := C.verify_blob_kzg_proof_batch(
+		&result,
+		*(**C.Blob)(unsafe.Pointer(&blobs)),
+		*(**C.Bytes48)(unsafe.Pointer(&commitmentsBytes)),
+		*(**C.Bytes48)(unsafe.Pointer(&proofsBytes)),
+		(C.uint64_t)(len(blobs)),
+		s.s)
+
+	if ret != C.C_KZG_OK {
+		return false, makeErrorFromRet(ret)
+	}
+	return bool(result), nil
+}
+
+/*
+VerifyCellKZGProofBatch is the binding for:
+
+	C_KZG_RET verify_cell_kzg_proof_batch(
+	    bool *ok,
+	    const Bytes48 *commitments_bytes,
+	    const uint64_t *cell_indices,
+	    const Cell *cells,
+	    const Bytes48 *proofs_bytes,
+	    uint64_t num_cells,
+	    const KZGSettings *s);
+*/
+func (s *Settings) VerifyCellKZGProofBatch(commitmentsBytes []Bytes48, cellIndices []uint64, cells []Cell, proofsBytes []Bytes48) (bool, error) {
+	if len(commitmentsBytes) != len(cells) || len(cellIndices) != len(cells) || len(proofsBytes) != len(cells) {
+		return false, ErrBadArgs
+	}
+
+	var result C.bool
+	ret := C.verify_cell_kzg_proof_batch(
+		&result,
+		*(**C.Bytes48)(unsafe.Pointer(&commitmentsBytes)),
+		*(**C.uint64_t)(unsafe.Pointer(&cellIndices)),
+		*(**C.Cell)(unsafe.Pointer(&cells)),
+		*(**C.Bytes48)(unsafe.Pointer(&proofsBytes)),
+		(C.uint64_t)(len(cells)),
+		s.s)
+
+	if ret != C.C_KZG_OK {
+		return false, makeErrorFromRet(ret)
+	}
+	return bool(result), nil
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Internal Functions
 ///////////////////////////////////////////////////////////////////////////////
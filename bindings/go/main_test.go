@@ -829,6 +829,120 @@ func TestPartialRecover(t *testing.T) {
 	}
 }
 
+func TestVerifyKZGProofBatch(t *testing.T) {
+	const length = 8
+	commitments := [length]Bytes48{}
+	zs := [length]Bytes32{}
+	ys := [length]Bytes32{}
+	proofs := [length]Bytes48{}
+
+	for i := 0; i < length; i++ {
+		var blob Blob
+		fillBlobRandom(&blob, int64(i))
+		commitment, err := BlobToKZGCommitment(&blob)
+		require.NoError(t, err)
+		commitments[i] = Bytes48(commitment)
+		zs[i] = getRandFieldElement(int64(length + i))
+		proof, y, err := ComputeKZGProof(&blob, zs[i])
+		require.NoError(t, err)
+		proofs[i] = Bytes48(proof)
+		ys[i] = y
+	}
+
+	for i := 0; i <= length; i++ {
+		valid, err := VerifyKZGProofBatch(commitments[:i], zs[:i], ys[:i], proofs[:i])
+		require.NoError(t, err)
+		require.True(t, valid)
+	}
+
+	ys[0], ys[1] = ys[1], ys[0]
+	valid, err := VerifyKZGProofBatch(commitments[:], zs[:], ys[:], proofs[:])
+	require.NoError(t, err)
+	require.False(t, valid)
+
+	_, err = VerifyKZGProofBatch(commitments[:], zs[:], ys[:1], proofs[:])
+	require.ErrorIs(t, err, ErrBadArgs)
+}
+
+func TestSettingsBatch(t *testing.T) {
+	// A second setup, loaded alongside the package-level one
+	s, err := NewSettingsFromFile("../../src/trusted_setup.txt", 2)
+	require.NoError(t, err)
+	defer s.Free()
+
+	const length = 5
+	blobs := make([]Blob, length)
+	for i := range blobs {
+		fillBlobRandom(&blobs[i], int64(i))
+	}
+
+	commitments := make([]KZGCommitment, length)
+	require.NoError(t, s.BlobToKZGCommitments(blobs, commitments))
+	cells := make([]Cell, length*CellsPerExtBlob)
+	proofs := make([]KZGProof, length*CellsPerExtBlob)
+	require.NoError(t, s.ComputeCellsAndKZGProofsBatch(blobs, cells, proofs))
+
+	blobProofs := make([]Bytes48, length)
+	cellCommitments := make([]Bytes48, 0, len(cells))
+	cellIndices := make([]uint64, 0, len(cells))
+	cellProofs := make([]Bytes48, 0, len(cells))
+	for i := range blobs {
+		commitment, err := BlobToKZGCommitment(&blobs[i])
+		require.NoError(t, err)
+		require.Equal(t, commitment, commitments[i])
+
+		expectedCells, expectedProofs, err := ComputeCellsAndKZGProofs(&blobs[i])
+		require.NoError(t, err)
+		require.Equal(t, expectedCells[:], cells[i*CellsPerExtBlob:(i+1)*CellsPerExtBlob])
+		require.Equal(t, expectedProofs[:], proofs[i*CellsPerExtBlob:(i+1)*CellsPerExtBlob])
+
+		proof, err := ComputeBlobKZGProof(&blobs[i], Bytes48(commitment))
+		require.NoError(t, err)
+		blobProofs[i] = Bytes48(proof)
+		for j := 0; j < CellsPerExtBlob; j++ {
+			cellCommitments = append(cellCommitments, Bytes48(commitment))
+			cellIndices = append(cellIndices, uint64(j))
+			cellProofs = append(cellProofs, Bytes48(proofs[i*CellsPerExtBlob+j]))
+		}
+	}
+
+	blobCommitments := make([]Bytes48, length)
+	for i := range commitments {
+		blobCommitments[i] = Bytes48(commitments[i])
+	}
+	valid, err := s.VerifyBlobKZGProofBatch(blobs, blobCommitments, blobProofs)
+	require.NoError(t, err)
+	require.True(t, valid)
+	valid, err = s.VerifyCellKZGProofBatch(cellCommitments, cellIndices, cells, cellProofs)
+	require.NoError(t, err)
+	require.True(t, valid)
+
+	// Cells only
+	cellsOnly := make([]Cell, len(cells))
+	require.NoError(t, s.ComputeCellsAndKZGProofsBatch(blobs, cellsOnly, nil))
+	require.Equal(t, cells, cellsOnly)
+
+	// Recover every blob from a different half of its cells
+	partialIndices := make([][]uint64, length)
+	partialCells := make([][]Cell, length)
+	for i := range blobs {
+		var row [CellsPerExtBlob]Cell
+		copy(row[:], cells[i*CellsPerExtBlob:])
+		partialIndices[i], partialCells[i] = getPartialCells(row, i+2)
+	}
+	recoveredCells := make([]Cell, len(cells))
+	recoveredProofs := make([]KZGProof, len(proofs))
+	require.NoError(t, s.RecoverCellsAndKZGProofsBatch(partialIndices, partialCells, recoveredCells, recoveredProofs))
+	require.Equal(t, cells, recoveredCells)
+	require.Equal(t, proofs, recoveredProofs)
+
+	// Output slices must be sized for the whole batch
+	require.ErrorIs(t, s.BlobToKZGCommitments(blobs, commitments[1:]), ErrBadArgs)
+	require.ErrorIs(t, s.ComputeCellsAndKZGProofsBatch(blobs, cells[1:], nil), ErrBadArgs)
+	require.ErrorIs(t, s.ComputeCellsAndKZGProofsBatch(blobs, cells, proofs[1:]), ErrBadArgs)
+	require.NoError(t, s.BlobToKZGCommitments(nil, nil))
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Benchmarks
 ///////////////////////////////////////////////////////////////////////////////
@@ -839,6 +953,9 @@ func Benchmark(b *testing.B) {
 	commitments := [length]Bytes48{}
 	proofs := [length]Bytes48{}
 	fields := [length]Bytes32{}
+	points := [length]Bytes32{}
+	values := [length]Bytes32{}
+	pointProofs := [length]Bytes48{}
 	blobCells := [length][CellsPerExtBlob]Cell{}
 	blobCellProofs := [length][CellsPerExtBlob]Bytes48{}
 
@@ -853,6 +970,12 @@ func Benchmark(b *testing.B) {
 		require.NoError(b, err)
 		proofs[i] = Bytes48(proof)
 
+		points[i] = getRandFieldElement(int64(length + i))
+		pointProof, value, err := ComputeKZGProof(&blob, points[i])
+		require.NoError(b, err)
+		pointProofs[i] = Bytes48(pointProof)
+		values[i] = value
+
 		tProofs := [CellsPerExtBlob]KZGProof{}
 		blobCells[i], tProofs, err = ComputeCellsAndKZGProofs(&blobs[i])
 		require.NoError(b, err)
@@ -908,6 +1031,15 @@ func Benchmark(b *testing.B) {
 		}
 	})
 
+	for i := 1; i <= len(points); i *= 2 {
+		b.Run(fmt.Sprintf("VerifyKZGProofBatch(count=%v)", i), func(b *testing.B) {
+			for n := 0; n < b.N; n++ {
+				_, err := VerifyKZGProofBatch(commitments[:i], points[:i], values[:i], pointProofs[:i])
+				require.NoError(b, err)
+			}
+		})
+	}
+
 	b.Run("VerifyBlobKZGProof", func(b *testing.B) {
 		for n := 0; n < b.N; n++ {
 			_, err := VerifyBlobKZGProof(&blobs[0], commitments[0], proofs[0])
@@ -1013,6 +1145,18 @@ func Benchmark(b *testing.B) {
 		})
 	}
 
+	settings, err := NewSettingsFromFile("../../src/trusted_setup.txt", 8)
+	require.NoError(b, err)
+	b.Run(fmt.Sprintf("ComputeCellsAndKZGProofsBatch(count=%v)", count), func(b *testing.B) {
+		cells := make([]Cell, count*CellsPerExtBlob)
+		proofs := make([]KZGProof, count*CellsPerExtBlob)
+		for n := 0; n < b.N; n++ {
+			err := settings.ComputeCellsAndKZGProofsBatch(blobs[:count], cells, proofs)
+			require.NoError(b, err)
+		}
+	})
+	settings.Free()
+
 	b.Run("VerifyCellKZGProofBatch", func(b *testing.B) {
 		var cellCommitments []Bytes48
 		var cellIndices []uint64
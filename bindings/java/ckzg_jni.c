@@ -49,6 +49,27 @@ KZGSettings *allocate_settings(JNIEnv *env) {
   return s;
 }
 
+/*
+ * Get the address of a direct ByteBuffer and check that it holds exactly
+ * expected_size bytes. The Java side passes slices, so the capacity is the
+ * number of bytes between the caller's position and limit. Throws and returns
+ * NULL if the buffer is not direct or has the wrong size.
+ */
+uint8_t *get_direct_buffer(JNIEnv *env, jobject buffer, const char *prefix,
+                           size_t expected_size) {
+  uint8_t *address = (*env)->GetDirectBufferAddress(env, buffer);
+  if (address == NULL) {
+    throw_exception(env, "Expected a direct ByteBuffer.");
+    return NULL;
+  }
+  size_t size = (size_t)(*env)->GetDirectBufferCapacity(env, buffer);
+  if (size != expected_size) {
+    throw_invalid_size_exception(env, prefix, size, expected_size);
+    return NULL;
+  }
+  return address;
+}
+
 JNIEXPORT void JNICALL
 Java_ethereum_ckzg4844_CKZG4844JNI_loadTrustedSetup__Ljava_lang_String_2J(
     JNIEnv *env, jclass thisCls, jstring file, jlong precompute) {
@@ -338,25 +359,29 @@ JNIEXPORT jboolean JNICALL Java_ethereum_ckzg4844_CKZG4844JNI_verifyKzgProof(
     return 0;
   }
 
+  /*
+   * This is a single pairing check, short enough to pin the arrays instead of
+   * copying them. No JNI calls are allowed until they are released.
+   */
   Bytes48 *commitment_native =
-      (Bytes48 *)(*env)->GetByteArrayElements(env, commitment_bytes, NULL);
+      (Bytes48 *)(*env)->GetPrimitiveArrayCritical(env, commitment_bytes, NULL);
   Bytes48 *proof_native =
-      (Bytes48 *)(*env)->GetByteArrayElements(env, proof_bytes, NULL);
+      (Bytes48 *)(*env)->GetPrimitiveArrayCritical(env, proof_bytes, NULL);
   Bytes32 *z_native =
-      (Bytes32 *)(*env)->GetByteArrayElements(env, z_bytes, NULL);
+      (Bytes32 *)(*env)->GetPrimitiveArrayCritical(env, z_bytes, NULL);
   Bytes32 *y_native =
-      (Bytes32 *)(*env)->GetByteArrayElements(env, y_bytes, NULL);
+      (Bytes32 *)(*env)->GetPrimitiveArrayCritical(env, y_bytes, NULL);
 
   bool out;
   C_KZG_RET ret = verify_kzg_proof(&out, commitment_native, z_native, y_native,
                                    proof_native, settings);
 
-  (*env)->ReleaseByteArrayElements(env, commitment_bytes,
-                                   (jbyte *)commitment_native, JNI_ABORT);
-  (*env)->ReleaseByteArrayElements(env, z_bytes, (jbyte *)z_native, JNI_ABORT);
-  (*env)->ReleaseByteArrayElements(env, y_bytes, (jbyte *)y_native, JNI_ABORT);
-  (*env)->ReleaseByteArrayElements(env, proof_bytes, (jbyte *)proof_native,
-                                   JNI_ABORT);
+  (*env)->ReleasePrimitiveArrayCritical(env, y_bytes, y_native, JNI_ABORT);
+  (*env)->ReleasePrimitiveArrayCritical(env, z_bytes, z_native, JNI_ABORT);
+  (*env)->ReleasePrimitiveArrayCritical(env, proof_bytes, proof_native,
+                                        JNI_ABORT);
+  (*env)->ReleasePrimitiveArrayCritical(env, commitment_bytes,
+                                        commitment_native, JNI_ABORT);
 
   if (ret != C_KZG_OK) {
     throw_c_kzg_exception(env, ret, "There was an error in verifyKzgProof.");
@@ -397,21 +422,26 @@ Java_ethereum_ckzg4844_CKZG4844JNI_verifyBlobKzgProof(
     return 0;
   }
 
-  Blob *blob_native = (Blob *)(*env)->GetByteArrayElements(env, blob, NULL);
+  /*
+   * One blob evaluation and a pairing check, short enough to pin the arrays
+   * instead of copying the blob. No JNI calls until they are released.
+   */
+  Blob *blob_native =
+      (Blob *)(*env)->GetPrimitiveArrayCritical(env, blob, NULL);
   Bytes48 *commitment_native =
-      (Bytes48 *)(*env)->GetByteArrayElements(env, commitment_bytes, NULL);
+      (Bytes48 *)(*env)->GetPrimitiveArrayCritical(env, commitment_bytes, NULL);
   Bytes48 *proof_native =
-      (Bytes48 *)(*env)->GetByteArrayElements(env, proof_bytes, NULL);
+      (Bytes48 *)(*env)->GetPrimitiveArrayCritical(env, proof_bytes, NULL);
 
   bool out;
   C_KZG_RET ret = verify_blob_kzg_proof(&out, blob_native, commitment_native,
                                         proof_native, settings);
 
-  (*env)->ReleaseByteArrayElements(env, blob, (jbyte *)blob_native, JNI_ABORT);
-  (*env)->ReleaseByteArrayElements(env, commitment_bytes,
-                                   (jbyte *)commitment_native, JNI_ABORT);
-  (*env)->ReleaseByteArrayElements(env, proof_bytes, (jbyte *)proof_native,
-                                   JNI_ABORT);
+  (*env)->ReleasePrimitiveArrayCritical(env, proof_bytes, proof_native,
+                                        JNI_ABORT);
+  (*env)->ReleasePrimitiveArrayCritical(env, commitment_bytes,
+                                        commitment_native, JNI_ABORT);
+  (*env)->ReleasePrimitiveArrayCritical(env, blob, blob_native, JNI_ABORT);
 
   if (ret != C_KZG_OK) {
     throw_c_kzg_exception(env, ret,
@@ -730,3 +760,142 @@ Java_ethereum_ckzg4844_CKZG4844JNI_verifyCellKzgProofBatch(
 
   return (jboolean)out;
 }
+
+JNIEXPORT void JNICALL
+Java_ethereum_ckzg4844_CKZG4844JNI_blobToKzgCommitmentsDirect(
+    JNIEnv *env, jclass thisCls, jobject blobs, jobject commitments,
+    jint count) {
+  if (settings == NULL) {
+    throw_exception(env, TRUSTED_SETUP_NOT_LOADED);
+    return;
+  }
+
+  size_t count_native = (size_t)count;
+  const Blob *blobs_native = (const Blob *)get_direct_buffer(
+      env, blobs, "Invalid blobs size.", count_native * BYTES_PER_BLOB);
+  if (blobs_native == NULL) return;
+  KZGCommitment *commitments_native = (KZGCommitment *)get_direct_buffer(
+      env, commitments, "Invalid commitments size.",
+      count_native * BYTES_PER_COMMITMENT);
+  if (commitments_native == NULL) return;
+
+  C_KZG_RET ret = blob_to_kzg_commitments(commitments_native, blobs_native,
+                                          count_native, settings);
+  if (ret != C_KZG_OK) {
+    throw_c_kzg_exception(env, ret,
+                          "There was an error in blobToKzgCommitments.");
+    return;
+  }
+}
+
+JNIEXPORT void JNICALL
+Java_ethereum_ckzg4844_CKZG4844JNI_computeCellsAndKzgProofsBatchDirect(
+    JNIEnv *env, jclass thisCls, jobject blobs, jint count, jobject cells,
+    jobject proofs) {
+  if (settings == NULL) {
+    throw_exception(env, TRUSTED_SETUP_NOT_LOADED);
+    return;
+  }
+
+  size_t count_native = (size_t)count;
+  const Blob *blobs_native = (const Blob *)get_direct_buffer(
+      env, blobs, "Invalid blobs size.", count_native * BYTES_PER_BLOB);
+  if (blobs_native == NULL) return;
+  Cell *cells_native = (Cell *)get_direct_buffer(
+      env, cells, "Invalid cells size.",
+      count_native * CELLS_PER_EXT_BLOB * BYTES_PER_CELL);
+  if (cells_native == NULL) return;
+
+  /* Proofs are optional, computing cells alone is much cheaper */
+  KZGProof *proofs_native = NULL;
+  if (proofs != NULL) {
+    proofs_native = (KZGProof *)get_direct_buffer(
+        env, proofs, "Invalid proofs size.",
+        count_native * CELLS_PER_EXT_BLOB * BYTES_PER_PROOF);
+    if (proofs_native == NULL) return;
+  }
+
+  C_KZG_RET ret = compute_cells_and_kzg_proofs_batch(
+      cells_native, proofs_native, blobs_native, count_native, settings);
+  if (ret != C_KZG_OK) {
+    throw_c_kzg_exception(
+        env, ret, "There was an error in computeCellsAndKzgProofsBatch.");
+    return;
+  }
+}
+
+JNIEXPORT jboolean JNICALL
+Java_ethereum_ckzg4844_CKZG4844JNI_verifyBlobKzgProofBatchDirect(
+    JNIEnv *env, jclass thisCls, jobject blobs, jobject commitments_bytes,
+    jobject proofs_bytes, jint count) {
+  if (settings == NULL) {
+    throw_exception(env, TRUSTED_SETUP_NOT_LOADED);
+    return 0;
+  }
+
+  size_t count_native = (size_t)count;
+  const Blob *blobs_native = (const Blob *)get_direct_buffer(
+      env, blobs, "Invalid blobs size.", count_native * BYTES_PER_BLOB);
+  if (blobs_native == NULL) return 0;
+  const Bytes48 *commitments_native = (const Bytes48 *)get_direct_buffer(
+      env, commitments_bytes, "Invalid commitments size.",
+      count_native * BYTES_PER_COMMITMENT);
+  if (commitments_native == NULL) return 0;
+  const Bytes48 *proofs_native = (const Bytes48 *)get_direct_buffer(
+      env, proofs_bytes, "Invalid proofs size.",
+      count_native * BYTES_PER_PROOF);
+  if (proofs_native == NULL) return 0;
+
+  bool out;
+  C_KZG_RET ret =
+      verify_blob_kzg_proof_batch(&out, blobs_native, commitments_native,
+                                  proofs_native, count_native, settings);
+  if (ret != C_KZG_OK) {
+    throw_c_kzg_exception(env, ret,
+                          "There was an error in verifyBlobKzgProofBatch.");
+    return 0;
+  }
+
+  return (jboolean)out;
+}
+
+JNIEXPORT jboolean JNICALL
+Java_ethereum_ckzg4844_CKZG4844JNI_verifyCellKzgProofBatchDirect(
+    JNIEnv *env, jclass thisCls, jobject commitments_bytes,
+    jlongArray cell_indices, jobject cells, jobject proofs_bytes) {
+  if (settings == NULL) {
+    throw_exception(env, TRUSTED_SETUP_NOT_LOADED);
+    return 0;
+  }
+
+  size_t count = (size_t)(*env)->GetArrayLength(env, cell_indices);
+  const Bytes48 *commitments_native = (const Bytes48 *)get_direct_buffer(
+      env, commitments_bytes, "Invalid commitments size.",
+      count * BYTES_PER_COMMITMENT);
+  if (commitments_native == NULL) return 0;
+  const Cell *cells_native = (const Cell *)get_direct_buffer(
+      env, cells, "Invalid cells size.", count * BYTES_PER_CELL);
+  if (cells_native == NULL) return 0;
+  const Bytes48 *proofs_native = (const Bytes48 *)get_direct_buffer(
+      env, proofs_bytes, "Invalid proofs size.", count * BYTES_PER_PROOF);
+  if (proofs_native == NULL) return 0;
+
+  uint64_t *cell_indices_native =
+      (uint64_t *)(*env)->GetLongArrayElements(env, cell_indices, NULL);
+
+  bool out;
+  C_KZG_RET ret =
+      verify_cell_kzg_proof_batch(&out, commitments_native, cell_indices_native,
+                                  cells_native, proofs_native, count, settings);
+
+  (*env)->ReleaseLongArrayElements(env, cell_indices,
+                                   (jlong *)cell_indices_native, JNI_ABORT);
+
+  if (ret != C_KZG_OK) {
+    throw_c_kzg_exception(env, ret,
+                          "There was an error in verifyCellKzgProofBatch.");
+    return 0;
+  }
+
+  return (jboolean)out;
+}
@@ -135,6 +135,38 @@ JNIEXPORT jobject JNICALL Java_ethereum_ckzg4844_CKZG4844JNI_recoverCellsAndKzgP
 JNIEXPORT jboolean JNICALL Java_ethereum_ckzg4844_CKZG4844JNI_verifyCellKzgProofBatch
   (JNIEnv *, jclass, jbyteArray, jlongArray, jbyteArray, jbyteArray);
 
+/*
+ * Class:     ethereum_ckzg4844_CKZG4844JNI
+ * Method:    blobToKzgCommitmentsDirect
+ * Signature: (Ljava/nio/ByteBuffer;Ljava/nio/ByteBuffer;I)V
+ */
+JNIEXPORT void JNICALL Java_ethereum_ckzg4844_CKZG4844JNI_blobToKzgCommitmentsDirect
+  (JNIEnv *, jclass, jobject, jobject, jint);
+
+/*
+ * Class:     ethereum_ckzg4844_CKZG4844JNI
+ * Method:    computeCellsAndKzgProofsBatchDirect
+ * Signature: (Ljava/nio/ByteBuffer;ILjava/nio/ByteBuffer;Ljava/nio/ByteBuffer;)V
+ */
+JNIEXPORT void JNICALL Java_ethereum_ckzg4844_CKZG4844JNI_computeCellsAndKzgProofsBatchDirect
+  (JNIEnv *, jclass, jobject, jint, jobject, jobject);
+
+/*
+ * Class:     ethereum_ckzg4844_CKZG4844JNI
+ * Method:    verifyBlobKzgProofBatchDirect
+ * Signature: (Ljava/nio/ByteBuffer;Ljava/nio/ByteBuffer;Ljava/nio/ByteBuffer;I)Z
+ */
+JNIEXPORT jboolean JNICALL Java_ethereum_ckzg4844_CKZG4844JNI_verifyBlobKzgProofBatchDirect
+  (JNIEnv *, jclass, jobject, jobject, jobject, jint);
+
+/*
+ * Class:     ethereum_ckzg4844_CKZG4844JNI
+ * Method:    verifyCellKzgProofBatchDirect
+ * Signature: (Ljava/nio/ByteBuffer;[JLjava/nio/ByteBuffer;Ljava/nio/ByteBuffer;)Z
+ */
+JNIEXPORT jboolean JNICALL Java_ethereum_ckzg4844_CKZG4844JNI_verifyCellKzgProofBatchDirect
+  (JNIEnv *, jclass, jobject, jlongArray, jobject, jobject);
+
 #ifdef __cplusplus
 }
 #endif
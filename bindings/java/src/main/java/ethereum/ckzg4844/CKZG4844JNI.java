@@ -4,6 +4,7 @@ import java.io.IOException;
 import java.io.InputStream;
 import java.io.UncheckedIOException;
 import java.math.BigInteger;
+import java.nio.ByteBuffer;
 import java.nio.file.Files;
 import java.nio.file.Path;
 import java.nio.file.StandardCopyOption;
@@ -254,4 +255,104 @@ public class CKZG4844JNI {
    */
   public static native boolean verifyCellKzgProofBatch(
       byte[] commitmentsBytes, long[] cellIndices, byte[] cells, byte[] proofsBytes);
+
+  /*
+   * Direct ByteBuffer variants. These read inputs and write outputs in place, between each buffer's
+   * position and limit, without copying through the Java heap. Buffer positions are not changed.
+   */
+
+  /**
+   * Calculates the commitments for multiple blobs in a single native call.
+   *
+   * @param blobs direct buffer holding {@code count} flattened blobs
+   * @param commitmentsOut direct buffer with room for exactly {@code count} commitments
+   * @param count the number of blobs
+   * @throws CKZGException if there is a crypto error
+   * @throws IllegalArgumentException if a buffer is not direct
+   */
+  public static void blobToKzgCommitments(ByteBuffer blobs, ByteBuffer commitmentsOut, int count) {
+    blobToKzgCommitmentsDirect(
+        directSlice(blobs, "blobs"), directSlice(commitmentsOut, "commitmentsOut"), count);
+  }
+
+  /**
+   * Get the cells and proofs for multiple blobs in a single native call. The cells and proofs for
+   * blob {@code i} start at cell/proof {@code i * CELLS_PER_EXT_BLOB} of the outputs.
+   *
+   * @param blobs direct buffer holding {@code count} flattened blobs
+   * @param count the number of blobs
+   * @param cellsOut direct buffer with room for exactly {@code count * CELLS_PER_EXT_BLOB} cells
+   * @param proofsOut direct buffer with room for exactly {@code count * CELLS_PER_EXT_BLOB} proofs,
+   *     or null to only compute cells
+   * @throws CKZGException if there is a crypto error
+   * @throws IllegalArgumentException if a buffer is not direct
+   */
+  public static void computeCellsAndKzgProofsBatch(
+      ByteBuffer blobs, int count, ByteBuffer cellsOut, ByteBuffer proofsOut) {
+    computeCellsAndKzgProofsBatchDirect(
+        directSlice(blobs, "blobs"),
+        count,
+        directSlice(cellsOut, "cellsOut"),
+        proofsOut == null ? null : directSlice(proofsOut, "proofsOut"));
+  }
+
+  /**
+   * A direct buffer variant of {@link #verifyBlobKzgProofBatch(byte[],byte[],byte[],long)}.
+   *
+   * @param blobs direct buffer holding {@code count} flattened blobs
+   * @param commitmentsBytes direct buffer holding {@code count} flattened commitments
+   * @param proofsBytes direct buffer holding {@code count} flattened proofs
+   * @param count the number of blobs
+   * @return true if the proof is valid and false otherwise
+   * @throws CKZGException if there is a crypto error
+   * @throws IllegalArgumentException if a buffer is not direct
+   */
+  public static boolean verifyBlobKzgProofBatch(
+      ByteBuffer blobs, ByteBuffer commitmentsBytes, ByteBuffer proofsBytes, int count) {
+    return verifyBlobKzgProofBatchDirect(
+        directSlice(blobs, "blobs"),
+        directSlice(commitmentsBytes, "commitmentsBytes"),
+        directSlice(proofsBytes, "proofsBytes"),
+        count);
+  }
+
+  /**
+   * A direct buffer variant of {@link #verifyCellKzgProofBatch(byte[],long[],byte[],byte[])}.
+   *
+   * @param commitmentsBytes direct buffer holding the commitment for each cell
+   * @param cellIndices the column index for each cell
+   * @param cells direct buffer holding the cells to verify
+   * @param proofsBytes direct buffer holding the proof for each cell
+   * @return true if the cells are valid with respect to the given commitments
+   * @throws CKZGException if there is a crypto error
+   * @throws IllegalArgumentException if a buffer is not direct
+   */
+  public static boolean verifyCellKzgProofBatch(
+      ByteBuffer commitmentsBytes, long[] cellIndices, ByteBuffer cells, ByteBuffer proofsBytes) {
+    return verifyCellKzgProofBatchDirect(
+        directSlice(commitmentsBytes, "commitmentsBytes"),
+        cellIndices,
+        directSlice(cells, "cells"),
+        directSlice(proofsBytes, "proofsBytes"));
+  }
+
+  /* Native code sees a slice's position..limit as address..capacity. */
+  private static ByteBuffer directSlice(ByteBuffer buffer, String name) {
+    if (!buffer.isDirect()) {
+      throw new IllegalArgumentException(name + " must be a direct ByteBuffer.");
+    }
+    return buffer.slice();
+  }
+
+  private static native void blobToKzgCommitmentsDirect(
+      ByteBuffer blobs, ByteBuffer commitments, int count);
+
+  private static native void computeCellsAndKzgProofsBatchDirect(
+      ByteBuffer blobs, int count, ByteBuffer cells, ByteBuffer proofs);
+
+  private static native boolean verifyBlobKzgProofBatchDirect(
+      ByteBuffer blobs, ByteBuffer commitmentsBytes, ByteBuffer proofsBytes, int count);
+
+  private static native boolean verifyCellKzgProofBatchDirect(
+      ByteBuffer commitmentsBytes, long[] cellIndices, ByteBuffer cells, ByteBuffer proofsBytes);
 }
@@ -1,5 +1,6 @@
 package ethereum.ckzg4844;
 
+import static ethereum.ckzg4844.CKZG4844JNI.BYTES_PER_BLOB;
 import static ethereum.ckzg4844.CKZG4844JNI.BYTES_PER_CELL;
 import static ethereum.ckzg4844.CKZG4844JNI.BYTES_PER_COMMITMENT;
 import static ethereum.ckzg4844.CKZG4844JNI.BYTES_PER_PROOF;
@@ -13,6 +14,8 @@ import static org.junit.jupiter.api.Assertions.assertThrows;
 import static org.junit.jupiter.api.Assertions.assertTrue;
 
 import ethereum.ckzg4844.test_formats.*;
+import java.nio.ByteBuffer;
+import java.util.Arrays;
 import java.util.stream.IntStream;
 import java.util.stream.LongStream;
 import java.util.stream.Stream;
@@ -275,6 +278,95 @@ public class CKZG4844JNITest {
     CKZG4844JNI.freeTrustedSetup();
   }
 
+  @Test
+  public void checkDirectBufferBatchMethods() {
+    loadTrustedSetup();
+
+    final int count = 2;
+    final byte[] blobs = TestUtils.createRandomBlobs(count);
+    final ByteBuffer blobsBuffer = toDirectBuffer(blobs);
+
+    final ByteBuffer commitments = ByteBuffer.allocateDirect(count * BYTES_PER_COMMITMENT);
+    CKZG4844JNI.blobToKzgCommitments(blobsBuffer, commitments, count);
+
+    final int cellsPerBatch = count * CELLS_PER_EXT_BLOB;
+    final ByteBuffer cells = ByteBuffer.allocateDirect(cellsPerBatch * BYTES_PER_CELL);
+    final ByteBuffer proofs = ByteBuffer.allocateDirect(cellsPerBatch * BYTES_PER_PROOF);
+    CKZG4844JNI.computeCellsAndKzgProofsBatch(blobsBuffer, count, cells, proofs);
+
+    final ByteBuffer cellCommitments =
+        ByteBuffer.allocateDirect(cellsPerBatch * BYTES_PER_COMMITMENT);
+    final long[] cellIndices = new long[cellsPerBatch];
+    for (int i = 0; i < count; i++) {
+      final byte[] blob = Arrays.copyOfRange(blobs, i * BYTES_PER_BLOB, (i + 1) * BYTES_PER_BLOB);
+      final byte[] commitment = CKZG4844JNI.blobToKzgCommitment(blob);
+      final CellsAndProofs expected = CKZG4844JNI.computeCellsAndKzgProofs(blob);
+
+      assertArrayEquals(
+          commitment, getBytes(commitments, i * BYTES_PER_COMMITMENT, BYTES_PER_COMMITMENT));
+      final int cellsLength = CELLS_PER_EXT_BLOB * BYTES_PER_CELL;
+      assertArrayEquals(expected.getCells(), getBytes(cells, i * cellsLength, cellsLength));
+      final int proofsLength = CELLS_PER_EXT_BLOB * BYTES_PER_PROOF;
+      assertArrayEquals(expected.getProofs(), getBytes(proofs, i * proofsLength, proofsLength));
+
+      for (int j = 0; j < CELLS_PER_EXT_BLOB; j++) {
+        cellCommitments.put(commitment);
+        cellIndices[i * CELLS_PER_EXT_BLOB + j] = j;
+      }
+    }
+    cellCommitments.flip();
+
+    assertTrue(CKZG4844JNI.verifyCellKzgProofBatch(cellCommitments, cellIndices, cells, proofs));
+
+    final byte[] blobProofs = new byte[count * BYTES_PER_PROOF];
+    for (int i = 0; i < count; i++) {
+      final byte[] proof =
+          CKZG4844JNI.computeBlobKzgProof(
+              Arrays.copyOfRange(blobs, i * BYTES_PER_BLOB, (i + 1) * BYTES_PER_BLOB),
+              getBytes(commitments, i * BYTES_PER_COMMITMENT, BYTES_PER_COMMITMENT));
+      System.arraycopy(proof, 0, blobProofs, i * BYTES_PER_PROOF, BYTES_PER_PROOF);
+    }
+    assertTrue(
+        CKZG4844JNI.verifyBlobKzgProofBatch(
+            blobsBuffer, commitments, toDirectBuffer(blobProofs), count));
+
+    // The buffers are used between position and limit, and positions are left untouched
+    final ByteBuffer offsetCommitments = ByteBuffer.allocateDirect(BYTES_PER_COMMITMENT + 7);
+    offsetCommitments.position(7);
+    final ByteBuffer firstBlob = blobsBuffer.slice().limit(BYTES_PER_BLOB);
+    CKZG4844JNI.blobToKzgCommitments(firstBlob, offsetCommitments, 1);
+    assertEquals(7, offsetCommitments.position());
+    assertArrayEquals(
+        getBytes(commitments, 0, BYTES_PER_COMMITMENT),
+        getBytes(offsetCommitments, 7, BYTES_PER_COMMITMENT));
+
+    CKZG4844JNI.freeTrustedSetup();
+  }
+
+  @Test
+  public void directBufferMethodsRejectInvalidBuffers() {
+    loadTrustedSetup();
+
+    final ByteBuffer blobs = toDirectBuffer(TestUtils.createRandomBlobs(1));
+    assertThrows(
+        IllegalArgumentException.class,
+        () ->
+            CKZG4844JNI.blobToKzgCommitments(
+                blobs, ByteBuffer.allocate(BYTES_PER_COMMITMENT), 1));
+
+    final CKZGException exception =
+        assertThrows(
+            CKZGException.class,
+            () ->
+                CKZG4844JNI.blobToKzgCommitments(
+                    blobs, ByteBuffer.allocateDirect(BYTES_PER_COMMITMENT + 1), 1));
+    assertEquals(C_KZG_BADARGS, exception.getError());
+    assertEquals(
+        "Invalid commitments size. Expected 48 bytes but got 49.", exception.getErrorMessage());
+
+    CKZG4844JNI.freeTrustedSetup();
+  }
+
   @Test
   public void checkComputeBlobKzgProof() {
     loadTrustedSetup();
@@ -466,6 +558,18 @@ public class CKZG4844JNITest {
             .contains("There was an error while loading the Trusted Setup."));
   }
 
+  private static ByteBuffer toDirectBuffer(final byte[] bytes) {
+    final ByteBuffer buffer = ByteBuffer.allocateDirect(bytes.length);
+    buffer.put(bytes).flip();
+    return buffer;
+  }
+
+  private static byte[] getBytes(final ByteBuffer buffer, final int index, final int length) {
+    final byte[] bytes = new byte[length];
+    buffer.duplicate().position(index).get(bytes);
+    return bytes;
+  }
+
   private void assertExceptionIsTrustedSetupIsNotLoaded(final RuntimeException exception) {
     assertEquals("Trusted Setup is not loaded.", exception.getMessage());
   }
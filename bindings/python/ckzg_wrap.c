@@ -34,7 +34,10 @@ static PyObject *load_trusted_setup_wrap(PyObject *self, PyObject *args) {
     return PyErr_Format(PyExc_RuntimeError, "error reading trusted setup");
   }
 
-  C_KZG_RET ret = load_trusted_setup_file(s, fp, precompute_value);
+  C_KZG_RET ret;
+  Py_BEGIN_ALLOW_THREADS;
+  ret = load_trusted_setup_file(s, fp, precompute_value);
+  Py_END_ALLOW_THREADS;
   fclose(fp);
 
   if (ret != C_KZG_OK) {
@@ -63,8 +66,12 @@ static PyObject *blob_to_kzg_commitment_wrap(PyObject *self, PyObject *args) {
 
   Blob *blob = (Blob *)PyBytes_AsString(b);
   KZGCommitment *k = (KZGCommitment *)PyBytes_AsString(out);
-  if (blob_to_kzg_commitment(k, blob, PyCapsule_GetPointer(s, "KZGSettings")) !=
-      C_KZG_OK) {
+  KZGSettings *settings = PyCapsule_GetPointer(s, "KZGSettings");
+  C_KZG_RET ret;
+  Py_BEGIN_ALLOW_THREADS;
+  ret = blob_to_kzg_commitment(k, blob, settings);
+  Py_END_ALLOW_THREADS;
+  if (ret != C_KZG_OK) {
     Py_DECREF(out);
     return PyErr_Format(PyExc_RuntimeError, "blob_to_kzg_commitment failed");
   }
@@ -103,8 +110,12 @@ static PyObject *compute_kzg_proof_wrap(PyObject *self, PyObject *args) {
   Bytes32 *z_bytes = (Bytes32 *)PyBytes_AsString(z);
   KZGProof *proof = (KZGProof *)PyBytes_AsString(py_proof);
   Bytes32 *y_bytes = (Bytes32 *)PyBytes_AsString(py_y);
-  if (compute_kzg_proof(proof, y_bytes, blob, z_bytes,
-                        PyCapsule_GetPointer(s, "KZGSettings")) != C_KZG_OK) {
+  KZGSettings *settings = PyCapsule_GetPointer(s, "KZGSettings");
+  C_KZG_RET ret;
+  Py_BEGIN_ALLOW_THREADS;
+  ret = compute_kzg_proof(proof, y_bytes, blob, z_bytes, settings);
+  Py_END_ALLOW_THREADS;
+  if (ret != C_KZG_OK) {
     Py_DECREF(out);
     return PyErr_Format(PyExc_RuntimeError, "compute_kzg_proof failed");
   }
@@ -136,9 +147,12 @@ static PyObject *compute_blob_kzg_proof_wrap(PyObject *self, PyObject *args) {
   Blob *blob = (Blob *)PyBytes_AsString(b);
   Bytes48 *commitment_bytes = (Bytes48 *)PyBytes_AsString(c);
   KZGProof *proof = (KZGProof *)PyBytes_AsString(out);
-  if (compute_blob_kzg_proof(proof, blob, commitment_bytes,
-                             PyCapsule_GetPointer(s, "KZGSettings")) !=
-      C_KZG_OK) {
+  KZGSettings *settings = PyCapsule_GetPointer(s, "KZGSettings");
+  C_KZG_RET ret;
+  Py_BEGIN_ALLOW_THREADS;
+  ret = compute_blob_kzg_proof(proof, blob, commitment_bytes, settings);
+  Py_END_ALLOW_THREADS;
+  if (ret != C_KZG_OK) {
     Py_DECREF(out);
     return PyErr_Format(PyExc_RuntimeError, "compute_blob_kzg_proof failed");
   }
@@ -174,8 +188,13 @@ static PyObject *verify_kzg_proof_wrap(PyObject *self, PyObject *args) {
   const Bytes48 *proof_bytes = (Bytes48 *)PyBytes_AsString(p);
 
   bool ok;
-  if (verify_kzg_proof(&ok, commitment_bytes, z_bytes, y_bytes, proof_bytes,
-                       PyCapsule_GetPointer(s, "KZGSettings")) != C_KZG_OK) {
+  KZGSettings *settings = PyCapsule_GetPointer(s, "KZGSettings");
+  C_KZG_RET ret;
+  Py_BEGIN_ALLOW_THREADS;
+  ret = verify_kzg_proof(&ok, commitment_bytes, z_bytes, y_bytes, proof_bytes,
+                         settings);
+  Py_END_ALLOW_THREADS;
+  if (ret != C_KZG_OK) {
     return PyErr_Format(PyExc_RuntimeError, "verify_kzg_proof failed");
   }
 
@@ -209,9 +228,13 @@ static PyObject *verify_blob_kzg_proof_wrap(PyObject *self, PyObject *args) {
   const Bytes48 *proof_bytes = (Bytes48 *)PyBytes_AsString(p);
 
   bool ok;
-  if (verify_blob_kzg_proof(&ok, blob_bytes, commitment_bytes, proof_bytes,
-                            PyCapsule_GetPointer(s, "KZGSettings")) !=
-      C_KZG_OK) {
+  KZGSettings *settings = PyCapsule_GetPointer(s, "KZGSettings");
+  C_KZG_RET ret;
+  Py_BEGIN_ALLOW_THREADS;
+  ret = verify_blob_kzg_proof(&ok, blob_bytes, commitment_bytes, proof_bytes,
+                              settings);
+  Py_END_ALLOW_THREADS;
+  if (ret != C_KZG_OK) {
     return PyErr_Format(PyExc_RuntimeError, "verify_blob_kzg_proof failed");
   }
 
@@ -221,59 +244,293 @@ static PyObject *verify_blob_kzg_proof_wrap(PyObject *self, PyObject *args) {
     Py_RETURN_FALSE;
 }
 
+/*
+ * Get a C-contiguous view of a buffer-protocol object (bytes, bytearray,
+ * memoryview, numpy array, ...) holding a whole number of items of item_size
+ * bytes. The item count is written to count. On failure, a Python exception is
+ * set, -1 is returned, and there is nothing to release.
+ *
+ * The view pins the underlying memory, so it can be read or written with the
+ * GIL released. Concurrent writes to a mutable buffer from other threads are
+ * the caller's problem, as they would be in Python.
+ */
+static int get_items_buffer(Py_buffer *view, Py_ssize_t *count, PyObject *obj,
+                            Py_ssize_t item_size, bool writable,
+                            const char *name) {
+  int flags = PyBUF_C_CONTIGUOUS;
+  if (writable) flags |= PyBUF_WRITABLE;
+  if (PyObject_GetBuffer(obj, view, flags) != 0) {
+    PyErr_Format(PyExc_ValueError, "expected %s to be a %scontiguous buffer",
+                 name, writable ? "writable " : "");
+    return -1;
+  }
+  if (view->len % item_size != 0) {
+    PyErr_Format(PyExc_ValueError,
+                 "expected %s to be a multiple of %zd bytes", name, item_size);
+    PyBuffer_Release(view);
+    return -1;
+  }
+  *count = view->len / item_size;
+  return 0;
+}
+
+/*
+ * Get a view of a buffer holding native-endian 64-bit unsigned integers, such
+ * as array.array('Q') or a numpy.uint64 array. Same contract as
+ * get_items_buffer().
+ */
+static int get_uint64_buffer(Py_buffer *view, Py_ssize_t *count,
+                             PyObject *obj, const char *name) {
+  if (PyObject_GetBuffer(obj, view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0) {
+    PyErr_Format(PyExc_ValueError, "expected %s to be a contiguous buffer",
+                 name);
+    return -1;
+  }
+  /* Accept native "Q"/"L" (with an optional native byte order prefix) */
+  const char *format = view->format != NULL ? view->format : "B";
+  if (format[0] == '@' || format[0] == '=') format++;
+  if (view->itemsize != 8 ||
+      (strcmp(format, "Q") != 0 && strcmp(format, "L") != 0)) {
+    PyErr_Format(PyExc_ValueError,
+                 "expected %s to hold native 64-bit unsigned integers", name);
+    PyBuffer_Release(view);
+    return -1;
+  }
+  *count = view->len / 8;
+  return 0;
+}
+
 static PyObject *verify_blob_kzg_proof_batch_wrap(PyObject *self,
                                                   PyObject *args) {
   PyObject *b, *c, *p, *s;
+  PyObject *ret = NULL;
+  Py_buffer blobs_view = {0}, commitments_view = {0}, proofs_view = {0};
+  Py_ssize_t blobs_count, commitments_count, proofs_count;
 
   if (!PyArg_UnpackTuple(args, "verify_blob_kzg_proof_batch", 4, 4, &b, &c, &p,
                          &s) ||
-      !PyBytes_Check(b) || !PyBytes_Check(c) || !PyBytes_Check(p) ||
       !PyCapsule_IsValid(s, "KZGSettings"))
     return PyErr_Format(PyExc_ValueError,
-                        "expected bytes, bytes, bytes, trusted setup");
+                        "expected buffer, buffer, buffer, trusted setup");
 
-  Py_ssize_t blobs_count = PyBytes_Size(b);
-  if (blobs_count % BYTES_PER_BLOB != 0)
-    return PyErr_Format(
-        PyExc_ValueError,
-        "expected blobs to be a multiple of BYTES_PER_BLOB bytes");
-  blobs_count = blobs_count / BYTES_PER_BLOB;
+  if (get_items_buffer(&blobs_view, &blobs_count, b, BYTES_PER_BLOB, false,
+                       "blobs") != 0)
+    goto out;
+  if (get_items_buffer(&commitments_view, &commitments_count, c,
+                       BYTES_PER_COMMITMENT, false, "commitments") != 0)
+    goto out;
+  if (get_items_buffer(&proofs_view, &proofs_count, p, BYTES_PER_PROOF, false,
+                       "proofs") != 0)
+    goto out;
 
-  Py_ssize_t commitments_count = PyBytes_Size(c);
-  if (commitments_count % BYTES_PER_COMMITMENT != 0)
-    return PyErr_Format(
-        PyExc_ValueError,
-        "expected commitments to be a multiple of BYTES_PER_COMMITMENT bytes");
-  commitments_count = commitments_count / BYTES_PER_COMMITMENT;
+  if (blobs_count != commitments_count || blobs_count != proofs_count) {
+    ret = PyErr_Format(PyExc_ValueError,
+                       "expected same number of blobs/commitments/proofs");
+    goto out;
+  }
 
-  Py_ssize_t proofs_count = PyBytes_Size(p);
-  if (proofs_count % BYTES_PER_PROOF != 0)
-    return PyErr_Format(
-        PyExc_ValueError,
-        "expected proofs to be a multiple of BYTES_PER_PROOF bytes");
-  proofs_count = proofs_count / BYTES_PER_PROOF;
+  bool ok;
+  KZGSettings *settings = PyCapsule_GetPointer(s, "KZGSettings");
+  C_KZG_RET err;
+  Py_BEGIN_ALLOW_THREADS;
+  err = verify_blob_kzg_proof_batch(
+      &ok, (const Blob *)blobs_view.buf, (const Bytes48 *)commitments_view.buf,
+      (const Bytes48 *)proofs_view.buf, (uint64_t)blobs_count, settings);
+  Py_END_ALLOW_THREADS;
+  if (err != C_KZG_OK) {
+    ret = PyErr_Format(PyExc_RuntimeError,
+                       "verify_blob_kzg_proof_batch failed");
+    goto out;
+  }
 
-  if (blobs_count != commitments_count || blobs_count != proofs_count) {
+  ret = ok ? Py_True : Py_False;
+  Py_INCREF(ret);
+
+out:
+  if (blobs_view.obj != NULL) PyBuffer_Release(&blobs_view);
+  if (commitments_view.obj != NULL) PyBuffer_Release(&commitments_view);
+  if (proofs_view.obj != NULL) PyBuffer_Release(&proofs_view);
+  return ret;
+}
+
+static PyObject *blob_to_kzg_commitments_into_wrap(PyObject *self,
+                                                   PyObject *args) {
+  PyObject *b, *out_obj, *s;
+  PyObject *ret = NULL;
+  Py_buffer blobs_view = {0}, commitments_view = {0};
+  Py_ssize_t blobs_count, commitments_count;
+
+  if (!PyArg_UnpackTuple(args, "blob_to_kzg_commitments_into", 3, 3, &b,
+                         &out_obj, &s) ||
+      !PyCapsule_IsValid(s, "KZGSettings"))
     return PyErr_Format(PyExc_ValueError,
-                        "expected same number of blobs/commitments/proofs");
+                        "expected buffer, writable buffer, trusted setup");
+
+  if (get_items_buffer(&blobs_view, &blobs_count, b, BYTES_PER_BLOB, false,
+                       "blobs") != 0)
+    goto out;
+  if (get_items_buffer(&commitments_view, &commitments_count, out_obj,
+                       BYTES_PER_COMMITMENT, true, "commitments_out") != 0)
+    goto out;
+
+  if (blobs_count != commitments_count) {
+    ret = PyErr_Format(PyExc_ValueError,
+                       "expected same number of blobs/commitments");
+    goto out;
   }
 
-  const Blob *blobs_bytes = (Blob *)PyBytes_AsString(b);
-  const Bytes48 *commitments_bytes = (Bytes48 *)PyBytes_AsString(c);
-  const Bytes48 *proofs_bytes = (Bytes48 *)PyBytes_AsString(p);
+  const Blob *blobs = (const Blob *)blobs_view.buf;
+  KZGCommitment *commitments = (KZGCommitment *)commitments_view.buf;
+  KZGSettings *settings = PyCapsule_GetPointer(s, "KZGSettings");
+  C_KZG_RET err = C_KZG_OK;
+  Py_BEGIN_ALLOW_THREADS;
+  for (Py_ssize_t i = 0; i < blobs_count; i++) {
+    err = blob_to_kzg_commitment(&commitments[i], &blobs[i], settings);
+    if (err != C_KZG_OK) break;
+  }
+  Py_END_ALLOW_THREADS;
+  if (err != C_KZG_OK) {
+    ret = PyErr_Format(PyExc_RuntimeError, "blob_to_kzg_commitment failed");
+    goto out;
+  }
+
+  Py_INCREF(Py_None);
+  ret = Py_None;
+
+out:
+  if (blobs_view.obj != NULL) PyBuffer_Release(&blobs_view);
+  if (commitments_view.obj != NULL) PyBuffer_Release(&commitments_view);
+  return ret;
+}
+
+static PyObject *compute_cells_and_kzg_proofs_into_wrap(PyObject *self,
+                                                        PyObject *args) {
+  PyObject *b, *cells_obj, *proofs_obj, *s;
+  PyObject *ret = NULL;
+  Py_buffer blobs_view = {0}, cells_view = {0}, proofs_view = {0};
+  Py_ssize_t blobs_count, cells_count, proofs_count;
+
+  if (!PyArg_UnpackTuple(args, "compute_cells_and_kzg_proofs_into", 4, 4, &b,
+                         &cells_obj, &proofs_obj, &s) ||
+      !PyCapsule_IsValid(s, "KZGSettings"))
+    return PyErr_Format(PyExc_ValueError,
+                        "expected buffer, writable buffer, writable "
+                        "buffer/None, trusted setup");
+
+  if (get_items_buffer(&blobs_view, &blobs_count, b, BYTES_PER_BLOB, false,
+                       "blobs") != 0)
+    goto out;
+  if (get_items_buffer(&cells_view, &cells_count, cells_obj, BYTES_PER_CELL,
+                       true, "cells_out") != 0)
+    goto out;
+  if (cells_count != blobs_count * CELLS_PER_EXT_BLOB) {
+    ret = PyErr_Format(PyExc_ValueError,
+                       "expected cells_out to hold CELLS_PER_EXT_BLOB cells "
+                       "per blob");
+    goto out;
+  }
+  if (proofs_obj != Py_None) {
+    if (get_items_buffer(&proofs_view, &proofs_count, proofs_obj,
+                         BYTES_PER_PROOF, true, "proofs_out") != 0)
+      goto out;
+    if (proofs_count != blobs_count * CELLS_PER_EXT_BLOB) {
+      ret = PyErr_Format(PyExc_ValueError,
+                         "expected proofs_out to hold CELLS_PER_EXT_BLOB "
+                         "proofs per blob");
+      goto out;
+    }
+  }
+
+  const Blob *blobs = (const Blob *)blobs_view.buf;
+  Cell *cells = (Cell *)cells_view.buf;
+  KZGProof *proofs = (KZGProof *)proofs_view.buf;
+  KZGSettings *settings = PyCapsule_GetPointer(s, "KZGSettings");
+  C_KZG_RET err = C_KZG_OK;
+  Py_BEGIN_ALLOW_THREADS;
+  for (Py_ssize_t i = 0; i < blobs_count; i++) {
+    /* Cells (and proofs, if requested) for blob i start at i * 128 */
+    size_t offset = (size_t)i * CELLS_PER_EXT_BLOB;
+    err = compute_cells_and_kzg_proofs(
+        &cells[offset], proofs != NULL ? &proofs[offset] : NULL, &blobs[i],
+        settings);
+    if (err != C_KZG_OK) break;
+  }
+  Py_END_ALLOW_THREADS;
+  if (err != C_KZG_OK) {
+    ret = PyErr_Format(PyExc_RuntimeError,
+                       "compute_cells_and_kzg_proofs failed");
+    goto out;
+  }
+
+  Py_INCREF(Py_None);
+  ret = Py_None;
+
+out:
+  if (blobs_view.obj != NULL) PyBuffer_Release(&blobs_view);
+  if (cells_view.obj != NULL) PyBuffer_Release(&cells_view);
+  if (proofs_view.obj != NULL) PyBuffer_Release(&proofs_view);
+  return ret;
+}
+
+static PyObject *verify_cell_kzg_proof_batch_buffers_wrap(PyObject *self,
+                                                          PyObject *args) {
+  PyObject *c, *i, *ce, *p, *s;
+  PyObject *ret = NULL;
+  Py_buffer commitments_view = {0}, indices_view = {0}, cells_view = {0},
+            proofs_view = {0};
+  Py_ssize_t commitments_count, indices_count, cells_count, proofs_count;
+
+  if (!PyArg_UnpackTuple(args, "verify_cell_kzg_proof_batch_buffers", 5, 5, &c,
+                         &i, &ce, &p, &s) ||
+      !PyCapsule_IsValid(s, "KZGSettings"))
+    return PyErr_Format(
+        PyExc_ValueError,
+        "expected buffer, buffer, buffer, buffer, trusted setup");
+
+  if (get_items_buffer(&commitments_view, &commitments_count, c,
+                       BYTES_PER_COMMITMENT, false, "commitments") != 0)
+    goto out;
+  if (get_uint64_buffer(&indices_view, &indices_count, i, "cell_indices") != 0)
+    goto out;
+  if (get_items_buffer(&cells_view, &cells_count, ce, BYTES_PER_CELL, false,
+                       "cells") != 0)
+    goto out;
+  if (get_items_buffer(&proofs_view, &proofs_count, p, BYTES_PER_PROOF, false,
+                       "proofs") != 0)
+    goto out;
+
+  if (commitments_count != cells_count || indices_count != cells_count ||
+      proofs_count != cells_count) {
+    ret = PyErr_Format(PyExc_ValueError,
+                       "expected same number of "
+                       "commitments/cell_indices/cells/proofs");
+    goto out;
+  }
 
   bool ok;
-  if (verify_blob_kzg_proof_batch(
-          &ok, blobs_bytes, commitments_bytes, proofs_bytes, blobs_count,
-          PyCapsule_GetPointer(s, "KZGSettings")) != C_KZG_OK) {
-    return PyErr_Format(PyExc_RuntimeError,
-                        "verify_blob_kzg_proof_batch failed");
+  KZGSettings *settings = PyCapsule_GetPointer(s, "KZGSettings");
+  C_KZG_RET err;
+  Py_BEGIN_ALLOW_THREADS;
+  err = verify_cell_kzg_proof_batch(
+      &ok, (const Bytes48 *)commitments_view.buf,
+      (const uint64_t *)indices_view.buf, (const Cell *)cells_view.buf,
+      (const Bytes48 *)proofs_view.buf, (uint64_t)cells_count, settings);
+  Py_END_ALLOW_THREADS;
+  if (err != C_KZG_OK) {
+    ret = PyErr_Format(PyExc_RuntimeError,
+                       "verify_cell_kzg_proof_batch failed");
+    goto out;
   }
 
-  if (ok)
-    Py_RETURN_TRUE;
-  else
-    Py_RETURN_FALSE;
+  ret = ok ? Py_True : Py_False;
+  Py_INCREF(ret);
+
+out:
+  if (commitments_view.obj != NULL) PyBuffer_Release(&commitments_view);
+  if (indices_view.obj != NULL) PyBuffer_Release(&indices_view);
+  if (cells_view.obj != NULL) PyBuffer_Release(&cells_view);
+  if (proofs_view.obj != NULL) PyBuffer_Release(&proofs_view);
+  return ret;
 }
 
 static PyObject *compute_cells_wrap(PyObject *self, PyObject *args) {
@@ -305,9 +562,12 @@ static PyObject *compute_cells_wrap(PyObject *self, PyObject *args) {
 
   /* Call our C function with our inputs */
   const Blob *blob = (Blob *)PyBytes_AsString(input_blob);
-  if (compute_cells_and_kzg_proofs(cells, NULL, blob,
-                                   PyCapsule_GetPointer(s, "KZGSettings")) !=
-      C_KZG_OK) {
+  KZGSettings *settings = PyCapsule_GetPointer(s, "KZGSettings");
+  C_KZG_RET err;
+  Py_BEGIN_ALLOW_THREADS;
+  err = compute_cells_and_kzg_proofs(cells, NULL, blob, settings);
+  Py_END_ALLOW_THREADS;
+  if (err != C_KZG_OK) {
     ret = PyErr_Format(PyExc_RuntimeError, "compute_cells failed");
     goto out;
   }
@@ -381,9 +641,12 @@ static PyObject *compute_cells_and_kzg_proofs_wrap(PyObject *self,
 
   /* Call our C function with our inputs */
   const Blob *blob = (Blob *)PyBytes_AsString(input_blob);
-  if (compute_cells_and_kzg_proofs(cells, proofs, blob,
-                                   PyCapsule_GetPointer(s, "KZGSettings")) !=
-      C_KZG_OK) {
+  KZGSettings *settings = PyCapsule_GetPointer(s, "KZGSettings");
+  C_KZG_RET err;
+  Py_BEGIN_ALLOW_THREADS;
+  err = compute_cells_and_kzg_proofs(cells, proofs, blob, settings);
+  Py_END_ALLOW_THREADS;
+  if (err != C_KZG_OK) {
     ret =
         PyErr_Format(PyExc_RuntimeError, "compute_cells_and_kzg_proofs failed");
     goto out;
@@ -539,10 +802,15 @@ static PyObject *recover_cells_and_kzg_proofs_wrap(PyObject *self,
     goto out;
   }
 
-  /* Call our C function with our inputs */
-  if (recover_cells_and_kzg_proofs(
-          recovered_cells, recovered_proofs, cell_indices, cells, cells_count,
-          PyCapsule_GetPointer(s, "KZGSettings")) != C_KZG_OK) {
+  /* Call our C function with our inputs, letting other threads run */
+  KZGSettings *settings = PyCapsule_GetPointer(s, "KZGSettings");
+  C_KZG_RET err;
+  Py_BEGIN_ALLOW_THREADS;
+  err = recover_cells_and_kzg_proofs(recovered_cells, recovered_proofs,
+                                     cell_indices, cells, cells_count,
+                                     settings);
+  Py_END_ALLOW_THREADS;
+  if (err != C_KZG_OK) {
     ret =
         PyErr_Format(PyExc_RuntimeError, "recover_cells_and_kzg_proofs failed");
     goto out;
@@ -752,10 +1020,14 @@ static PyObject *verify_cell_kzg_proof_batch_wrap(PyObject *self,
     memcpy(&proofs[i], PyBytes_AsString(proof), BYTES_PER_PROOF);
   }
 
-  /* Call our C function with our inputs */
-  if (verify_cell_kzg_proof_batch(
-          &ok, commitments, cell_indices, cells, proofs, cells_count,
-          PyCapsule_GetPointer(s, "KZGSettings")) != C_KZG_OK) {
+  /* Call our C function with our inputs, letting other threads run */
+  KZGSettings *settings = PyCapsule_GetPointer(s, "KZGSettings");
+  C_KZG_RET err;
+  Py_BEGIN_ALLOW_THREADS;
+  err = verify_cell_kzg_proof_batch(&ok, commitments, cell_indices, cells,
+                                    proofs, cells_count, settings);
+  Py_END_ALLOW_THREADS;
+  if (err != C_KZG_OK) {
     ret =
         PyErr_Format(PyExc_RuntimeError, "verify_cell_kzg_proof_batch failed");
     goto out;
@@ -801,9 +1073,33 @@ static PyMethodDef ckzgmethods[] = {
      METH_VARARGS, "Recover missing cells and proofs"},
     {"verify_cell_kzg_proof_batch", verify_cell_kzg_proof_batch_wrap,
      METH_VARARGS, "Verify multiple cell proofs"},
+    {"blob_to_kzg_commitments_into", blob_to_kzg_commitments_into_wrap,
+     METH_VARARGS, "Create commitments for a buffer of blobs, in place"},
+    {"compute_cells_and_kzg_proofs_into",
+     compute_cells_and_kzg_proofs_into_wrap, METH_VARARGS,
+     "Compute cells and proofs for a buffer of blobs, in place"},
+    {"verify_cell_kzg_proof_batch_buffers",
+     verify_cell_kzg_proof_batch_buffers_wrap, METH_VARARGS,
+     "Verify multiple cell proofs given as buffers"},
     {NULL, NULL, 0, NULL}};
 
 static struct PyModuleDef ckzg = {PyModuleDef_HEAD_INIT, "ckzg", NULL, -1,
                                   ckzgmethods};
 
-PyMODINIT_FUNC PyInit_ckzg(void) { return PyModule_Create(&ckzg); }
+PyMODINIT_FUNC PyInit_ckzg(void) {
+  PyObject *m = PyModule_Create(&ckzg);
+  if (m == NULL) return NULL;
+
+  /* Export sizes, so callers can allocate buffers for the batch functions */
+  if (PyModule_AddIntConstant(m, "BYTES_PER_BLOB", BYTES_PER_BLOB) != 0 ||
+      PyModule_AddIntConstant(m, "BYTES_PER_COMMITMENT",
+                              BYTES_PER_COMMITMENT) != 0 ||
+      PyModule_AddIntConstant(m, "BYTES_PER_PROOF", BYTES_PER_PROOF) != 0 ||
+      PyModule_AddIntConstant(m, "BYTES_PER_CELL", BYTES_PER_CELL) != 0 ||
+      PyModule_AddIntConstant(m, "CELLS_PER_EXT_BLOB", CELLS_PER_EXT_BLOB) !=
+          0) {
+    Py_DECREF(m);
+    return NULL;
+  }
+  return m;
+}
@@ -1,3 +1,4 @@
+import array
 import glob
 import yaml
 
@@ -30,6 +31,10 @@ def bytes_from_hex(hexstring):
     return bytes.fromhex(hexstring.replace("0x", ""))
 
 
+def all_sized(items, size):
+    return all(len(item) == size for item in items)
+
+
 ###############################################################################
 # Tests
 ###############################################################################
@@ -253,6 +258,94 @@ def test_verify_cell_kzg_proof_batch(ts):
         assert valid == expected_valid, f"{test_file}\n{valid=}\n{expected_valid=}"
 
 
+def test_blob_to_kzg_commitments_into(ts):
+    test_files = glob.glob(BLOB_TO_KZG_COMMITMENT_TESTS)
+    assert len(test_files) > 0
+
+    # Commit to every valid blob in a single call, writing into one buffer
+    blobs, expected_commitments = [], []
+    for test_file in test_files:
+        with open(test_file, "r") as f:
+            test = yaml.safe_load(f)
+        if test["output"] is None:
+            continue
+        blobs.append(bytes_from_hex(test["input"]["blob"]))
+        expected_commitments.append(bytes_from_hex(test["output"]))
+
+    commitments = bytearray(len(blobs) * ckzg.BYTES_PER_COMMITMENT)
+    ckzg.blob_to_kzg_commitments_into(memoryview(b"".join(blobs)), commitments, ts)
+    assert bytes(commitments) == b"".join(expected_commitments)
+
+    # The output buffer must be writable and sized for every blob
+    for bad_output in [bytes(len(commitments)), bytearray(len(commitments) + 1)]:
+        try:
+            ckzg.blob_to_kzg_commitments_into(b"".join(blobs), bad_output, ts)
+            assert False, "expected an exception"
+        except ValueError:
+            pass
+
+
+def test_compute_cells_and_kzg_proofs_into(ts):
+    test_files = glob.glob(COMPUTE_CELLS_AND_KZG_PROOFS_TESTS)
+    assert len(test_files) > 0
+
+    blobs, expected_cells, expected_proofs = [], [], []
+    for test_file in test_files:
+        with open(test_file, "r") as f:
+            test = yaml.safe_load(f)
+        if test["output"] is None:
+            continue
+        blobs.append(bytes_from_hex(test["input"]["blob"]))
+        expected_cells += map(bytes_from_hex, test["output"][0])
+        expected_proofs += map(bytes_from_hex, test["output"][1])
+
+    cells = bytearray(len(expected_cells) * ckzg.BYTES_PER_CELL)
+    proofs = bytearray(len(expected_proofs) * ckzg.BYTES_PER_PROOF)
+    ckzg.compute_cells_and_kzg_proofs_into(bytearray(b"".join(blobs)), cells, proofs, ts)
+    assert bytes(cells) == b"".join(expected_cells)
+    assert bytes(proofs) == b"".join(expected_proofs)
+
+    # Proofs are optional
+    cells = bytearray(len(cells))
+    ckzg.compute_cells_and_kzg_proofs_into(b"".join(blobs), memoryview(cells), None, ts)
+    assert bytes(cells) == b"".join(expected_cells)
+
+
+def test_verify_cell_kzg_proof_batch_buffers(ts):
+    test_files = glob.glob(VERIFY_CELL_KZG_PROOF_BATCH_TESTS)
+    assert len(test_files) > 0
+
+    for test_file in test_files:
+        with open(test_file, "r") as f:
+            test = yaml.safe_load(f)
+
+        commitments = list(map(bytes_from_hex, test["input"]["commitments"]))
+        cell_indices = test["input"]["cell_indices"]
+        cells = list(map(bytes_from_hex, test["input"]["cells"]))
+        proofs = list(map(bytes_from_hex, test["input"]["proofs"]))
+
+        # Concatenated buffers cannot represent individually mis-sized items
+        if not (all_sized(commitments, ckzg.BYTES_PER_COMMITMENT) and
+                all_sized(cells, ckzg.BYTES_PER_CELL) and
+                all_sized(proofs, ckzg.BYTES_PER_PROOF)):
+            continue
+
+        try:
+            valid = ckzg.verify_cell_kzg_proof_batch_buffers(
+                b"".join(commitments),
+                array.array("Q", cell_indices),
+                memoryview(bytearray(b"".join(cells))),
+                b"".join(proofs),
+                ts,
+            )
+        except:
+            assert test["output"] is None
+            continue
+
+        expected_valid = test["output"]
+        assert valid == expected_valid, f"{test_file}\n{valid=}\n{expected_valid=}"
+
+
 ###############################################################################
 # Main Logic
 ###############################################################################
@@ -272,4 +365,8 @@ if __name__ == "__main__":
     test_recover_cells_and_kzg_proofs(ts)
     test_verify_cell_kzg_proof_batch(ts)
 
+    test_blob_to_kzg_commitments_into(ts)
+    test_compute_cells_and_kzg_proofs_into(ts)
+    test_verify_cell_kzg_proof_batch_buffers(ts)
+
     print("tests passed")
@@ -47,6 +47,11 @@ pub struct blst_p2 {
     y: blst_fp2,
     z: blst_fp2,
 }
+#[repr(C)]
+#[derive(Debug, Copy, Clone, Hash, PartialEq, Eq)]
+pub struct blst_fp6 {
+    fp2: [blst_fp2; 3usize],
+}
 pub type fr_t = blst_fr;
 pub type g1_t = blst_p1;
 pub type g2_t = blst_p2;
@@ -81,6 +86,19 @@ pub struct Bytes48 {
 pub struct Blob {
     bytes: [u8; 131072usize],
 }
+#[doc = " A bounded set of the keys of claims that have been verified, safe to use from many threads.\n\n Each key can only be held in one set of `VERIFY_CACHE_WAYS` slots, picked by its low bits. When\n the set is full, the oldest key in it is replaced, so the cache never grows."]
+#[repr(C)]
+#[derive(Debug, Hash, PartialEq, Eq)]
+pub struct VerifyCache {
+    #[doc = " The keys, `num_sets * VERIFY_CACHE_WAYS` entries. An all-zero key marks an empty slot."]
+    keys: *mut Bytes32,
+    #[doc = " The slot in each set that the next insertion replaces, `num_sets` entries."]
+    next_way: *mut u8,
+    #[doc = " The number of sets, a power of two."]
+    num_sets: usize,
+    #[doc = " A spinlock held while the keys are read or written."]
+    lock: ::std::os::raw::c_long,
+}
 #[doc = " Stores the setup and parameters needed for computing KZG proofs."]
 #[repr(C)]
 #[derive(Debug, Hash, PartialEq, Eq)]
@@ -105,6 +123,20 @@ pub struct KZGSettings {
     wbits: usize,
     #[doc = " The scratch size for the fixed-base MSM."]
     scratch_size: usize,
+    #[doc = " Precomputed multiples of the G1 generator for fixed-base multiplication.\n The array contains `FIXED_BASE_TABLE_SIZE` elements."]
+    g1_generator_table: *mut blst_p1_affine,
+    #[doc = " Powers of the inverse coset factors, used to shift cell interpolation polynomials.\n\n Entry `k * FIELD_ELEMENTS_PER_CELL + j` is `h_k^{-j}`, where `h_k` is the coset factor for\n the cell with index `k`.\n The array contains `CELLS_PER_EXT_BLOB * FIELD_ELEMENTS_PER_CELL` elements."]
+    cell_inv_coset_shift_powers: *mut fr_t,
+    #[doc = " The coset factors raised to the cell size, `h_k^{FIELD_ELEMENTS_PER_CELL}`, by cell index.\n The array contains `CELLS_PER_EXT_BLOB` elements."]
+    cell_coset_shift_pows: *mut fr_t,
+    #[doc = " The precomputed table for fixed-base MSM over the first `FIELD_ELEMENTS_PER_CELL` G1 points\n in monomial form, with window size `CELL_MONOMIAL_TABLE_WBITS`."]
+    g1_monomial_cell_table: *mut blst_p1_affine,
+    #[doc = " Prepared Miller loop lines for the G2 generator, or NULL if precompute_cell_g2_lines() has\n not been called.\n The array contains `NUM_G2_LINES` elements."]
+    g2_generator_lines: *mut blst_fp6,
+    #[doc = " Prepared Miller loop lines for `[s^n - h_k^n]`, the G2 side of a single cell proof check,\n where `h_k` is the coset factor for the cell with index `k` and `n` is the cell size. Or NULL\n if precompute_cell_g2_lines() has not been called.\n The array contains `CELLS_PER_EXT_BLOB * NUM_G2_LINES` elements."]
+    cell_g2_lines: *mut blst_fp6,
+    #[doc = " The keys of blob and cell proofs that have been verified, or NULL if enable_verify_cache()\n has not been called."]
+    verify_cache: *mut VerifyCache,
 }
 #[doc = " A single cell for a blob."]
 #[repr(C)]
@@ -139,6 +171,15 @@ unsafe extern "C" {
         proof_bytes: *const Bytes48,
         s: *const KZGSettings,
     ) -> C_KZG_RET;
+    pub fn verify_kzg_proof_batch(
+        ok: *mut bool,
+        commitments_bytes: *const Bytes48,
+        zs_bytes: *const Bytes32,
+        ys_bytes: *const Bytes32,
+        proofs_bytes: *const Bytes48,
+        n: u64,
+        s: *const KZGSettings,
+    ) -> C_KZG_RET;
     pub fn verify_blob_kzg_proof(
         ok: *mut bool,
         blob: *const Blob,
@@ -445,10 +445,20 @@ impl KZGSettings {
             .into_boxed_slice()
             .try_into()
             .unwrap();
+        self.compute_cells_into(blob, &mut cells)?;
+        Ok(cells)
+    }
+
+    /// Like [`Self::compute_cells`], but writes into a caller-owned buffer instead of allocating.
+    pub fn compute_cells_into(
+        &self,
+        blob: &Blob,
+        cells: &mut CellsPerExtBlob,
+    ) -> Result<(), Error> {
         unsafe {
             let res = compute_cells_and_kzg_proofs(cells.as_mut_ptr(), ptr::null_mut(), blob, self);
             if let C_KZG_RET::C_KZG_OK = res {
-                Ok(cells)
+                Ok(())
             } else {
                 Err(Error::CError(res))
             }
@@ -468,11 +478,23 @@ impl KZGSettings {
                 .into_boxed_slice()
                 .try_into()
                 .unwrap();
+        self.compute_cells_and_kzg_proofs_into(blob, &mut cells, &mut proofs)?;
+        Ok((cells, proofs))
+    }
+
+    /// Like [`Self::compute_cells_and_kzg_proofs`], but writes into caller-owned buffers instead
+    /// of allocating.
+    pub fn compute_cells_and_kzg_proofs_into(
+        &self,
+        blob: &Blob,
+        cells: &mut CellsPerExtBlob,
+        proofs: &mut ProofsPerExtBlob,
+    ) -> Result<(), Error> {
         unsafe {
             let res =
                 compute_cells_and_kzg_proofs(cells.as_mut_ptr(), proofs.as_mut_ptr(), blob, self);
             if let C_KZG_RET::C_KZG_OK = res {
-                Ok((cells, proofs))
+                Ok(())
             } else {
                 Err(Error::CError(res))
             }
@@ -484,13 +506,6 @@ impl KZGSettings {
         cell_indices: &[u64],
         cells: &[Cell],
     ) -> Result<(Box<CellsPerExtBlob>, Box<ProofsPerExtBlob>), Error> {
-        if cell_indices.len() != cells.len() {
-            return Err(Error::MismatchLength(format!(
-                "There are {} cell indices and {} cells",
-                cell_indices.len(),
-                cells.len()
-            )));
-        }
         let mut recovered_cells: Box<[Cell; CELLS_PER_EXT_BLOB]> =
             vec![Cell::default(); CELLS_PER_EXT_BLOB]
                 .into_boxed_slice()
@@ -501,6 +516,31 @@ impl KZGSettings {
                 .into_boxed_slice()
                 .try_into()
                 .unwrap();
+        self.recover_cells_and_kzg_proofs_into(
+            cell_indices,
+            cells,
+            &mut recovered_cells,
+            &mut recovered_proofs,
+        )?;
+        Ok((recovered_cells, recovered_proofs))
+    }
+
+    /// Like [`Self::recover_cells_and_kzg_proofs`], but writes into caller-owned buffers instead
+    /// of allocating.
+    pub fn recover_cells_and_kzg_proofs_into(
+        &self,
+        cell_indices: &[u64],
+        cells: &[Cell],
+        recovered_cells: &mut CellsPerExtBlob,
+        recovered_proofs: &mut ProofsPerExtBlob,
+    ) -> Result<(), Error> {
+        if cell_indices.len() != cells.len() {
+            return Err(Error::MismatchLength(format!(
+                "There are {} cell indices and {} cells",
+                cell_indices.len(),
+                cells.len()
+            )));
+        }
         unsafe {
             let res = recover_cells_and_kzg_proofs(
                 recovered_cells.as_mut_ptr(),
@@ -511,7 +551,7 @@ impl KZGSettings {
                 self,
             );
             if let C_KZG_RET::C_KZG_OK = res {
-                Ok((recovered_cells, recovered_proofs))
+                Ok(())
             } else {
                 Err(Error::CError(res))
             }
@@ -572,6 +612,88 @@ impl Drop for KZGSettings {
     }
 }
 
+/// Batch methods which spread independent per-blob work over the rayon thread pool.
+#[cfg(feature = "parallel")]
+impl KZGSettings {
+    /// Computes the commitment for each blob, in parallel.
+    pub fn blob_to_kzg_commitments_par(&self, blobs: &[Blob]) -> Result<Vec<KZGCommitment>, Error> {
+        use rayon::prelude::*;
+        blobs
+            .par_iter()
+            .map(|blob| self.blob_to_kzg_commitment(blob))
+            .collect()
+    }
+
+    /// Computes the cells and proofs for each blob, in parallel, writing those of `blobs[i]` into
+    /// `cells[i]` and `proofs[i]`.
+    pub fn compute_cells_and_kzg_proofs_par_into(
+        &self,
+        blobs: &[Blob],
+        cells: &mut [CellsPerExtBlob],
+        proofs: &mut [ProofsPerExtBlob],
+    ) -> Result<(), Error> {
+        use rayon::prelude::*;
+        if blobs.len() != cells.len() || blobs.len() != proofs.len() {
+            return Err(Error::MismatchLength(format!(
+                "There are {} blobs, {} cell rows and {} proof rows",
+                blobs.len(),
+                cells.len(),
+                proofs.len()
+            )));
+        }
+        blobs
+            .par_iter()
+            .zip(cells.par_iter_mut())
+            .zip(proofs.par_iter_mut())
+            .try_for_each(|((blob, cells), proofs)| {
+                self.compute_cells_and_kzg_proofs_into(blob, cells, proofs)
+            })
+    }
+
+    /// Recovers the cells and proofs of several blobs, in parallel. Blob `i` is recovered from
+    /// `cell_indices[i]` and `cells[i]` into `recovered_cells[i]` and `recovered_proofs[i]`.
+    pub fn recover_cells_and_kzg_proofs_par_into<I, C>(
+        &self,
+        cell_indices: &[I],
+        cells: &[C],
+        recovered_cells: &mut [CellsPerExtBlob],
+        recovered_proofs: &mut [ProofsPerExtBlob],
+    ) -> Result<(), Error>
+    where
+        I: AsRef<[u64]> + Sync,
+        C: AsRef<[Cell]> + Sync,
+    {
+        use rayon::prelude::*;
+        if cell_indices.len() != cells.len()
+            || cells.len() != recovered_cells.len()
+            || cells.len() != recovered_proofs.len()
+        {
+            return Err(Error::MismatchLength(format!(
+                "There are {} cell index sets, {} cell sets, {} cell rows and {} proof rows",
+                cell_indices.len(),
+                cells.len(),
+                recovered_cells.len(),
+                recovered_proofs.len()
+            )));
+        }
+        cell_indices
+            .par_iter()
+            .zip(cells.par_iter())
+            .zip(recovered_cells.par_iter_mut())
+            .zip(recovered_proofs.par_iter_mut())
+            .try_for_each(
+                |(((cell_indices, cells), recovered_cells), recovered_proofs)| {
+                    self.recover_cells_and_kzg_proofs_into(
+                        cell_indices.as_ref(),
+                        cells.as_ref(),
+                        recovered_cells,
+                        recovered_proofs,
+                    )
+                },
+            )
+    }
+}
+
 impl Blob {
     /// Creates a new blob from a byte array.
     pub const fn new(bytes: [u8; BYTES_PER_BLOB]) -> Self {
@@ -908,10 +1030,19 @@ impl arbitrary::Arbitrary<'_> for Cell {
 }
 
 /// Safety: The memory for `roots_of_unity` and `g1_values` and `g2_values` are only freed on
-/// calling `free_trusted_setup` which only happens when we drop the struct.
+/// calling `free_trusted_setup` which only happens when we drop the struct. After loading, the C
+/// library only reads the settings, except for the optional verified-proof cache, which it guards
+/// with its own lock. So a `&KZGSettings` can be shared between threads, e.g. with the methods
+/// behind the `parallel` feature.
 unsafe impl Sync for KZGSettings {}
 unsafe impl Send for KZGSettings {}
 
+// Fail the build if the settings ever stop being shareable across threads.
+const _: () = {
+    const fn assert_send_sync<T: Send + Sync>() {}
+    assert_send_sync::<KZGSettings>();
+};
+
 #[cfg(test)]
 #[allow(unused_imports, dead_code)]
 mod tests {
@@ -1491,4 +1622,116 @@ mod tests {
             }
         }
     }
+
+    #[test]
+    fn test_into_variants() {
+        let mut rng = rand::rng();
+        let trusted_setup_file = Path::new("src/trusted_setup.txt");
+        assert!(trusted_setup_file.exists());
+        let kzg_settings = KZGSettings::load_trusted_setup_file(trusted_setup_file, 0).unwrap();
+        let blob = generate_random_blob(&mut rng);
+        let (expected_cells, expected_proofs) =
+            kzg_settings.compute_cells_and_kzg_proofs(&blob).unwrap();
+
+        // The same buffers are reused for every call
+        let mut cells: Box<CellsPerExtBlob> = vec![Cell::default(); CELLS_PER_EXT_BLOB]
+            .into_boxed_slice()
+            .try_into()
+            .unwrap();
+        let mut proofs: Box<ProofsPerExtBlob> = vec![KZGProof::default(); CELLS_PER_EXT_BLOB]
+            .into_boxed_slice()
+            .try_into()
+            .unwrap();
+
+        kzg_settings
+            .compute_cells_and_kzg_proofs_into(&blob, &mut cells, &mut proofs)
+            .unwrap();
+        assert_eq!(cells, expected_cells);
+        assert!(proofs
+            .iter()
+            .zip(expected_proofs.iter())
+            .all(|(a, b)| a.to_bytes() == b.to_bytes()));
+
+        cells.fill(Cell::default());
+        kzg_settings.compute_cells_into(&blob, &mut cells).unwrap();
+        assert_eq!(cells, expected_cells);
+
+        let cell_indices: Vec<u64> = (0..CELLS_PER_EXT_BLOB as u64 / 2).collect();
+        cells.fill(Cell::default());
+        proofs.fill(KZGProof::default());
+        kzg_settings
+            .recover_cells_and_kzg_proofs_into(
+                &cell_indices,
+                &expected_cells[..CELLS_PER_EXT_BLOB / 2],
+                &mut cells,
+                &mut proofs,
+            )
+            .unwrap();
+        assert_eq!(cells, expected_cells);
+        assert!(proofs
+            .iter()
+            .zip(expected_proofs.iter())
+            .all(|(a, b)| a.to_bytes() == b.to_bytes()));
+    }
+
+    #[cfg(feature = "parallel")]
+    #[test]
+    fn test_parallel_batches() {
+        let mut rng = rand::rng();
+        let trusted_setup_file = Path::new("src/trusted_setup.txt");
+        assert!(trusted_setup_file.exists());
+        let kzg_settings = KZGSettings::load_trusted_setup_file(trusted_setup_file, 0).unwrap();
+        let num_blobs = 4;
+        let blobs: Vec<Blob> = (0..num_blobs)
+            .map(|_| generate_random_blob(&mut rng))
+            .collect();
+
+        let commitments = kzg_settings.blob_to_kzg_commitments_par(&blobs).unwrap();
+        let mut cells = vec![[Cell::default(); CELLS_PER_EXT_BLOB]; num_blobs];
+        let mut proofs = vec![[KZGProof::default(); CELLS_PER_EXT_BLOB]; num_blobs];
+        kzg_settings
+            .compute_cells_and_kzg_proofs_par_into(&blobs, &mut cells, &mut proofs)
+            .unwrap();
+
+        for (i, blob) in blobs.iter().enumerate() {
+            let commitment = kzg_settings.blob_to_kzg_commitment(blob).unwrap();
+            assert_eq!(commitments[i].to_bytes(), commitment.to_bytes());
+            let (expected_cells, _) = kzg_settings.compute_cells_and_kzg_proofs(blob).unwrap();
+            assert_eq!(cells[i], *expected_cells);
+        }
+
+        // Recover each blob from a different half of its cells
+        let cell_indices: Vec<Vec<u64>> = (0..num_blobs)
+            .map(|i| {
+                (0..CELLS_PER_EXT_BLOB as u64 / 2)
+                    .map(|j| j * 2 + (i as u64 % 2))
+                    .collect()
+            })
+            .collect();
+        let partial_cells: Vec<Vec<Cell>> = cell_indices
+            .iter()
+            .zip(cells.iter())
+            .map(|(indices, row)| indices.iter().map(|&j| row[j as usize]).collect())
+            .collect();
+        let mut recovered_cells = vec![[Cell::default(); CELLS_PER_EXT_BLOB]; num_blobs];
+        let mut recovered_proofs = vec![[KZGProof::default(); CELLS_PER_EXT_BLOB]; num_blobs];
+        kzg_settings
+            .recover_cells_and_kzg_proofs_par_into(
+                &cell_indices,
+                &partial_cells,
+                &mut recovered_cells,
+                &mut recovered_proofs,
+            )
+            .unwrap();
+        assert_eq!(recovered_cells, cells);
+
+        assert!(matches!(
+            kzg_settings.compute_cells_and_kzg_proofs_par_into(
+                &blobs,
+                &mut cells[1..],
+                &mut proofs
+            ),
+            Err(Error::MismatchLength(_))
+        ));
+    }
 }
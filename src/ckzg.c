@@ -16,6 +16,7 @@
 
 #include "common/alloc.c"
 #include "common/bytes.c"
+#include "common/cache.c"
 #include "common/ec.c"
 #include "common/fr.c"
 #include "common/lincomb.c"
@@ -0,0 +1,729 @@
+/*
+ * Copyright 2024 Benjamin Edgington
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * A header-only C++20 wrapper for the library.
+ *
+ * Inputs and outputs are spans over the C types, so nothing is copied on the way in or out.
+ * Errors are returned as values, with std::expected when it is available. The batch helpers take
+ * either an executor (see ckzg::Executor) or a standard execution policy.
+ */
+
+#pragma once
+
+#include "ckzg.h"
+
+#include <version>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#if defined(__cpp_lib_expected) && __cpp_lib_expected >= 202202L
+#include <expected>
+#define CKZG_HAS_STD_EXPECTED 1
+#endif
+
+#ifdef __cpp_lib_execution
+#include <execution>
+#endif
+
+namespace ckzg {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Errors
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/** The ways a call can fail, with the same values as C_KZG_RET. */
+enum class Error : int {
+    BadArgs = C_KZG_BADARGS, /**< The supplied data is invalid in some way. */
+    Internal = C_KZG_ERROR,  /**< Internal error - this should never occur. */
+    Malloc = C_KZG_MALLOC,   /**< Could not allocate memory. */
+};
+
+constexpr const char *to_string(Error error) noexcept {
+    switch (error) {
+    case Error::BadArgs:
+        return "bad arguments";
+    case Error::Internal:
+        return "internal error";
+    case Error::Malloc:
+        return "could not allocate memory";
+    }
+    return "unknown error";
+}
+
+#ifdef CKZG_HAS_STD_EXPECTED
+
+template <class T> using Result = std::expected<T, Error>;
+using Unexpected = std::unexpected<Error>;
+
+#else
+
+/** A stand-in for std::unexpected<Error>, for standard libraries without <expected>. */
+class Unexpected {
+  public:
+    constexpr explicit Unexpected(Error error) noexcept : error_(error) {}
+    constexpr Error error() const noexcept {
+        return error_;
+    }
+
+  private:
+    Error error_;
+};
+
+/** Thrown by Result::value() when it holds an error, like std::bad_expected_access. */
+class BadResultAccess : public std::exception {
+  public:
+    explicit BadResultAccess(Error error) noexcept : error_(error) {}
+    const char *what() const noexcept override {
+        return to_string(error_);
+    }
+    Error error() const noexcept {
+        return error_;
+    }
+
+  private:
+    Error error_;
+};
+
+/** A stand-in for std::expected<T, Error>, covering the subset of it this header uses. */
+template <class T> class [[nodiscard]] Result {
+  public:
+    Result(T value) : v_(std::in_place_index<0>, std::move(value)) {}
+    Result(Unexpected unexpected) : v_(std::in_place_index<1>, unexpected.error()) {}
+
+    bool has_value() const noexcept {
+        return v_.index() == 0;
+    }
+    explicit operator bool() const noexcept {
+        return has_value();
+    }
+    Error error() const noexcept {
+        return *std::get_if<1>(&v_);
+    }
+
+    T &value() & {
+        if (!has_value()) throw BadResultAccess(error());
+        return *std::get_if<0>(&v_);
+    }
+    const T &value() const & {
+        if (!has_value()) throw BadResultAccess(error());
+        return *std::get_if<0>(&v_);
+    }
+    T &&value() && {
+        return std::move(value());
+    }
+
+    T &operator*() noexcept {
+        return *std::get_if<0>(&v_);
+    }
+    const T &operator*() const noexcept {
+        return *std::get_if<0>(&v_);
+    }
+    T *operator->() noexcept {
+        return std::get_if<0>(&v_);
+    }
+    const T *operator->() const noexcept {
+        return std::get_if<0>(&v_);
+    }
+
+  private:
+    std::variant<T, Error> v_;
+};
+
+template <> class [[nodiscard]] Result<void> {
+  public:
+    Result() noexcept = default;
+    Result(Unexpected unexpected) noexcept : error_(unexpected.error()) {}
+
+    bool has_value() const noexcept {
+        return !error_.has_value();
+    }
+    explicit operator bool() const noexcept {
+        return has_value();
+    }
+    Error error() const noexcept {
+        return *error_;
+    }
+    void value() const {
+        if (error_) throw BadResultAccess(*error_);
+    }
+
+  private:
+    std::optional<Error> error_;
+};
+
+#endif /* CKZG_HAS_STD_EXPECTED */
+
+/** The result of a call which has no value of its own. */
+using Status = Result<void>;
+
+namespace detail {
+
+inline Status check(C_KZG_RET ret) noexcept {
+    if (ret != C_KZG_OK) return Unexpected(static_cast<Error>(ret));
+    return {};
+}
+
+template <class T> Result<T> check(C_KZG_RET ret, T value) noexcept {
+    if (ret != C_KZG_OK) return Unexpected(static_cast<Error>(ret));
+    return value;
+}
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Settings
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/** A loaded trusted setup, which is freed when it goes out of scope. */
+class Settings {
+  public:
+    /**
+     * Load a trusted setup from a file.
+     *
+     * @param[in]   path        The path of the trusted setup file
+     * @param[in]   precompute  The precompute setting, see load_trusted_setup_file()
+     */
+    static Result<Settings> load_file(const char *path, uint64_t precompute = 0) {
+        std::unique_ptr<KZGSettings, Free> s(new (std::nothrow) KZGSettings{});
+        if (!s) return Unexpected(Error::Malloc);
+
+        FILE *in = std::fopen(path, "r");
+        if (in == nullptr) return Unexpected(Error::BadArgs);
+        C_KZG_RET ret = load_trusted_setup_file(s.get(), in, precompute);
+        std::fclose(in);
+        if (ret != C_KZG_OK) return Unexpected(static_cast<Error>(ret));
+
+        return Settings(std::move(s));
+    }
+
+    /**
+     * Load a trusted setup from its serialized points.
+     *
+     * @param[in]   g1_monomial The G1 points in monomial form
+     * @param[in]   g1_lagrange The G1 points in Lagrange form
+     * @param[in]   g2_monomial The G2 points in monomial form
+     * @param[in]   precompute  The precompute setting, see load_trusted_setup()
+     */
+    static Result<Settings> load(
+        std::span<const uint8_t> g1_monomial,
+        std::span<const uint8_t> g1_lagrange,
+        std::span<const uint8_t> g2_monomial,
+        uint64_t precompute = 0
+    ) {
+        std::unique_ptr<KZGSettings, Free> s(new (std::nothrow) KZGSettings{});
+        if (!s) return Unexpected(Error::Malloc);
+
+        C_KZG_RET ret = load_trusted_setup(
+            s.get(),
+            g1_monomial.data(),
+            g1_monomial.size(),
+            g1_lagrange.data(),
+            g1_lagrange.size(),
+            g2_monomial.data(),
+            g2_monomial.size(),
+            precompute
+        );
+        if (ret != C_KZG_OK) return Unexpected(static_cast<Error>(ret));
+
+        return Settings(std::move(s));
+    }
+
+    /** See enable_verify_cache(). This must not be called while the settings are in use. */
+    Status enable_verify_cache(size_t capacity) noexcept {
+        return detail::check(::enable_verify_cache(s_.get(), capacity));
+    }
+
+    /** See precompute_cell_g2_lines(). This must not be called while the settings are in use. */
+    Status precompute_cell_g2_lines() noexcept {
+        return detail::check(::precompute_cell_g2_lines(s_.get()));
+    }
+
+    /** The underlying settings, for calling the C API directly. */
+    const KZGSettings *get() const noexcept {
+        return s_.get();
+    }
+
+  private:
+    struct Free {
+        void operator()(KZGSettings *s) const noexcept {
+            free_trusted_setup(s);
+            delete s;
+        }
+    };
+
+    explicit Settings(std::unique_ptr<KZGSettings, Free> s) noexcept : s_(std::move(s)) {}
+
+    std::unique_ptr<KZGSettings, Free> s_;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Views
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * View a byte buffer as an array of blobs, cells or 48-byte values, without copying it.
+ *
+ * This fails with Error::BadArgs if the buffer is not a whole number of elements.
+ */
+template <class T>
+    requires std::is_same_v<T, Blob> || std::is_same_v<T, Cell> || std::is_same_v<T, Bytes48>
+Result<std::span<const T>> as(std::span<const uint8_t> bytes) noexcept {
+    static_assert(alignof(T) == 1 && std::is_trivially_copyable_v<T>);
+    if (bytes.size() % sizeof(T) != 0) return Unexpected(Error::BadArgs);
+    return std::span<const T>(reinterpret_cast<const T *>(bytes.data()), bytes.size() / sizeof(T));
+}
+
+/** A data column: one cell per blob at the same cell index, as in a data column sidecar. */
+struct Column {
+    uint64_t index;
+    std::span<const Bytes48> commitments;
+    std::span<const Cell> cells;
+    std::span<const Bytes48> proofs;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Single calls
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline Result<KZGCommitment> blob_to_kzg_commitment(const Blob &blob, const Settings &s) noexcept {
+    KZGCommitment out;
+    return detail::check(::blob_to_kzg_commitment(&out, &blob, s.get()), out);
+}
+
+inline Result<KZGProof> compute_blob_kzg_proof(
+    const Blob &blob, const Bytes48 &commitment, const Settings &s
+) noexcept {
+    KZGProof out;
+    return detail::check(::compute_blob_kzg_proof(&out, &blob, &commitment, s.get()), out);
+}
+
+inline Result<bool> verify_blob_kzg_proof(
+    const Blob &blob, const Bytes48 &commitment, const Bytes48 &proof, const Settings &s
+) noexcept {
+    bool ok;
+    return detail::check(::verify_blob_kzg_proof(&ok, &blob, &commitment, &proof, s.get()), ok);
+}
+
+inline Result<bool> verify_blob_kzg_proof_batch(
+    std::span<const Blob> blobs,
+    std::span<const Bytes48> commitments,
+    std::span<const Bytes48> proofs,
+    const Settings &s
+) noexcept {
+    if (commitments.size() != blobs.size() || proofs.size() != blobs.size()) {
+        return Unexpected(Error::BadArgs);
+    }
+    bool ok;
+    C_KZG_RET ret = ::verify_blob_kzg_proof_batch(
+        &ok, blobs.data(), commitments.data(), proofs.data(), blobs.size(), s.get()
+    );
+    return detail::check(ret, ok);
+}
+
+inline Status compute_cells(
+    std::span<Cell, CELLS_PER_EXT_BLOB> cells, const Blob &blob, const Settings &s
+) noexcept {
+    return detail::check(::compute_cells_and_kzg_proofs(cells.data(), nullptr, &blob, s.get()));
+}
+
+inline Status compute_cells_and_kzg_proofs(
+    std::span<Cell, CELLS_PER_EXT_BLOB> cells,
+    std::span<KZGProof, CELLS_PER_EXT_BLOB> proofs,
+    const Blob &blob,
+    const Settings &s
+) noexcept {
+    C_KZG_RET ret = ::compute_cells_and_kzg_proofs(cells.data(), proofs.data(), &blob, s.get());
+    return detail::check(ret);
+}
+
+inline Status recover_cells_and_kzg_proofs(
+    std::span<Cell, CELLS_PER_EXT_BLOB> recovered_cells,
+    std::span<KZGProof, CELLS_PER_EXT_BLOB> recovered_proofs,
+    std::span<const uint64_t> cell_indices,
+    std::span<const Cell> cells,
+    const Settings &s
+) noexcept {
+    if (cell_indices.size() != cells.size()) return Unexpected(Error::BadArgs);
+    C_KZG_RET ret = ::recover_cells_and_kzg_proofs(
+        recovered_cells.data(),
+        recovered_proofs.data(),
+        cell_indices.data(),
+        cells.data(),
+        cells.size(),
+        s.get()
+    );
+    return detail::check(ret);
+}
+
+inline Result<bool> verify_cell_kzg_proof_batch(
+    std::span<const Bytes48> commitments,
+    std::span<const uint64_t> cell_indices,
+    std::span<const Cell> cells,
+    std::span<const Bytes48> proofs,
+    const Settings &s
+) noexcept {
+    if (commitments.size() != cells.size() || cell_indices.size() != cells.size() ||
+        proofs.size() != cells.size()) {
+        return Unexpected(Error::BadArgs);
+    }
+    bool ok;
+    C_KZG_RET ret = ::verify_cell_kzg_proof_batch(
+        &ok,
+        commitments.data(),
+        cell_indices.data(),
+        cells.data(),
+        proofs.data(),
+        cells.size(),
+        s.get()
+    );
+    return detail::check(ret, ok);
+}
+
+inline Result<bool> verify_column(const Column &column, const Settings &s) noexcept {
+    if (column.commitments.size() != column.cells.size() ||
+        column.proofs.size() != column.cells.size()) {
+        return Unexpected(Error::BadArgs);
+    }
+    bool ok;
+    C_KZG_RET ret = ::verify_data_column_kzg_proofs(
+        &ok,
+        column.index,
+        column.commitments.data(),
+        column.cells.data(),
+        column.proofs.data(),
+        column.cells.size(),
+        s.get()
+    );
+    return detail::check(ret, ok);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Executors
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Something that can run a batch: `ex.bulk(n, f)` calls `f(i)` once for each `i` in `[0, n)`, in
+ * any order and on any threads, and returns once every call has returned. The calls never throw.
+ */
+template <class E>
+concept Executor = requires(const E &ex, size_t n, void (*f)(size_t)) { ex.bulk(n, f); };
+
+/** Runs a batch on the calling thread. */
+struct InlineExecutor {
+    template <class F> void bulk(size_t n, F &&f) const {
+        for (size_t i = 0; i < n; i++) {
+            f(i);
+        }
+    }
+};
+
+/**
+ * Runs a batch on the calling thread plus up to `num_threads - 1` threads started for it.
+ *
+ * Threads are started per batch, which is cheap next to the work in a batch of blobs or columns.
+ * Use an executor backed by an existing pool to share threads with the rest of the application.
+ */
+class ThreadExecutor {
+  public:
+    explicit ThreadExecutor(unsigned num_threads = std::thread::hardware_concurrency()) noexcept
+        : num_threads_(std::max(num_threads, 1u)) {}
+
+    template <class F> void bulk(size_t n, F &&f) const {
+        std::atomic<size_t> next{0};
+        auto work = [&] {
+            for (size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < n;) {
+                f(i);
+            }
+        };
+
+        std::vector<std::jthread> threads;
+        size_t num_workers = std::min<size_t>(num_threads_, n);
+        if (num_workers > 1) {
+            try {
+                threads.reserve(num_workers - 1);
+                for (size_t t = 1; t < num_workers; t++) {
+                    threads.emplace_back(work);
+                }
+            } catch (const std::system_error &) {
+                /* Carry on with the threads that did start */
+            } catch (const std::bad_alloc &) {
+            }
+        }
+        work();
+    }
+
+  private:
+    unsigned num_threads_;
+};
+
+#ifdef __cpp_lib_execution
+template <class P>
+concept ExecutionPolicy = std::is_execution_policy_v<std::remove_cvref_t<P>>;
+#else
+template <class P>
+concept ExecutionPolicy = false;
+#endif
+
+/** Either an Executor or one of the std::execution policies. */
+template <class E>
+concept ExecutorOrPolicy = Executor<std::remove_cvref_t<E>> || ExecutionPolicy<E>;
+
+namespace detail {
+
+/**
+ * Scratch for the batch helpers. There is one per thread, and its buffers keep their capacity
+ * between batches, so once they have grown to the batch size the helpers stop allocating.
+ */
+struct Workspace {
+    std::vector<size_t> indices;
+    std::vector<Cell> cells;
+    std::vector<Bytes48> proofs;
+};
+
+inline Workspace &workspace() noexcept {
+    thread_local Workspace ws;
+    return ws;
+}
+
+/** Grow a workspace buffer to at least `n` elements, without shrinking it. */
+template <class T> bool reserve(std::vector<T> &buffer, size_t n) noexcept {
+    try {
+        if (buffer.size() < n) buffer.resize(n);
+        return true;
+    } catch (const std::bad_alloc &) {
+        return false;
+    } catch (const std::length_error &) {
+        return false;
+    }
+}
+
+/** Records the first error of a batch, from whichever thread hits it. */
+class FirstError {
+  public:
+    void record(C_KZG_RET ret) noexcept {
+        int expected = C_KZG_OK;
+        if (ret != C_KZG_OK) ret_.compare_exchange_strong(expected, ret, std::memory_order_relaxed);
+    }
+    bool failed() const noexcept {
+        return ret_.load(std::memory_order_relaxed) != C_KZG_OK;
+    }
+    Status status() const noexcept {
+        return check(static_cast<C_KZG_RET>(ret_.load(std::memory_order_relaxed)));
+    }
+
+  private:
+    std::atomic<int> ret_{C_KZG_OK};
+};
+
+/** Run `f(i)` for each `i` in `[0, n)` with an executor or execution policy. */
+template <class E, class F> Status bulk(E &&exec, size_t n, F &&f) noexcept {
+    if (n == 0) return {};
+#ifdef __cpp_lib_execution
+    if constexpr (ExecutionPolicy<E>) {
+        /* The algorithms need something to iterate over, so use a range of the indices */
+        std::vector<size_t> &indices = workspace().indices;
+        size_t filled = indices.size();
+        if (!reserve(indices, n)) return Unexpected(Error::Malloc);
+        for (size_t i = filled; i < n; i++) {
+            indices[i] = i;
+        }
+        try {
+            std::for_each(std::forward<E>(exec), indices.begin(), indices.begin() + n, f);
+        } catch (const std::bad_alloc &) {
+            return Unexpected(Error::Malloc);
+        }
+        return {};
+    } else
+#endif
+    {
+        try {
+            exec.bulk(n, f);
+        } catch (const std::bad_alloc &) {
+            return Unexpected(Error::Malloc);
+        }
+        return {};
+    }
+}
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Batches
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Compute the commitments for a batch of blobs.
+ *
+ * @param[in]   exec        The executor or execution policy to run the batch with
+ * @param[out]  commitments The commitments, length `blobs.size()`
+ * @param[in]   blobs       The blobs to commit to
+ * @param[in]   s           The trusted setup
+ */
+template <ExecutorOrPolicy E>
+Status commit_all(
+    E &&exec, std::span<KZGCommitment> commitments, std::span<const Blob> blobs, const Settings &s
+) noexcept {
+    if (commitments.size() != blobs.size()) return Unexpected(Error::BadArgs);
+
+    detail::FirstError error;
+    Status status = detail::bulk(std::forward<E>(exec), blobs.size(), [&](size_t i) {
+        if (error.failed()) return;
+        error.record(::blob_to_kzg_commitment(&commitments[i], &blobs[i], s.get()));
+    });
+    if (!status) return status;
+    return error.status();
+}
+
+/**
+ * Compute the cells, and optionally the proofs, for a batch of blobs.
+ *
+ * @param[in]   exec    The executor or execution policy to run the batch with
+ * @param[out]  cells   The cells, length `blobs.size() * CELLS_PER_EXT_BLOB`, blob-major
+ * @param[out]  proofs  The proofs, laid out like the cells, or empty to skip computing them
+ * @param[in]   blobs   The blobs to compute cells for
+ * @param[in]   s       The trusted setup
+ */
+template <ExecutorOrPolicy E>
+Status compute_cells_all(
+    E &&exec,
+    std::span<Cell> cells,
+    std::span<KZGProof> proofs,
+    std::span<const Blob> blobs,
+    const Settings &s
+) noexcept {
+    if (cells.size() != blobs.size() * CELLS_PER_EXT_BLOB) return Unexpected(Error::BadArgs);
+    if (!proofs.empty() && proofs.size() != cells.size()) return Unexpected(Error::BadArgs);
+
+    detail::FirstError error;
+    Status status = detail::bulk(std::forward<E>(exec), blobs.size(), [&](size_t i) {
+        if (error.failed()) return;
+        KZGProof *blob_proofs = proofs.empty() ? nullptr : &proofs[i * CELLS_PER_EXT_BLOB];
+        error.record(::compute_cells_and_kzg_proofs(
+            &cells[i * CELLS_PER_EXT_BLOB], blob_proofs, &blobs[i], s.get()
+        ));
+    });
+    if (!status) return status;
+    return error.status();
+}
+
+/**
+ * Verify a batch of data columns, each with verify_data_column_kzg_proofs().
+ *
+ * @param[in]   exec    The executor or execution policy to run the batch with
+ * @param[out]  ok      Whether each column is valid, length `columns.size()`
+ * @param[in]   columns The columns to verify
+ * @param[in]   s       The trusted setup
+ */
+template <ExecutorOrPolicy E>
+Status verify_columns(
+    E &&exec, std::span<bool> ok, std::span<const Column> columns, const Settings &s
+) noexcept {
+    if (ok.size() != columns.size()) return Unexpected(Error::BadArgs);
+
+    detail::FirstError error;
+    Status status = detail::bulk(std::forward<E>(exec), columns.size(), [&](size_t i) {
+        if (error.failed()) return;
+        Result<bool> result = verify_column(columns[i], s);
+        if (!result) {
+            error.record(static_cast<C_KZG_RET>(result.error()));
+            return;
+        }
+        ok[i] = *result;
+    });
+    if (!status) return status;
+    return error.status();
+}
+
+/**
+ * Verify columns of an extended blob matrix, such as the output of compute_cells_all().
+ *
+ * Each column is gathered from the rows into the verifying thread's workspace and checked with
+ * verify_data_column_kzg_proofs().
+ *
+ * @param[in]   exec            The executor or execution policy to run the batch with
+ * @param[out]  ok              Whether each column is valid, length `column_indices.size()`
+ * @param[in]   column_indices  The columns to verify
+ * @param[in]   commitments     The commitments, one per row
+ * @param[in]   cells           The cells, length `commitments.size() * CELLS_PER_EXT_BLOB`
+ * @param[in]   proofs          The proofs, laid out like the cells
+ * @param[in]   s               The trusted setup
+ */
+template <ExecutorOrPolicy E>
+Status verify_columns(
+    E &&exec,
+    std::span<bool> ok,
+    std::span<const uint64_t> column_indices,
+    std::span<const Bytes48> commitments,
+    std::span<const Cell> cells,
+    std::span<const Bytes48> proofs,
+    const Settings &s
+) noexcept {
+    size_t num_rows = commitments.size();
+    if (ok.size() != column_indices.size()) return Unexpected(Error::BadArgs);
+    if (cells.size() != num_rows * CELLS_PER_EXT_BLOB) return Unexpected(Error::BadArgs);
+    if (proofs.size() != cells.size()) return Unexpected(Error::BadArgs);
+    for (uint64_t index : column_indices) {
+        if (index >= CELLS_PER_EXT_BLOB) return Unexpected(Error::BadArgs);
+    }
+
+    detail::FirstError error;
+    Status status = detail::bulk(std::forward<E>(exec), column_indices.size(), [&](size_t i) {
+        if (error.failed()) return;
+        detail::Workspace &ws = detail::workspace();
+        if (!detail::reserve(ws.cells, num_rows) || !detail::reserve(ws.proofs, num_rows)) {
+            error.record(C_KZG_MALLOC);
+            return;
+        }
+
+        uint64_t index = column_indices[i];
+        for (size_t row = 0; row < num_rows; row++) {
+            ws.cells[row] = cells[row * CELLS_PER_EXT_BLOB + index];
+            ws.proofs[row] = proofs[row * CELLS_PER_EXT_BLOB + index];
+        }
+
+        Column column = {
+            index,
+            commitments,
+            std::span<const Cell>(ws.cells.data(), num_rows),
+            std::span<const Bytes48>(ws.proofs.data(), num_rows),
+        };
+        Result<bool> result = verify_column(column, s);
+        if (!result) {
+            error.record(static_cast<C_KZG_RET>(result.error()));
+            return;
+        }
+        ok[i] = *result;
+    });
+    if (!status) return status;
+    return error.status();
+}
+
+} // namespace ckzg
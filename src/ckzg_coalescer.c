@@ -0,0 +1,506 @@
+/*
+ * Copyright 2024 Benjamin Edgington
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ckzg_coalescer.h"
+#include "common/alloc.h"
+#include "common/bytes.h"
+
+#include <errno.h>   /* For ETIMEDOUT */
+#include <pthread.h> /* For pthread_* */
+#include <string.h>  /* For memcpy */
+#include <time.h>    /* For clock_gettime */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Macros
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/** The clock batch deadlines are measured with. macOS can only wait on the realtime clock. */
+#ifdef __APPLE__
+#define COALESCER_CLOCK CLOCK_REALTIME
+#else
+#define COALESCER_CLOCK CLOCK_MONOTONIC
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Types
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * A verification call waiting in a batch. It lives on the caller's stack until it is done.
+ *
+ * The caller decodes its inputs before joining a batch, so that every node of the batch's
+ * bisection only has to weight them again.
+ */
+typedef struct CoalescerRequest {
+    /** The decoded commitments, one for a blob request and `num_cells` for a cell request. */
+    g1_t *commitments;
+    /** The decoded proofs, one for a blob request and `num_cells` for a cell request. */
+    g1_t *proofs;
+    /** The cell indices, length `num_cells`. */
+    const uint64_t *cell_indices;
+    /** The field elements of the cells, length `num_cells * FIELD_ELEMENTS_PER_CELL`. */
+    fr_t *cells_fr;
+    /** The evaluation challenge of a blob request. */
+    fr_t z;
+    /** The blob's evaluation at `z`. */
+    fr_t y;
+    /** The number of cells in a cell request, or zero for a blob request. */
+    uint64_t num_cells;
+    /** Where the caller wants the result. */
+    bool *ok;
+    /** The next request in the same batch. */
+    struct CoalescerRequest *next;
+    /** The result of the request, which stays `C_KZG_OK` unless it cannot be verified. */
+    C_KZG_RET ret;
+    /** Nonzero once the request's batch has been verified. */
+    int done;
+} CoalescerRequest;
+
+struct KZGCoalescer {
+    /** The trusted setup. */
+    const KZGSettings *s;
+    /** The secret seed that each batch's weights are derived from. */
+    Bytes32 seed;
+    /** The number of proofs at which a batch is verified without waiting any longer. */
+    uint64_t max_batch_proofs;
+    /** The longest the first call of a batch waits for others to join it. */
+    uint64_t max_delay_us;
+    /** The number of batches taken so far, so that every batch derives different weights. */
+    uint64_t num_batches;
+    /** The oldest request of the open batch. */
+    CoalescerRequest *pending;
+    /** Where the next request of the open batch is linked in. */
+    CoalescerRequest **pending_tail;
+    /** The number of requests in the open batch. */
+    size_t num_pending;
+    /** The number of proofs in the open batch. */
+    uint64_t num_pending_proofs;
+    /** Guards the open batch and the `done` flags of requests. */
+    pthread_mutex_t lock;
+    /** Signalled when the open batch reaches `max_batch_proofs`. */
+    pthread_cond_t batch_full;
+    /** Signalled when a batch has been verified. */
+    pthread_cond_t batch_done;
+    /** Nonzero if the first call of the open batch is waiting to verify it. */
+    long has_leader;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Derive the seed for one accumulator of a batch.
+ *
+ * Bisection verifies parts of a batch again, each with its own accumulator, so every accumulator
+ * is numbered by its node in the bisection tree (1 for the whole batch, 2n and 2n+1 for the halves
+ * of node n). No two accumulators share weights.
+ *
+ * @param[out]  out             The derived seed
+ * @param[in]   seed            The coalescer's secret seed
+ * @param[in]   batch_number    The number of the batch
+ * @param[in]   node            The node in the batch's bisection tree
+ */
+static void derive_seed(Bytes32 *out, const Bytes32 *seed, uint64_t batch_number, uint64_t node) {
+    uint8_t bytes[sizeof(seed->bytes) + 2 * sizeof(uint64_t)];
+    memcpy(bytes, seed->bytes, sizeof(seed->bytes));
+    bytes_from_uint64(&bytes[sizeof(seed->bytes)], batch_number);
+    bytes_from_uint64(&bytes[sizeof(seed->bytes) + sizeof(uint64_t)], node);
+    blst_sha256(out->bytes, bytes, sizeof(bytes));
+}
+
+/**
+ * Absorb every decoded proof of a request into an accumulator, with the accumulator's weights.
+ *
+ * @param[in,out]   acc The accumulator
+ * @param[in]       r   The request
+ * @param[in]       s   The trusted setup
+ *
+ * @remark If this fails part way through a cell request, its earlier cells stay absorbed.
+ */
+static C_KZG_RET add_request(
+    UnifiedVerifyAccumulator *acc, const CoalescerRequest *r, const KZGSettings *s
+) {
+    C_KZG_RET ret;
+
+    if (r->num_cells == 0) {
+        return unified_verify_accumulator_add_prepared_blob(
+            acc, r->commitments, &r->z, &r->y, r->proofs
+        );
+    }
+
+    for (uint64_t i = 0; i < r->num_cells; i++) {
+        ret = unified_verify_accumulator_add_prepared_cell(
+            acc,
+            &r->commitments[i],
+            r->cell_indices[i],
+            &r->cells_fr[i * FIELD_ELEMENTS_PER_CELL],
+            &r->proofs[i],
+            s
+        );
+        if (ret != C_KZG_OK) return ret;
+    }
+    return C_KZG_OK;
+}
+
+/**
+ * Verify a run of requests as one batch, and bisect it if it fails.
+ *
+ * The requests were decoded before they joined the batch, so each node only weights them afresh.
+ * Requests that cannot be absorbed, which only happens if memory runs out, get that error and are
+ * left out. If the others do not all verify, each half is verified again, down to single
+ * requests, so that only the invalid ones are rejected.
+ *
+ * A request that failed part way through being absorbed can leave some of its cells behind. That
+ * can only make the batch fail, never pass, and its halves are checked without it.
+ *
+ * @param[in]       c               The coalescer
+ * @param[in,out]   first           The first request of the run
+ * @param[in]       count           The number of requests in the run
+ * @param[in]       batch_number    The number of the batch the run belongs to
+ * @param[in]       node            The run's node in the batch's bisection tree
+ */
+static void verify_requests(
+    const KZGCoalescer *c,
+    CoalescerRequest *first,
+    size_t count,
+    uint64_t batch_number,
+    uint64_t node
+) {
+    C_KZG_RET ret;
+    UnifiedVerifyAccumulator acc;
+    Bytes32 seed;
+    CoalescerRequest *r, *last_added = NULL;
+    size_t num_added = 0;
+    bool ok = false;
+
+    derive_seed(&seed, &c->seed, batch_number, node);
+    ret = unified_verify_accumulator_init(&acc, &seed);
+    if (ret != C_KZG_OK) goto fail;
+
+    r = first;
+    for (size_t i = 0; i < count; i++, r = r->next) {
+        if (r->ret != C_KZG_OK) continue;
+        r->ret = add_request(&acc, r, c->s);
+        if (r->ret != C_KZG_OK) continue;
+        last_added = r;
+        num_added++;
+    }
+
+    ret = unified_verify_accumulator_finalize(&ok, &acc, c->s);
+    unified_verify_accumulator_free(&acc);
+    if (ret != C_KZG_OK) goto fail;
+
+    if (ok || num_added == 0) {
+        r = first;
+        for (size_t i = 0; i < count; i++, r = r->next) {
+            if (r->ret == C_KZG_OK) *r->ok = true;
+        }
+        return;
+    }
+
+    /* A lone request that fails is the invalid one */
+    if (num_added == 1) {
+        *last_added->ok = false;
+        return;
+    }
+
+    size_t half = count / 2;
+    CoalescerRequest *second = first;
+    for (size_t i = 0; i < half; i++) {
+        second = second->next;
+    }
+    verify_requests(c, first, half, batch_number, 2 * node);
+    verify_requests(c, second, count - half, batch_number, 2 * node + 1);
+    return;
+
+fail:
+    r = first;
+    for (size_t i = 0; i < count; i++, r = r->next) {
+        if (r->ret == C_KZG_OK) r->ret = ret;
+    }
+}
+
+/**
+ * Get the time `delay_us` microseconds from now, on the clock the coalescer waits with.
+ *
+ * @param[out]  out         The deadline
+ * @param[in]   delay_us    The delay in microseconds
+ */
+static void get_deadline(struct timespec *out, uint64_t delay_us) {
+    clock_gettime(COALESCER_CLOCK, out);
+    uint64_t nsec = (uint64_t)out->tv_nsec + (delay_us % 1000000) * 1000;
+    out->tv_sec += (time_t)(delay_us / 1000000 + nsec / 1000000000);
+    out->tv_nsec = (long)(nsec % 1000000000);
+}
+
+/**
+ * Add a request to the open batch and block until its batch has been verified.
+ *
+ * The first request of a batch leads it: it waits until the batch has `max_batch_proofs` proofs
+ * or `max_delay_us` has passed, then takes the batch, verifies it and wakes the others. Requests
+ * that arrive while it verifies start the next batch, so batches can be verified concurrently.
+ *
+ * @param[out]      ok          The request's result
+ * @param[in,out]   req         The request, with its inputs set
+ * @param[in]       num_proofs  The number of proofs in the request
+ * @param[in]       c           The coalescer
+ */
+static C_KZG_RET submit_request(
+    bool *ok, CoalescerRequest *req, uint64_t num_proofs, KZGCoalescer *c
+) {
+    CoalescerRequest *batch;
+    size_t count;
+    uint64_t batch_number;
+    struct timespec deadline;
+
+    *ok = false;
+    req->ok = ok;
+    req->next = NULL;
+    req->ret = C_KZG_OK;
+    req->done = 0;
+
+    pthread_mutex_lock(&c->lock);
+    *c->pending_tail = req;
+    c->pending_tail = &req->next;
+    c->num_pending++;
+    c->num_pending_proofs += num_proofs;
+
+    if (c->has_leader) {
+        if (c->num_pending_proofs >= c->max_batch_proofs) pthread_cond_signal(&c->batch_full);
+        while (!req->done) {
+            pthread_cond_wait(&c->batch_done, &c->lock);
+        }
+        pthread_mutex_unlock(&c->lock);
+        return req->ret;
+    }
+
+    /* This is the first request of the batch, so it waits for the rest */
+    c->has_leader = 1;
+    get_deadline(&deadline, c->max_delay_us);
+    while (c->num_pending_proofs < c->max_batch_proofs) {
+        if (pthread_cond_timedwait(&c->batch_full, &c->lock, &deadline) == ETIMEDOUT) break;
+    }
+
+    /* Take the batch, and open the next one */
+    batch = c->pending;
+    count = c->num_pending;
+    batch_number = c->num_batches++;
+    c->pending = NULL;
+    c->pending_tail = &c->pending;
+    c->num_pending = 0;
+    c->num_pending_proofs = 0;
+    c->has_leader = 0;
+    pthread_mutex_unlock(&c->lock);
+
+    verify_requests(c, batch, count, batch_number, 1);
+
+    /* The others can return as soon as the lock is released, so only touch them under it */
+    pthread_mutex_lock(&c->lock);
+    for (CoalescerRequest *r = batch; r != NULL; r = r->next) {
+        r->done = 1;
+    }
+    pthread_cond_broadcast(&c->batch_done);
+    pthread_mutex_unlock(&c->lock);
+
+    return req->ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Verify a blob proof, in a batch with any other calls made at about the same time.
+ *
+ * @param[out]  ok                  True if the proof is valid, otherwise false
+ * @param[in]   blob                Blob to verify
+ * @param[in]   commitment_bytes    Commitment to verify
+ * @param[in]   proof_bytes         Proof used for verification
+ * @param[in]   c                   The coalescer
+ *
+ * @remark This gives the same result as verify_blob_kzg_proof().
+ */
+C_KZG_RET kzg_coalescer_verify_blob_kzg_proof(
+    bool *ok,
+    const Blob *blob,
+    const Bytes48 *commitment_bytes,
+    const Bytes48 *proof_bytes,
+    KZGCoalescer *c
+) {
+    C_KZG_RET ret;
+    g1_t commitment, proof;
+    CoalescerRequest req = {
+        .commitments = &commitment,
+        .proofs = &proof,
+    };
+
+    if (ok == NULL || blob == NULL || c == NULL) return C_KZG_BADARGS;
+    *ok = false;
+
+    /* Compute the challenge and evaluation here, so that the batch only has to weight them */
+    ret = prepare_blob_kzg_proof_batch(
+        &commitment, &req.z, &req.y, &proof, blob, commitment_bytes, proof_bytes, 1, c->s
+    );
+    if (ret != C_KZG_OK) return ret;
+
+    return submit_request(ok, &req, 1, c);
+}
+
+/**
+ * Verify a batch of cell proofs, in a batch with any other calls made at about the same time.
+ *
+ * @param[out]  ok                  True if the proofs are valid, otherwise false
+ * @param[in]   commitments_bytes   The commitments for the cells, length `num_cells`
+ * @param[in]   cell_indices        The cell indices for the cells, length `num_cells`
+ * @param[in]   cells               The cells to check, length `num_cells`
+ * @param[in]   proofs_bytes        The proofs for the cells, length `num_cells`
+ * @param[in]   num_cells           The number of cells provided
+ * @param[in]   c                   The coalescer
+ *
+ * @remark This gives the same result as verify_cell_kzg_proof_batch().
+ */
+C_KZG_RET kzg_coalescer_verify_cell_kzg_proof_batch(
+    bool *ok,
+    const Bytes48 *commitments_bytes,
+    const uint64_t *cell_indices,
+    const Cell *cells,
+    const Bytes48 *proofs_bytes,
+    uint64_t num_cells,
+    KZGCoalescer *c
+) {
+    C_KZG_RET ret;
+    CoalescerRequest req = {
+        .cell_indices = cell_indices,
+        .num_cells = num_cells,
+    };
+
+    if (ok == NULL || c == NULL) return C_KZG_BADARGS;
+
+    /* An empty batch is trivially valid, so there is nothing to wait for */
+    if (num_cells == 0) {
+        *ok = true;
+        return C_KZG_OK;
+    }
+
+    *ok = false;
+
+    ret = new_g1_array(&req.commitments, (size_t)num_cells);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_g1_array(&req.proofs, (size_t)num_cells);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_fr_array(&req.cells_fr, (size_t)num_cells * FIELD_ELEMENTS_PER_CELL);
+    if (ret != C_KZG_OK) goto out;
+
+    /* Decode the cells here, so that the batch only has to weight them */
+    for (uint64_t i = 0; i < num_cells; i++) {
+        ret = prepare_cell_kzg_proof(
+            &req.commitments[i],
+            &req.cells_fr[i * FIELD_ELEMENTS_PER_CELL],
+            &req.proofs[i],
+            &commitments_bytes[i],
+            cell_indices[i],
+            &cells[i],
+            &proofs_bytes[i]
+        );
+        if (ret != C_KZG_OK) goto out;
+    }
+
+    ret = submit_request(ok, &req, num_cells, c);
+
+out:
+    c_kzg_free(req.commitments);
+    c_kzg_free(req.proofs);
+    c_kzg_free(req.cells_fr);
+    return ret;
+}
+
+/**
+ * Create a verification coalescer.
+ *
+ * @param[out]  out                 The new coalescer, free afterwards with kzg_coalescer_free()
+ * @param[in]   s                   The trusted setup, which must outlive the coalescer
+ * @param[in]   seed                A secret, uniformly random seed for the batch weights
+ * @param[in]   max_batch_proofs    The number of proofs at which a batch stops waiting for more
+ * @param[in]   max_delay_us        The longest the first call of a batch waits, in microseconds
+ *
+ * @remark Each cell and each blob counts as one proof towards `max_batch_proofs`.
+ * @remark The seed must be kept secret. Anyone who knows it can craft invalid proofs which pass.
+ */
+C_KZG_RET kzg_coalescer_new(
+    KZGCoalescer **out,
+    const KZGSettings *s,
+    const Bytes32 *seed,
+    uint64_t max_batch_proofs,
+    uint64_t max_delay_us
+) {
+    C_KZG_RET ret;
+    KZGCoalescer *c = NULL;
+    pthread_condattr_t attr;
+    bool has_lock = false, has_batch_full = false, has_batch_done = false;
+
+    if (out == NULL || s == NULL || seed == NULL || max_batch_proofs == 0) return C_KZG_BADARGS;
+    *out = NULL;
+
+    ret = c_kzg_calloc((void **)&c, 1, sizeof(KZGCoalescer));
+    if (ret != C_KZG_OK) return ret;
+    c->s = s;
+    c->seed = *seed;
+    c->max_batch_proofs = max_batch_proofs;
+    c->max_delay_us = max_delay_us;
+    c->pending_tail = &c->pending;
+
+    ret = C_KZG_ERROR;
+    if (pthread_condattr_init(&attr) != 0) goto out;
+#ifndef __APPLE__
+    if (pthread_condattr_setclock(&attr, COALESCER_CLOCK) != 0) goto out_attr;
+#endif
+    if (pthread_mutex_init(&c->lock, NULL) != 0) goto out_attr;
+    has_lock = true;
+    if (pthread_cond_init(&c->batch_full, &attr) != 0) goto out_attr;
+    has_batch_full = true;
+    if (pthread_cond_init(&c->batch_done, NULL) != 0) goto out_attr;
+    has_batch_done = true;
+    ret = C_KZG_OK;
+
+out_attr:
+    pthread_condattr_destroy(&attr);
+out:
+    if (ret != C_KZG_OK) {
+        if (has_batch_done) pthread_cond_destroy(&c->batch_done);
+        if (has_batch_full) pthread_cond_destroy(&c->batch_full);
+        if (has_lock) pthread_mutex_destroy(&c->lock);
+        c_kzg_free(c);
+        return ret;
+    }
+    *out = c;
+    return C_KZG_OK;
+}
+
+/**
+ * Free a verification coalescer.
+ *
+ * @param[in]   c   The coalescer to free
+ *
+ * @remark No calls may be in progress on the coalescer.
+ */
+void kzg_coalescer_free(KZGCoalescer *c) {
+    if (c == NULL) return;
+    pthread_cond_destroy(&c->batch_done);
+    pthread_cond_destroy(&c->batch_full);
+    pthread_mutex_destroy(&c->lock);
+    c_kzg_free(c);
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2024 Benjamin Edgington
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * A front end which coalesces concurrent verification calls into shared batches.
+ *
+ * Each call blocks like the function it stands in for. Calls that arrive close together are
+ * verified as one randomized batch, with a single pairing check, and a batch that fails is split
+ * in half until the invalid calls are found. Each call decodes its own inputs before it joins a
+ * batch, so the halves are only weighted again, never decoded again. The first call of a batch
+ * waits at most the configured delay for others to join it, and less if the batch fills up first.
+ *
+ * A call with nothing to join pays the whole delay, so the delay should be a small fraction of the
+ * caller's latency budget. Accepted proofs are not added to the settings' verify cache.
+ */
+
+#pragma once
+
+#include "ckzg.h"
+
+#include <stdbool.h> /* For bool */
+#include <stdint.h>  /* For uint64_t */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Types
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/** A verification coalescer, see kzg_coalescer_new(). */
+typedef struct KZGCoalescer KZGCoalescer;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+C_KZG_RET kzg_coalescer_new(
+    KZGCoalescer **out,
+    const KZGSettings *s,
+    const Bytes32 *seed,
+    uint64_t max_batch_proofs,
+    uint64_t max_delay_us
+);
+
+void kzg_coalescer_free(KZGCoalescer *c);
+
+C_KZG_RET kzg_coalescer_verify_blob_kzg_proof(
+    bool *ok,
+    const Blob *blob,
+    const Bytes48 *commitment_bytes,
+    const Bytes48 *proof_bytes,
+    KZGCoalescer *c
+);
+
+C_KZG_RET kzg_coalescer_verify_cell_kzg_proof_batch(
+    bool *ok,
+    const Bytes48 *commitments_bytes,
+    const uint64_t *cell_indices,
+    const Cell *cells,
+    const Bytes48 *proofs_bytes,
+    uint64_t num_cells,
+    KZGCoalescer *c
+);
+
+#ifdef __cplusplus
+}
+#endif
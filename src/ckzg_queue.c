@@ -0,0 +1,701 @@
+/*
+ * Copyright 2024 Benjamin Edgington
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ckzg_queue.h"
+#include "common/alloc.h"
+
+#include <errno.h>   /* For EINTR */
+#include <fcntl.h>   /* For fcntl */
+#include <pthread.h> /* For pthread_* */
+#include <stdlib.h>  /* For calloc, free */
+#include <unistd.h>  /* For close, read, write */
+
+#ifdef __linux__
+#include <sys/eventfd.h> /* For eventfd */
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Types
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/** A submitted job, with the completion it will produce. */
+typedef struct {
+    /** The completion, whose `ret` is filled in once the job has run. */
+    KZGCompletion completion;
+    /** The arguments for the job's function, picked by `completion.type`. */
+    union {
+        struct {
+            KZGCommitment *out;
+            const Blob *blob;
+        } commit;
+        struct {
+            Cell *cells;
+            KZGProof *proofs;
+            const Blob *blob;
+        } compute_cells;
+        struct {
+            Cell *recovered_cells;
+            KZGProof *recovered_proofs;
+            const uint64_t *cell_indices;
+            const Cell *cells;
+            uint64_t num_cells;
+        } recover;
+        struct {
+            bool *ok;
+            const Blob *blobs;
+            const Bytes48 *commitments_bytes;
+            const Bytes48 *proofs_bytes;
+            uint64_t n;
+        } verify_blobs;
+        struct {
+            bool *ok;
+            const Bytes48 *commitments_bytes;
+            const uint64_t *cell_indices;
+            const Cell *cells;
+            const Bytes48 *proofs_bytes;
+            uint64_t num_cells;
+        } verify_cells;
+    } args;
+} QueueJob;
+
+struct KZGQueue {
+    /** The trusted setup every job runs with. */
+    const KZGSettings *s;
+    /** The completion callback, or NULL to queue completions instead. */
+    KZGQueueCallback callback;
+    /** The context passed to `callback`. */
+    void *callback_ctx;
+    /** The worker threads. */
+    pthread_t *threads;
+    /** The number of worker threads that were started. */
+    size_t num_threads;
+    /** The submitted jobs not yet picked up by a worker, a ring of `capacity` entries. */
+    QueueJob *jobs;
+    /** The completions not yet reaped, a ring of `capacity` entries. */
+    KZGCompletion *completions;
+    /** The most jobs that can be in flight at once. */
+    size_t capacity;
+    /** The index of the oldest entry in `jobs`. */
+    size_t jobs_head;
+    /** The number of entries in `jobs`. */
+    size_t num_jobs;
+    /** The index of the oldest entry in `completions`. */
+    size_t completions_head;
+    /** The number of entries in `completions`. */
+    size_t num_completions;
+    /** The number of jobs submitted whose completions have not been delivered yet. */
+    size_t num_in_flight;
+    /** Guards everything below the settings and callback. */
+    pthread_mutex_t lock;
+    /** Signalled when a job is submitted or the queue is stopping. */
+    pthread_cond_t job_ready;
+    /** Signalled when a completion is delivered. */
+    pthread_cond_t completion_ready;
+    /** Signalled when a job stops being in flight, so that a blocked submission can proceed. */
+    pthread_cond_t slot_free;
+    /** The read and write ends of the completion signal. With an eventfd, they are the same. */
+    int fds[2];
+    /** Nonzero once the queue is being freed, so that idle workers exit. */
+    long stopping;
+    /** Nonzero if submitting to a full queue waits for a free slot rather than failing. */
+    long block_when_full;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Completion Signal
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Create the descriptor that is signalled when completions are ready.
+ *
+ * This is an eventfd on Linux and a pipe elsewhere. Both ends are non-blocking.
+ *
+ * @param[out]  fds The read and write ends
+ */
+static C_KZG_RET open_signal(int fds[2]) {
+#ifdef __linux__
+    int fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (fd < 0) return C_KZG_ERROR;
+    fds[0] = fd;
+    fds[1] = fd;
+#else
+    if (pipe(fds) != 0) return C_KZG_ERROR;
+    for (size_t i = 0; i < 2; i++) {
+        int flags = fcntl(fds[i], F_GETFL);
+        if (flags < 0 || fcntl(fds[i], F_SETFL, flags | O_NONBLOCK) != 0 ||
+            fcntl(fds[i], F_SETFD, FD_CLOEXEC) != 0) {
+            close(fds[0]);
+            close(fds[1]);
+            return C_KZG_ERROR;
+        }
+    }
+#endif
+    return C_KZG_OK;
+}
+
+/**
+ * Close the completion signal, if it is open.
+ *
+ * @param[in]   fds The read and write ends
+ */
+static void close_signal(const int fds[2]) {
+    if (fds[0] < 0) return;
+    close(fds[0]);
+    if (fds[1] != fds[0]) close(fds[1]);
+}
+
+/**
+ * Make the completion signal readable. If it already is, this does nothing.
+ *
+ * @param[in]   fds The read and write ends
+ */
+static void raise_signal(const int fds[2]) {
+#ifdef __linux__
+    uint64_t value = 1;
+#else
+    uint8_t value = 1;
+#endif
+    ssize_t written;
+    do {
+        written = write(fds[1], &value, sizeof(value));
+    } while (written < 0 && errno == EINTR);
+    /* A full pipe or eventfd counter is already readable */
+}
+
+/**
+ * Consume everything that has been written to the completion signal.
+ *
+ * @param[in]   fds The read and write ends
+ */
+static void clear_signal(const int fds[2]) {
+    uint8_t buf[64];
+    ssize_t n;
+    do {
+        n = read(fds[0], buf, sizeof(buf));
+    } while (n > 0 || (n < 0 && errno == EINTR));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Workers
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Run a job with the blocking function for its type.
+ *
+ * @param[in]   job The job to run
+ * @param[in]   s   The trusted setup
+ */
+static C_KZG_RET run_job(const QueueJob *job, const KZGSettings *s) {
+    switch (job->completion.type) {
+    case KZG_JOB_BLOB_TO_KZG_COMMITMENT:
+        return blob_to_kzg_commitment(job->args.commit.out, job->args.commit.blob, s);
+    case KZG_JOB_COMPUTE_CELLS_AND_KZG_PROOFS:
+        return compute_cells_and_kzg_proofs(
+            job->args.compute_cells.cells,
+            job->args.compute_cells.proofs,
+            job->args.compute_cells.blob,
+            s
+        );
+    case KZG_JOB_RECOVER_CELLS_AND_KZG_PROOFS:
+        return recover_cells_and_kzg_proofs(
+            job->args.recover.recovered_cells,
+            job->args.recover.recovered_proofs,
+            job->args.recover.cell_indices,
+            job->args.recover.cells,
+            job->args.recover.num_cells,
+            s
+        );
+    case KZG_JOB_VERIFY_BLOB_KZG_PROOF_BATCH:
+        return verify_blob_kzg_proof_batch(
+            job->args.verify_blobs.ok,
+            job->args.verify_blobs.blobs,
+            job->args.verify_blobs.commitments_bytes,
+            job->args.verify_blobs.proofs_bytes,
+            job->args.verify_blobs.n,
+            s
+        );
+    case KZG_JOB_VERIFY_CELL_KZG_PROOF_BATCH:
+        return verify_cell_kzg_proof_batch(
+            job->args.verify_cells.ok,
+            job->args.verify_cells.commitments_bytes,
+            job->args.verify_cells.cell_indices,
+            job->args.verify_cells.cells,
+            job->args.verify_cells.proofs_bytes,
+            job->args.verify_cells.num_cells,
+            s
+        );
+    default:
+        return C_KZG_BADARGS;
+    }
+}
+
+/**
+ * Hand a finished job's completion to the callback, or queue it to be reaped.
+ *
+ * @param[in]   q           The queue
+ * @param[in]   completion  The completion
+ */
+static void deliver_completion(KZGQueue *q, const KZGCompletion *completion) {
+    if (q->callback != NULL) {
+        q->callback(q->callback_ctx, completion);
+        pthread_mutex_lock(&q->lock);
+        q->num_in_flight--;
+        pthread_cond_broadcast(&q->completion_ready);
+        pthread_cond_signal(&q->slot_free);
+        pthread_mutex_unlock(&q->lock);
+        return;
+    }
+
+    pthread_mutex_lock(&q->lock);
+    /* There is always room, since the ring holds as many entries as there can be jobs in flight */
+    size_t tail = (q->completions_head + q->num_completions) % q->capacity;
+    q->completions[tail] = *completion;
+    q->num_completions++;
+    pthread_cond_broadcast(&q->completion_ready);
+    pthread_mutex_unlock(&q->lock);
+    raise_signal(q->fds);
+}
+
+/**
+ * The loop each worker thread runs: take the oldest job, run it, deliver its completion.
+ *
+ * Workers only exit once the queue is stopping and every submitted job has been run.
+ *
+ * @param[in]   arg The queue
+ */
+static void *worker_main(void *arg) {
+    KZGQueue *q = (KZGQueue *)arg;
+    QueueJob job;
+
+    for (;;) {
+        pthread_mutex_lock(&q->lock);
+        while (q->num_jobs == 0 && !q->stopping) {
+            pthread_cond_wait(&q->job_ready, &q->lock);
+        }
+        if (q->num_jobs == 0) {
+            pthread_mutex_unlock(&q->lock);
+            return NULL;
+        }
+        job = q->jobs[q->jobs_head];
+        q->jobs_head = (q->jobs_head + 1) % q->capacity;
+        q->num_jobs--;
+        pthread_mutex_unlock(&q->lock);
+
+        job.completion.ret = run_job(&job, q->s);
+        deliver_completion(q, &job.completion);
+    }
+}
+
+/**
+ * Stop the workers once they have run every submitted job, and wait for them to exit.
+ *
+ * @param[in]   q   The queue
+ */
+static void stop_workers(KZGQueue *q) {
+    pthread_mutex_lock(&q->lock);
+    q->stopping = 1;
+    pthread_cond_broadcast(&q->job_ready);
+    pthread_mutex_unlock(&q->lock);
+
+    for (size_t i = 0; i < q->num_threads; i++) {
+        pthread_join(q->threads[i], NULL);
+    }
+    q->num_threads = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Submission
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Add a job to the queue, for the next idle worker to pick up.
+ *
+ * @param[in]   q   The queue
+ * @param[in]   job The job, with its type, user data and arguments set
+ *
+ * @remark If `capacity` jobs are already in flight, this waits for one of them to finish when the
+ * queue blocks when full, and otherwise fails with `C_KZG_ERROR`.
+ */
+static C_KZG_RET submit_job(KZGQueue *q, const QueueJob *job) {
+    if (q == NULL) return C_KZG_BADARGS;
+
+    pthread_mutex_lock(&q->lock);
+    while (q->num_in_flight == q->capacity) {
+        if (!q->block_when_full) {
+            pthread_mutex_unlock(&q->lock);
+            return C_KZG_ERROR;
+        }
+        pthread_cond_wait(&q->slot_free, &q->lock);
+    }
+    size_t tail = (q->jobs_head + q->num_jobs) % q->capacity;
+    q->jobs[tail] = *job;
+    q->num_jobs++;
+    q->num_in_flight++;
+    pthread_cond_signal(&q->job_ready);
+    pthread_mutex_unlock(&q->lock);
+
+    return C_KZG_OK;
+}
+
+/**
+ * Submit a blob_to_kzg_commitment() job.
+ *
+ * @param[in]   q           The queue
+ * @param[in]   user_data   A value to identify the job's completion by
+ * @param[out]  out         The resulting commitment
+ * @param[in]   blob        The blob representing the polynomial to be committed to
+ *
+ * @remark The buffers must stay valid until the job's completion has been delivered.
+ */
+C_KZG_RET kzg_queue_submit_blob_to_kzg_commitment(
+    KZGQueue *q, uint64_t user_data, KZGCommitment *out, const Blob *blob
+) {
+    QueueJob job = {.completion = {user_data, KZG_JOB_BLOB_TO_KZG_COMMITMENT, C_KZG_OK}};
+    job.args.commit.out = out;
+    job.args.commit.blob = blob;
+    return submit_job(q, &job);
+}
+
+/**
+ * Submit a compute_cells_and_kzg_proofs() job.
+ *
+ * @param[in]   q           The queue
+ * @param[in]   user_data   A value to identify the job's completion by
+ * @param[out]  cells       An array of CELLS_PER_EXT_BLOB cells
+ * @param[out]  proofs      An array of CELLS_PER_EXT_BLOB proofs, or NULL to only compute cells
+ * @param[in]   blob        The blob to get cells/proofs for
+ *
+ * @remark The buffers must stay valid until the job's completion has been delivered.
+ */
+C_KZG_RET kzg_queue_submit_compute_cells_and_kzg_proofs(
+    KZGQueue *q, uint64_t user_data, Cell *cells, KZGProof *proofs, const Blob *blob
+) {
+    QueueJob job = {.completion = {user_data, KZG_JOB_COMPUTE_CELLS_AND_KZG_PROOFS, C_KZG_OK}};
+    job.args.compute_cells.cells = cells;
+    job.args.compute_cells.proofs = proofs;
+    job.args.compute_cells.blob = blob;
+    return submit_job(q, &job);
+}
+
+/**
+ * Submit a recover_cells_and_kzg_proofs() job.
+ *
+ * @param[in]   q                   The queue
+ * @param[in]   user_data           A value to identify the job's completion by
+ * @param[out]  recovered_cells     An array of CELLS_PER_EXT_BLOB cells
+ * @param[out]  recovered_proofs    An array of CELLS_PER_EXT_BLOB proofs
+ * @param[in]   cell_indices        The cell indices for the available cells, length `num_cells`
+ * @param[in]   cells               The available cells we recover from, length `num_cells`
+ * @param[in]   num_cells           The number of available cells provided
+ *
+ * @remark The buffers must stay valid until the job's completion has been delivered.
+ */
+C_KZG_RET kzg_queue_submit_recover_cells_and_kzg_proofs(
+    KZGQueue *q,
+    uint64_t user_data,
+    Cell *recovered_cells,
+    KZGProof *recovered_proofs,
+    const uint64_t *cell_indices,
+    const Cell *cells,
+    uint64_t num_cells
+) {
+    QueueJob job = {.completion = {user_data, KZG_JOB_RECOVER_CELLS_AND_KZG_PROOFS, C_KZG_OK}};
+    job.args.recover.recovered_cells = recovered_cells;
+    job.args.recover.recovered_proofs = recovered_proofs;
+    job.args.recover.cell_indices = cell_indices;
+    job.args.recover.cells = cells;
+    job.args.recover.num_cells = num_cells;
+    return submit_job(q, &job);
+}
+
+/**
+ * Submit a verify_blob_kzg_proof_batch() job.
+ *
+ * @param[in]   q                   The queue
+ * @param[in]   user_data           A value to identify the job's completion by
+ * @param[out]  ok                  True if the proofs are valid, otherwise false
+ * @param[in]   blobs               Array of blobs to verify
+ * @param[in]   commitments_bytes   Array of commitments to verify
+ * @param[in]   proofs_bytes        Array of proofs used for verification
+ * @param[in]   n                   The number of blobs/commitments/proofs
+ *
+ * @remark The buffers must stay valid until the job's completion has been delivered.
+ */
+C_KZG_RET kzg_queue_submit_verify_blob_kzg_proof_batch(
+    KZGQueue *q,
+    uint64_t user_data,
+    bool *ok,
+    const Blob *blobs,
+    const Bytes48 *commitments_bytes,
+    const Bytes48 *proofs_bytes,
+    uint64_t n
+) {
+    QueueJob job = {.completion = {user_data, KZG_JOB_VERIFY_BLOB_KZG_PROOF_BATCH, C_KZG_OK}};
+    job.args.verify_blobs.ok = ok;
+    job.args.verify_blobs.blobs = blobs;
+    job.args.verify_blobs.commitments_bytes = commitments_bytes;
+    job.args.verify_blobs.proofs_bytes = proofs_bytes;
+    job.args.verify_blobs.n = n;
+    return submit_job(q, &job);
+}
+
+/**
+ * Submit a verify_cell_kzg_proof_batch() job.
+ *
+ * @param[in]   q                   The queue
+ * @param[in]   user_data           A value to identify the job's completion by
+ * @param[out]  ok                  True if the proofs are valid, otherwise false
+ * @param[in]   commitments_bytes   The commitments for the cells, length `num_cells`
+ * @param[in]   cell_indices        The cell indices for the cells, length `num_cells`
+ * @param[in]   cells               The cells to check, length `num_cells`
+ * @param[in]   proofs_bytes        The proofs for the cells, length `num_cells`
+ * @param[in]   num_cells           The number of cells provided
+ *
+ * @remark The buffers must stay valid until the job's completion has been delivered.
+ */
+C_KZG_RET kzg_queue_submit_verify_cell_kzg_proof_batch(
+    KZGQueue *q,
+    uint64_t user_data,
+    bool *ok,
+    const Bytes48 *commitments_bytes,
+    const uint64_t *cell_indices,
+    const Cell *cells,
+    const Bytes48 *proofs_bytes,
+    uint64_t num_cells
+) {
+    QueueJob job = {.completion = {user_data, KZG_JOB_VERIFY_CELL_KZG_PROOF_BATCH, C_KZG_OK}};
+    job.args.verify_cells.ok = ok;
+    job.args.verify_cells.commitments_bytes = commitments_bytes;
+    job.args.verify_cells.cell_indices = cell_indices;
+    job.args.verify_cells.cells = cells;
+    job.args.verify_cells.proofs_bytes = proofs_bytes;
+    job.args.verify_cells.num_cells = num_cells;
+    return submit_job(q, &job);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Completion
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Move up to `max` queued completions to `out`. The lock must be held.
+ *
+ * @param[in]   q   The queue
+ * @param[out]  out The completions, oldest first
+ * @param[in]   max The length of `out`
+ */
+static size_t take_completions(KZGQueue *q, KZGCompletion *out, size_t max) {
+    size_t n = q->num_completions < max ? q->num_completions : max;
+    for (size_t i = 0; i < n; i++) {
+        out[i] = q->completions[q->completions_head];
+        q->completions_head = (q->completions_head + 1) % q->capacity;
+    }
+    q->num_completions -= n;
+    q->num_in_flight -= n;
+    for (size_t i = 0; i < n; i++) {
+        pthread_cond_signal(&q->slot_free);
+    }
+    return n;
+}
+
+/**
+ * Reap the completions that are ready, without blocking.
+ *
+ * @param[in]   q   The queue
+ * @param[out]  out The completions, oldest first
+ * @param[in]   max The length of `out`
+ *
+ * @return The number of completions written to `out`.
+ *
+ * @remark This always returns 0 for a queue with a callback.
+ */
+size_t kzg_queue_poll(KZGQueue *q, KZGCompletion *out, size_t max) {
+    if (q == NULL || q->callback != NULL || out == NULL || max == 0) return 0;
+
+    /*
+     * Clear the signal before taking the completions. One delivered in between is taken now and
+     * leaves the signal raised, which only costs a spurious wakeup, while the other order could
+     * clear the signal for a completion that is then left behind.
+     */
+    clear_signal(q->fds);
+
+    pthread_mutex_lock(&q->lock);
+    size_t n = take_completions(q, out, max);
+    bool left_over = q->num_completions > 0;
+    pthread_mutex_unlock(&q->lock);
+
+    /* Completions that did not fit in `out` must keep the descriptor readable */
+    if (left_over) raise_signal(q->fds);
+    return n;
+}
+
+/**
+ * Reap the completions that are ready, blocking until there is at least one.
+ *
+ * @param[in]   q   The queue
+ * @param[out]  out The completions, oldest first
+ * @param[in]   max The length of `out`
+ *
+ * @return The number of completions written to `out`. This is only 0 if there are no jobs in
+ * flight, so there is nothing to wait for.
+ *
+ * @remark For a queue with a callback, this waits until every job in flight has completed and
+ * returns 0.
+ */
+size_t kzg_queue_wait(KZGQueue *q, KZGCompletion *out, size_t max) {
+    if (q == NULL) return 0;
+    if (q->callback == NULL && (out == NULL || max == 0)) return 0;
+    if (q->callback == NULL) clear_signal(q->fds);
+
+    pthread_mutex_lock(&q->lock);
+    while (q->num_completions == 0 && q->num_in_flight > 0) {
+        pthread_cond_wait(&q->completion_ready, &q->lock);
+    }
+    size_t n = take_completions(q, out, max);
+    bool left_over = q->num_completions > 0;
+    pthread_mutex_unlock(&q->lock);
+
+    /* Completions that did not fit in `out` must keep the descriptor readable */
+    if (left_over) raise_signal(q->fds);
+    return n;
+}
+
+/**
+ * Get the descriptor that becomes readable when completions are ready to be reaped.
+ *
+ * It is an eventfd on Linux and the read end of a pipe elsewhere. Wait for it with poll(), epoll
+ * or an event loop, but do not read from it; kzg_queue_poll() and kzg_queue_wait() clear it.
+ *
+ * @param[in]   q   The queue
+ *
+ * @return The descriptor, or -1 for a queue with a callback.
+ */
+int kzg_queue_fd(const KZGQueue *q) {
+    if (q == NULL) return -1;
+    return q->fds[0];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Lifecycle
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Create a job queue and start its workers.
+ *
+ * @param[out]  out             The new queue, free afterwards with kzg_queue_free()
+ * @param[in]   s               The trusted setup, which must outlive the queue
+ * @param[in]   num_threads     The number of worker threads
+ * @param[in]   capacity        The most jobs that can be in flight at once
+ * @param[in]   block_when_full Whether a submission to a full queue waits for a free slot
+ * @param[in]   callback        Called with each completion on a worker thread, or NULL
+ * @param[in]   callback_ctx    Passed to `callback`
+ *
+ * @remark A job is in flight from its submission until its completion is delivered.
+ * @remark Unless `block_when_full` is set, a submission to a full queue fails with `C_KZG_ERROR`.
+ * @remark Without a callback, the completions are queued for kzg_queue_poll() and kzg_queue_wait().
+ */
+C_KZG_RET kzg_queue_new(
+    KZGQueue **out,
+    const KZGSettings *s,
+    size_t num_threads,
+    size_t capacity,
+    bool block_when_full,
+    KZGQueueCallback callback,
+    void *callback_ctx
+) {
+    C_KZG_RET ret;
+    KZGQueue *q = NULL;
+    bool has_lock = false, has_job_ready = false, has_completion_ready = false;
+    bool has_slot_free = false;
+
+    if (out == NULL || s == NULL || num_threads == 0 || capacity == 0) return C_KZG_BADARGS;
+    *out = NULL;
+
+    ret = c_kzg_calloc((void **)&q, 1, sizeof(KZGQueue));
+    if (ret != C_KZG_OK) goto out;
+    q->s = s;
+    q->callback = callback;
+    q->callback_ctx = callback_ctx;
+    q->capacity = capacity;
+    q->block_when_full = block_when_full;
+    q->fds[0] = -1;
+    q->fds[1] = -1;
+
+    ret = c_kzg_calloc((void **)&q->threads, num_threads, sizeof(pthread_t));
+    if (ret != C_KZG_OK) goto out;
+    ret = c_kzg_calloc((void **)&q->jobs, capacity, sizeof(QueueJob));
+    if (ret != C_KZG_OK) goto out;
+    if (callback == NULL) {
+        ret = c_kzg_calloc((void **)&q->completions, capacity, sizeof(KZGCompletion));
+        if (ret != C_KZG_OK) goto out;
+        ret = open_signal(q->fds);
+        if (ret != C_KZG_OK) goto out;
+    }
+
+    ret = C_KZG_ERROR;
+    if (pthread_mutex_init(&q->lock, NULL) != 0) goto out;
+    has_lock = true;
+    if (pthread_cond_init(&q->job_ready, NULL) != 0) goto out;
+    has_job_ready = true;
+    if (pthread_cond_init(&q->completion_ready, NULL) != 0) goto out;
+    has_completion_ready = true;
+    if (pthread_cond_init(&q->slot_free, NULL) != 0) goto out;
+    has_slot_free = true;
+
+    for (; q->num_threads < num_threads; q->num_threads++) {
+        if (pthread_create(&q->threads[q->num_threads], NULL, worker_main, q) != 0) goto out;
+    }
+
+    *out = q;
+    return C_KZG_OK;
+
+out:
+    if (q != NULL) {
+        if (q->num_threads > 0) stop_workers(q);
+        if (has_slot_free) pthread_cond_destroy(&q->slot_free);
+        if (has_completion_ready) pthread_cond_destroy(&q->completion_ready);
+        if (has_job_ready) pthread_cond_destroy(&q->job_ready);
+        if (has_lock) pthread_mutex_destroy(&q->lock);
+        close_signal(q->fds);
+        c_kzg_free(q->completions);
+        c_kzg_free(q->jobs);
+        c_kzg_free(q->threads);
+        c_kzg_free(q);
+    }
+    return ret;
+}
+
+/**
+ * Free a job queue.
+ *
+ * This waits for every submitted job to be run and its completion to be delivered, so that no
+ * worker touches the job buffers afterwards. Completions that have not been reaped are dropped.
+ *
+ * @param[in]   q   The queue to free
+ */
+void kzg_queue_free(KZGQueue *q) {
+    if (q == NULL) return;
+    stop_workers(q);
+    pthread_cond_destroy(&q->slot_free);
+    pthread_cond_destroy(&q->completion_ready);
+    pthread_cond_destroy(&q->job_ready);
+    pthread_mutex_destroy(&q->lock);
+    close_signal(q->fds);
+    c_kzg_free(q->completions);
+    c_kzg_free(q->jobs);
+    c_kzg_free(q->threads);
+    c_kzg_free(q);
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright 2024 Benjamin Edgington
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * An asynchronous job queue in front of the blocking API.
+ *
+ * Jobs are submitted with pointers to their inputs and outputs, and are run by a pool of worker
+ * threads owned by the queue. When a job is done, its completion is either passed to a callback
+ * on the worker thread, or queued to be reaped with kzg_queue_poll() or kzg_queue_wait(). In the
+ * latter case a file descriptor is also signalled, so that an event loop can wait on it.
+ *
+ * At most `capacity` jobs are in flight, from submission until their completions are delivered.
+ * Submitting to a full queue either waits for a slot, if the queue was created to block when full,
+ * or fails with `C_KZG_ERROR`, which a submission returns for no other reason. A blocking queue
+ * which reports completions with kzg_queue_poll() or kzg_queue_wait() only frees slots as they are
+ * reaped, so it must not be submitted to from the only thread that reaps it.
+ */
+
+#pragma once
+
+#include "ckzg.h"
+
+#include <stdbool.h> /* For bool */
+#include <stddef.h>  /* For size_t */
+#include <stdint.h>  /* For uint64_t */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Types
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/** The kinds of job that can be submitted to a queue. */
+typedef enum {
+    KZG_JOB_BLOB_TO_KZG_COMMITMENT,       /**< See blob_to_kzg_commitment(). */
+    KZG_JOB_COMPUTE_CELLS_AND_KZG_PROOFS, /**< See compute_cells_and_kzg_proofs(). */
+    KZG_JOB_RECOVER_CELLS_AND_KZG_PROOFS, /**< See recover_cells_and_kzg_proofs(). */
+    KZG_JOB_VERIFY_BLOB_KZG_PROOF_BATCH,  /**< See verify_blob_kzg_proof_batch(). */
+    KZG_JOB_VERIFY_CELL_KZG_PROOF_BATCH,  /**< See verify_cell_kzg_proof_batch(). */
+} KZGJobType;
+
+/** The result of a job. Its outputs are in the buffers it was submitted with. */
+typedef struct {
+    /** The value the job was submitted with. */
+    uint64_t user_data;
+    /** The kind of job. */
+    KZGJobType type;
+    /** What the job's function returned. Its outputs are only valid if this is `C_KZG_OK`. */
+    C_KZG_RET ret;
+} KZGCompletion;
+
+/** Called on a worker thread as each job completes. It should return quickly. */
+typedef void (*KZGQueueCallback)(void *ctx, const KZGCompletion *completion);
+
+/** A job queue, see kzg_queue_new(). */
+typedef struct KZGQueue KZGQueue;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+C_KZG_RET kzg_queue_new(
+    KZGQueue **out,
+    const KZGSettings *s,
+    size_t num_threads,
+    size_t capacity,
+    bool block_when_full,
+    KZGQueueCallback callback,
+    void *callback_ctx
+);
+
+void kzg_queue_free(KZGQueue *q);
+
+int kzg_queue_fd(const KZGQueue *q);
+
+C_KZG_RET kzg_queue_submit_blob_to_kzg_commitment(
+    KZGQueue *q, uint64_t user_data, KZGCommitment *out, const Blob *blob
+);
+
+C_KZG_RET kzg_queue_submit_compute_cells_and_kzg_proofs(
+    KZGQueue *q, uint64_t user_data, Cell *cells, KZGProof *proofs, const Blob *blob
+);
+
+C_KZG_RET kzg_queue_submit_recover_cells_and_kzg_proofs(
+    KZGQueue *q,
+    uint64_t user_data,
+    Cell *recovered_cells,
+    KZGProof *recovered_proofs,
+    const uint64_t *cell_indices,
+    const Cell *cells,
+    uint64_t num_cells
+);
+
+C_KZG_RET kzg_queue_submit_verify_blob_kzg_proof_batch(
+    KZGQueue *q,
+    uint64_t user_data,
+    bool *ok,
+    const Blob *blobs,
+    const Bytes48 *commitments_bytes,
+    const Bytes48 *proofs_bytes,
+    uint64_t n
+);
+
+C_KZG_RET kzg_queue_submit_verify_cell_kzg_proof_batch(
+    KZGQueue *q,
+    uint64_t user_data,
+    bool *ok,
+    const Bytes48 *commitments_bytes,
+    const uint64_t *cell_indices,
+    const Cell *cells,
+    const Bytes48 *proofs_bytes,
+    uint64_t num_cells
+);
+
+size_t kzg_queue_poll(KZGQueue *q, KZGCompletion *out, size_t max);
+
+size_t kzg_queue_wait(KZGQueue *q, KZGCompletion *out, size_t max);
+
+#ifdef __cplusplus
+}
+#endif
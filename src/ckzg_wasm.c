@@ -3,6 +3,15 @@
 #include <stdlib.h>
 #include <string.h>
 
+/* Batches are split across threads in the pthreads build (emcc -pthread) */
+#if defined(__EMSCRIPTEN_PTHREADS__) && !defined(WASM_USE_THREADS)
+#define WASM_USE_THREADS
+#endif
+
+#ifdef WASM_USE_THREADS
+#include <pthread.h>
+#endif
+
 
 static char* invalid_arg(void)
 {
@@ -49,6 +58,14 @@ uint32_t load_trusted_setup_wasm(
     uint8_t* g2_monomial_bytes,
     uint64_t precompute) 
 {
+    if (s != NULL) {
+        free_trusted_setup_wasm();
+    }
+    s = malloc(sizeof(KZGSettings));
+    if (s == NULL) {
+        return C_KZG_MALLOC;
+    }
+    memset(s, 0, sizeof(KZGSettings));
 
     uint32_t ret = load_trusted_setup(
         s,
@@ -302,3 +319,255 @@ const char* verify_cell_kzg_proof_wasm(
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Binary variants
+//
+// These write their results into caller-provided buffers in linear memory and
+// return the C_KZG_RET status, instead of allocating hex strings.
+////////////////////////////////////////////////////////////////////////////////
+
+/* Smallest number of cells worth verifying on a separate thread. */
+#define MIN_CELLS_PER_THREAD 64
+
+typedef C_KZG_RET (*batch_range_fn)(void *ctx, size_t begin, size_t end, bool *ok);
+
+typedef struct {
+    batch_range_fn fn;
+    void *ctx;
+    size_t begin;
+    size_t end;
+    C_KZG_RET *ret;
+    bool *ok;
+} batch_range_t;
+
+static void *run_batch_range(void *arg)
+{
+    batch_range_t *range = arg;
+    *range->ok = true;
+    *range->ret = range->fn(range->ctx, range->begin, range->end, range->ok);
+    return NULL;
+}
+
+/*
+ * Run fn over [0, n). With WASM_USE_THREADS the range is split across up to
+ * WASM_MAX_THREADS threads (Web Workers), with at least min_per_thread items
+ * each. Otherwise it runs on the calling thread. ok is the conjunction of every
+ * range's result.
+ */
+static C_KZG_RET run_batch(
+    batch_range_fn fn, void *ctx, size_t n, size_t min_per_thread, bool *ok)
+{
+    batch_range_t ranges[WASM_MAX_THREADS];
+    C_KZG_RET rets[WASM_MAX_THREADS];
+    bool oks[WASM_MAX_THREADS];
+    size_t num_ranges = 1;
+
+#ifdef WASM_USE_THREADS
+    pthread_t threads[WASM_MAX_THREADS];
+    bool started[WASM_MAX_THREADS] = {false};
+
+    if (min_per_thread == 0) min_per_thread = 1;
+    num_ranges = n / min_per_thread;
+    if (num_ranges > WASM_MAX_THREADS) num_ranges = WASM_MAX_THREADS;
+    if (num_ranges == 0) num_ranges = 1;
+#else
+    (void)min_per_thread;
+#endif
+
+    /* Split into near-equal ranges, the first n % num_ranges get one extra item */
+    size_t chunk = n / num_ranges, extra = n % num_ranges;
+    for (size_t i = 0; i < num_ranges; i++) {
+        ranges[i].fn = fn;
+        ranges[i].ctx = ctx;
+        ranges[i].begin = i * chunk + (i < extra ? i : extra);
+        ranges[i].end = ranges[i].begin + chunk + (i < extra ? 1 : 0);
+        ranges[i].ret = &rets[i];
+        ranges[i].ok = &oks[i];
+    }
+
+#ifdef WASM_USE_THREADS
+    /* The calling thread takes the first range; fall back to it if a worker is unavailable */
+    for (size_t i = 1; i < num_ranges; i++) {
+        started[i] = pthread_create(&threads[i], NULL, run_batch_range, &ranges[i]) == 0;
+    }
+#endif
+
+    run_batch_range(&ranges[0]);
+
+#ifdef WASM_USE_THREADS
+    for (size_t i = 1; i < num_ranges; i++) {
+        if (started[i]) {
+            pthread_join(threads[i], NULL);
+        } else {
+            run_batch_range(&ranges[i]);
+        }
+    }
+#endif
+
+    *ok = true;
+    for (size_t i = 0; i < num_ranges; i++) {
+        if (rets[i] != C_KZG_OK) return rets[i];
+        *ok = *ok && oks[i];
+    }
+    return C_KZG_OK;
+}
+
+C_KZG_RET blob_to_kzg_commitment_bin_wasm(KZGCommitment *out, const Blob *blob)
+{
+    return blob_to_kzg_commitment(out, blob, s);
+}
+
+C_KZG_RET compute_blob_kzg_proof_bin_wasm(
+    KZGProof *out,
+    const Blob *blob,
+    const Bytes48 *commitment_bytes)
+{
+    return compute_blob_kzg_proof(out, blob, commitment_bytes, s);
+}
+
+C_KZG_RET verify_blob_kzg_proof_bin_wasm(
+    bool *ok,
+    const Blob *blob,
+    const Bytes48 *commitment_bytes,
+    const Bytes48 *proof_bytes)
+{
+    return verify_blob_kzg_proof(ok, blob, commitment_bytes, proof_bytes, s);
+}
+
+C_KZG_RET verify_kzg_proof_bin_wasm(
+    bool *ok,
+    const Bytes48 *commitment_bytes,
+    const Bytes32 *z_bytes,
+    const Bytes32 *y_bytes,
+    const Bytes48 *proof_bytes)
+{
+    return verify_kzg_proof(ok, commitment_bytes, z_bytes, y_bytes, proof_bytes, s);
+}
+
+C_KZG_RET compute_cells_and_kzg_proofs_bin_wasm(Cell *cells, KZGProof *proofs, const Blob *blob)
+{
+    return compute_cells_and_kzg_proofs(cells, proofs, blob, s);
+}
+
+C_KZG_RET recover_cells_and_kzg_proofs_bin_wasm(
+    Cell *recovered_cells,
+    KZGProof *recovered_proofs,
+    const uint64_t *cell_indices,
+    const Cell *cells,
+    uint32_t num_cells)
+{
+    return recover_cells_and_kzg_proofs(
+        recovered_cells, recovered_proofs, cell_indices, cells, num_cells, s);
+}
+
+typedef struct {
+    KZGCommitment *out;
+    const Blob *blobs;
+} commitments_ctx_t;
+
+static C_KZG_RET commitments_range(void *arg, size_t begin, size_t end, bool *ok)
+{
+    commitments_ctx_t *ctx = arg;
+    (void)ok;
+    return blob_to_kzg_commitments(&ctx->out[begin], &ctx->blobs[begin], end - begin, s);
+}
+
+C_KZG_RET blob_to_kzg_commitments_bin_wasm(
+    KZGCommitment *out,
+    const Blob *blobs,
+    uint32_t num_blobs)
+{
+    bool ok;
+    commitments_ctx_t ctx = {out, blobs};
+    return run_batch(commitments_range, &ctx, num_blobs, 1, &ok);
+}
+
+typedef struct {
+    Cell *cells;
+    KZGProof *proofs;
+    const Blob *blobs;
+} cells_ctx_t;
+
+static C_KZG_RET cells_range(void *arg, size_t begin, size_t end, bool *ok)
+{
+    cells_ctx_t *ctx = arg;
+    (void)ok;
+    return compute_cells_and_kzg_proofs_batch(
+        &ctx->cells[begin * CELLS_PER_EXT_BLOB],
+        ctx->proofs != NULL ? &ctx->proofs[begin * CELLS_PER_EXT_BLOB] : NULL,
+        &ctx->blobs[begin],
+        end - begin,
+        s);
+}
+
+C_KZG_RET compute_cells_and_kzg_proofs_batch_bin_wasm(
+    Cell *cells,
+    KZGProof *proofs,
+    const Blob *blobs,
+    uint32_t num_blobs)
+{
+    bool ok;
+    cells_ctx_t ctx = {cells, proofs, blobs};
+    return run_batch(cells_range, &ctx, num_blobs, 1, &ok);
+}
+
+typedef struct {
+    const Blob *blobs;
+    const Bytes48 *commitments_bytes;
+    const Bytes48 *proofs_bytes;
+} verify_blobs_ctx_t;
+
+static C_KZG_RET verify_blobs_range(void *arg, size_t begin, size_t end, bool *ok)
+{
+    verify_blobs_ctx_t *ctx = arg;
+    return verify_blob_kzg_proof_batch(
+        ok,
+        &ctx->blobs[begin],
+        &ctx->commitments_bytes[begin],
+        &ctx->proofs_bytes[begin],
+        end - begin,
+        s);
+}
+
+C_KZG_RET verify_blob_kzg_proof_batch_bin_wasm(
+    bool *ok,
+    const Blob *blobs,
+    const Bytes48 *commitments_bytes,
+    const Bytes48 *proofs_bytes,
+    uint32_t num_blobs)
+{
+    verify_blobs_ctx_t ctx = {blobs, commitments_bytes, proofs_bytes};
+    return run_batch(verify_blobs_range, &ctx, num_blobs, 1, ok);
+}
+
+typedef struct {
+    const Bytes48 *commitments_bytes;
+    const uint64_t *cell_indices;
+    const Cell *cells;
+    const Bytes48 *proofs_bytes;
+} verify_cells_ctx_t;
+
+static C_KZG_RET verify_cells_range(void *arg, size_t begin, size_t end, bool *ok)
+{
+    verify_cells_ctx_t *ctx = arg;
+    return verify_cell_kzg_proof_batch(
+        ok,
+        &ctx->commitments_bytes[begin],
+        &ctx->cell_indices[begin],
+        &ctx->cells[begin],
+        &ctx->proofs_bytes[begin],
+        end - begin,
+        s);
+}
+
+C_KZG_RET verify_cell_kzg_proof_batch_bin_wasm(
+    bool *ok,
+    const Bytes48 *commitments_bytes,
+    const uint64_t *cell_indices,
+    const Cell *cells,
+    const Bytes48 *proofs_bytes,
+    uint32_t num_cells)
+{
+    verify_cells_ctx_t ctx = {commitments_bytes, cell_indices, cells, proofs_bytes};
+    return run_batch(verify_cells_range, &ctx, num_cells, MIN_CELLS_PER_THREAD, ok);
+}
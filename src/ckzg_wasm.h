@@ -76,6 +76,76 @@ const char* verify_cell_kzg_proof_wasm(
 
 KZGSettings* get_settings_wasm(void);
 
+// Binary variants
+//
+// Results are written to caller-provided buffers in linear memory, and the
+// C_KZG_RET status is returned. Verification results go to *ok.
+//
+// The batch functions split their work across up to WASM_MAX_THREADS threads
+// when built with -pthread, and run on the calling thread otherwise.
+
+#ifndef WASM_MAX_THREADS
+#define WASM_MAX_THREADS 4
+#endif
+
+C_KZG_RET blob_to_kzg_commitment_bin_wasm(KZGCommitment *out, const Blob *blob);
+
+C_KZG_RET compute_blob_kzg_proof_bin_wasm(
+    KZGProof *out,
+    const Blob *blob,
+    const Bytes48 *commitment_bytes);
+
+C_KZG_RET verify_blob_kzg_proof_bin_wasm(
+    bool *ok,
+    const Blob *blob,
+    const Bytes48 *commitment_bytes,
+    const Bytes48 *proof_bytes);
+
+C_KZG_RET verify_kzg_proof_bin_wasm(
+    bool *ok,
+    const Bytes48 *commitment_bytes,
+    const Bytes32 *z_bytes,
+    const Bytes32 *y_bytes,
+    const Bytes48 *proof_bytes);
+
+// Either output may be NULL.
+C_KZG_RET compute_cells_and_kzg_proofs_bin_wasm(Cell *cells, KZGProof *proofs, const Blob *blob);
+
+C_KZG_RET recover_cells_and_kzg_proofs_bin_wasm(
+    Cell *recovered_cells,
+    KZGProof *recovered_proofs,
+    const uint64_t *cell_indices,
+    const Cell *cells,
+    uint32_t num_cells);
+
+C_KZG_RET blob_to_kzg_commitments_bin_wasm(
+    KZGCommitment *out,
+    const Blob *blobs,
+    uint32_t num_blobs);
+
+// Cells and proofs are laid out blob by blob, CELLS_PER_EXT_BLOB per blob.
+// proofs may be NULL.
+C_KZG_RET compute_cells_and_kzg_proofs_batch_bin_wasm(
+    Cell *cells,
+    KZGProof *proofs,
+    const Blob *blobs,
+    uint32_t num_blobs);
+
+C_KZG_RET verify_blob_kzg_proof_batch_bin_wasm(
+    bool *ok,
+    const Blob *blobs,
+    const Bytes48 *commitments_bytes,
+    const Bytes48 *proofs_bytes,
+    uint32_t num_blobs);
+
+C_KZG_RET verify_cell_kzg_proof_batch_bin_wasm(
+    bool *ok,
+    const Bytes48 *commitments_bytes,
+    const uint64_t *cell_indices,
+    const Cell *cells,
+    const Bytes48 *proofs_bytes,
+    uint32_t num_cells);
+
 #ifdef __cplusplus
 }
 #endif
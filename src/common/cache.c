@@ -0,0 +1,246 @@
+/*
+ * Copyright 2024 Benjamin Edgington
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/cache.h"
+#include "common/alloc.h"
+
+#include <stdint.h> /* For SIZE_MAX */
+#include <string.h> /* For memcmp */
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h> /* For _InterlockedExchange and _mm_pause */
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Locking
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ * The lock is only held for a few key comparisons, never while verifying, so a spinlock is enough.
+ * It is built on compiler intrinsics so that no threading library needs to be linked.
+ */
+
+/**
+ * Tell the processor that the calling thread is spinning on a lock.
+ *
+ * This frees execution resources for a sibling hyper-thread, and avoids the memory-order
+ * mispeculation which would otherwise stall the thread when the lock is released.
+ */
+static void cpu_relax(void) {
+#if defined(_MSC_VER) && !defined(__clang__)
+#if defined(_M_IX86) || defined(_M_X64)
+    _mm_pause();
+#elif defined(_M_ARM) || defined(_M_ARM64)
+    __yield();
+#endif
+#elif defined(__i386__) || defined(__x86_64__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+/**
+ * Acquire the lock of a verify cache, spinning until it is free.
+ *
+ * Between attempts, it only reads the lock, so that waiting threads share its cache line rather
+ * than pulling it away from the holder.
+ *
+ * @param[in,out]   cache   The cache to lock
+ */
+static void verify_cache_lock(VerifyCache *cache) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    while (_InterlockedExchange(&cache->lock, 1) != 0) {
+        while (cache->lock != 0) {
+            cpu_relax();
+        }
+    }
+#else
+    while (__atomic_exchange_n(&cache->lock, 1, __ATOMIC_ACQUIRE) != 0) {
+        while (__atomic_load_n(&cache->lock, __ATOMIC_RELAXED) != 0) {
+            cpu_relax();
+        }
+    }
+#endif
+}
+
+/**
+ * Release the lock of a verify cache.
+ *
+ * @param[in,out]   cache   The cache to unlock
+ */
+static void verify_cache_unlock(VerifyCache *cache) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    _InterlockedExchange(&cache->lock, 0);
+#else
+    __atomic_store_n(&cache->lock, 0, __ATOMIC_RELEASE);
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Verify Cache
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Initialize an empty verify cache.
+ *
+ * @param[out]  cache       The cache to initialize
+ * @param[in]   capacity    The most keys to hold, rounded up to a power of two
+ *
+ * @remark Release the cache's memory later with verify_cache_free().
+ */
+C_KZG_RET verify_cache_init(VerifyCache *cache, size_t capacity) {
+    C_KZG_RET ret;
+    size_t num_sets = 1;
+
+    cache->keys = NULL;
+    cache->next_way = NULL;
+    cache->lock = 0;
+
+    /* Make sure the number of slots cannot overflow */
+    if (capacity == 0 || capacity > SIZE_MAX / 2 / sizeof(Bytes32)) return C_KZG_BADARGS;
+
+    while (num_sets * VERIFY_CACHE_WAYS < capacity) {
+        num_sets *= 2;
+    }
+    cache->num_sets = num_sets;
+
+    ret = c_kzg_calloc((void **)&cache->keys, num_sets * VERIFY_CACHE_WAYS, sizeof(Bytes32));
+    if (ret != C_KZG_OK) goto out;
+    ret = c_kzg_calloc((void **)&cache->next_way, num_sets, sizeof(uint8_t));
+    if (ret != C_KZG_OK) goto out;
+
+out:
+    if (ret != C_KZG_OK) verify_cache_free(cache);
+    return ret;
+}
+
+/**
+ * Free the memory held by a verify cache.
+ *
+ * @param[in]   cache   The cache to free
+ */
+void verify_cache_free(VerifyCache *cache) {
+    if (cache == NULL) return;
+    c_kzg_free(cache->keys);
+    c_kzg_free(cache->next_way);
+}
+
+/**
+ * Find the set of a verify cache that may hold a key.
+ *
+ * @param[in]   cache   The cache
+ * @param[in]   key     The key
+ *
+ * @return The index of the first slot of the set.
+ */
+static size_t verify_cache_set_start(const VerifyCache *cache, const Bytes32 *key) {
+    size_t bits = (size_t)key->bytes[0] | (size_t)key->bytes[1] << 8 |
+                  (size_t)key->bytes[2] << 16 | (size_t)key->bytes[3] << 24;
+    return (bits & (cache->num_sets - 1)) * VERIFY_CACHE_WAYS;
+}
+
+/**
+ * Look up several keys in a verify cache, taking its lock once.
+ *
+ * @param[in]   cache       The cache
+ * @param[out]  hits_out    Whether each key is held, length `n`
+ * @param[in]   keys        The keys to look up, length `n`
+ * @param[in]   n           The number of keys
+ */
+void verify_cache_contains_many(VerifyCache *cache, bool *hits_out, const Bytes32 *keys, size_t n) {
+    verify_cache_lock(cache);
+    for (size_t i = 0; i < n; i++) {
+        size_t start = verify_cache_set_start(cache, &keys[i]);
+        hits_out[i] = false;
+        for (size_t j = 0; j < VERIFY_CACHE_WAYS; j++) {
+            if (memcmp(cache->keys[start + j].bytes, keys[i].bytes, sizeof(Bytes32)) == 0) {
+                hits_out[i] = true;
+                break;
+            }
+        }
+    }
+    verify_cache_unlock(cache);
+}
+
+/**
+ * Insert several keys into a verify cache, taking its lock once.
+ *
+ * @param[in,out]   cache   The cache
+ * @param[in]       keys    The keys to insert, length `n`
+ * @param[in]       n       The number of keys
+ *
+ * @remark Keys the cache already holds are not inserted again.
+ */
+void verify_cache_insert_many(VerifyCache *cache, const Bytes32 *keys, size_t n) {
+    verify_cache_lock(cache);
+    for (size_t i = 0; i < n; i++) {
+        size_t start = verify_cache_set_start(cache, &keys[i]);
+        bool found = false;
+        for (size_t j = 0; j < VERIFY_CACHE_WAYS; j++) {
+            if (memcmp(cache->keys[start + j].bytes, keys[i].bytes, sizeof(Bytes32)) == 0) {
+                found = true;
+                break;
+            }
+        }
+        if (found) continue;
+
+        /* Replace the oldest key in the set */
+        size_t set = start / VERIFY_CACHE_WAYS;
+        cache->keys[start + cache->next_way[set]] = keys[i];
+        cache->next_way[set] = (uint8_t)((cache->next_way[set] + 1) % VERIFY_CACHE_WAYS);
+    }
+    verify_cache_unlock(cache);
+}
+
+/**
+ * Compute the verify cache key of a claim, a hash of everything that the claim depends on.
+ *
+ * The data is hashed on its own first, so that the key is the hash of a short, fixed-size message.
+ *
+ * @param[out]  key_out             The key
+ * @param[in]   domain              The domain separator, of length `VERIFY_CACHE_DOMAIN_LENGTH`
+ * @param[in]   commitment_bytes    The commitment
+ * @param[in]   index               The index of the data, or zero if it has none
+ * @param[in]   data                The data the claim is about, such as a blob or a cell
+ * @param[in]   data_len            The length of the data
+ * @param[in]   proof_bytes         The proof
+ */
+void compute_verify_cache_key(
+    Bytes32 *key_out,
+    const char *domain,
+    const Bytes48 *commitment_bytes,
+    uint64_t index,
+    const uint8_t *data,
+    size_t data_len,
+    const Bytes48 *proof_bytes
+) {
+    uint8_t bytes[VERIFY_CACHE_DOMAIN_LENGTH + sizeof(Bytes48) + sizeof(uint64_t) + sizeof(Bytes32)
+                  + sizeof(Bytes48)];
+    uint8_t *offset = bytes;
+
+    memcpy(offset, domain, VERIFY_CACHE_DOMAIN_LENGTH);
+    offset += VERIFY_CACHE_DOMAIN_LENGTH;
+    memcpy(offset, commitment_bytes->bytes, sizeof(Bytes48));
+    offset += sizeof(Bytes48);
+    bytes_from_uint64(offset, index);
+    offset += sizeof(uint64_t);
+    blst_sha256(offset, data, data_len);
+    offset += sizeof(Bytes32);
+    memcpy(offset, proof_bytes->bytes, sizeof(Bytes48));
+
+    blst_sha256(key_out->bytes, bytes, sizeof(bytes));
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright 2024 Benjamin Edgington
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "common/bytes.h"
+#include "common/ret.h"
+
+#include <stdbool.h> /* For bool */
+#include <stddef.h>  /* For size_t */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Macros
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/** The number of keys in each set of a verify cache. */
+#define VERIFY_CACHE_WAYS 4
+
+/** The length of the domain separators for verify cache keys. */
+#define VERIFY_CACHE_DOMAIN_LENGTH 16
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Types
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * A bounded set of the keys of claims that have been verified, safe to use from many threads.
+ *
+ * Each key can only be held in one set of `VERIFY_CACHE_WAYS` slots, picked by its low bits. When
+ * the set is full, the oldest key in it is replaced, so the cache never grows.
+ */
+typedef struct {
+    /** The keys, `num_sets * VERIFY_CACHE_WAYS` entries. An all-zero key marks an empty slot. */
+    Bytes32 *keys;
+    /** The slot in each set that the next insertion replaces, `num_sets` entries. */
+    uint8_t *next_way;
+    /** The number of sets, a power of two. */
+    size_t num_sets;
+    /** A spinlock held while the keys are read or written. */
+    volatile long lock;
+} VerifyCache;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+C_KZG_RET verify_cache_init(VerifyCache *cache, size_t capacity);
+void verify_cache_free(VerifyCache *cache);
+void verify_cache_contains_many(VerifyCache *cache, bool *hits_out, const Bytes32 *keys, size_t n);
+void verify_cache_insert_many(VerifyCache *cache, const Bytes32 *keys, size_t n);
+void compute_verify_cache_key(
+    Bytes32 *key_out,
+    const char *domain,
+    const Bytes48 *commitment_bytes,
+    uint64_t index,
+    const uint8_t *data,
+    size_t data_len,
+    const Bytes48 *proof_bytes
+);
+
+#ifdef __cplusplus
+}
+#endif
@@ -15,6 +15,7 @@
  */
 
 #include "common/ec.h"
+#include "common/alloc.h"
 #include "common/bytes.h"
 
 #include <stdio.h> /* For printf */
@@ -45,6 +46,82 @@ void g1_mul(g1_t *out, const g1_t *a, const fr_t *b) {
     blst_p1_mult(out, a, s.b, BITS_PER_FIELD_ELEMENT);
 }
 
+/**
+ * Precompute a table for fixed-base multiplication of a G1 group element.
+ *
+ * Window `i` of the table holds the multiples `[j * 2^(8i)]base` for `j` in `1..255`, so that a
+ * multiplication only needs one mixed addition per non-zero byte of the scalar and no doublings.
+ *
+ * @param[out]  table_out   The table, length `FIXED_BASE_TABLE_SIZE`
+ * @param[in]   base        The G1 group element to precompute multiples of
+ *
+ * @remark The base must not be the point at infinity.
+ */
+C_KZG_RET g1_fixed_base_precompute(blst_p1_affine *table_out, const g1_t *base) {
+    C_KZG_RET ret;
+    g1_t *points = NULL;
+    g1_t window_base = *base;
+
+    ret = new_g1_array(&points, FIXED_BASE_TABLE_SIZE);
+    if (ret != C_KZG_OK) goto out;
+
+    for (size_t i = 0; i < FIXED_BASE_NUM_WINDOWS; i++) {
+        g1_t *window = &points[i * FIXED_BASE_WINDOW_SIZE];
+
+        /* Fill the window with [1 * 2^(8i)]base ... [255 * 2^(8i)]base */
+        window[0] = window_base;
+        for (size_t j = 1; j < FIXED_BASE_WINDOW_SIZE; j++) {
+            blst_p1_add_or_double(&window[j], &window[j - 1], &window_base);
+        }
+
+        /* The base for the next window is [256 * 2^(8i)]base */
+        blst_p1_add_or_double(&window_base, &window[FIXED_BASE_WINDOW_SIZE - 1], &window_base);
+    }
+
+    /* Store the table in affine form, so that lookups can use mixed additions */
+    const blst_p1 *points_arg[2] = {points, NULL};
+    blst_p1s_to_affine(table_out, points_arg, FIXED_BASE_TABLE_SIZE);
+
+out:
+    c_kzg_free(points);
+    return ret;
+}
+
+/**
+ * Multiply a fixed G1 group element by a field element, using a precomputed table.
+ *
+ * @param[out]  out     The result, `[b]base`
+ * @param[in]   table   The table for `base`, from g1_fixed_base_precompute()
+ * @param[in]   b       The multiplier
+ *
+ * @remark This is not constant-time. Only use it with public scalars.
+ */
+void g1_mul_fixed_base(g1_t *out, const blst_p1_affine *table, const fr_t *b) {
+    blst_scalar s;
+    blst_scalar_from_fr(&s, b);
+
+    *out = G1_IDENTITY;
+    for (size_t i = 0; i < FIXED_BASE_NUM_WINDOWS; i++) {
+        /* The scalar bytes are little-endian, byte i selects a multiple from window i */
+        size_t digit = s.b[i];
+        if (digit == 0) continue;
+        blst_p1_add_or_double_affine(out, out, &table[i * FIXED_BASE_WINDOW_SIZE + digit - 1]);
+    }
+}
+
+/**
+ * Multiply a G2 group element by a field element.
+ *
+ * @param[out]  out The result, `a * b`
+ * @param[in]   a   The G2 group element
+ * @param[in]   b   The multiplier
+ */
+void g2_mul(g2_t *out, const g2_t *a, const fr_t *b) {
+    blst_scalar s;
+    blst_scalar_from_fr(&s, b);
+    blst_p2_mult(out, a, s.b, BITS_PER_FIELD_ELEMENT);
+}
+
 /**
  * Print a G1 point to the console.
  *
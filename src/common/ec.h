@@ -18,6 +18,28 @@
 
 #include "blst.h"
 #include "common/fr.h"
+#include "common/ret.h"
+
+#include <stddef.h> /* For size_t */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Macros
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/** The number of scalar bits covered by each window of a fixed-base table. */
+#define FIXED_BASE_WINDOW_BITS 8
+
+/** The number of windows in a fixed-base table, enough to cover a 256-bit scalar. */
+#define FIXED_BASE_NUM_WINDOWS 32
+
+/** The number of non-zero multiples stored for each window of a fixed-base table. */
+#define FIXED_BASE_WINDOW_SIZE ((1 << FIXED_BASE_WINDOW_BITS) - 1)
+
+/** The number of points in a fixed-base table. */
+#define FIXED_BASE_TABLE_SIZE (FIXED_BASE_NUM_WINDOWS * FIXED_BASE_WINDOW_SIZE)
+
+/** The number of prepared lines blst uses for a Miller loop with a fixed G2 point. */
+#define NUM_G2_LINES 68
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Types
@@ -45,6 +67,9 @@ extern "C" {
 
 void g1_sub(g1_t *out, const g1_t *a, const g1_t *b);
 void g1_mul(g1_t *out, const g1_t *a, const fr_t *b);
+C_KZG_RET g1_fixed_base_precompute(blst_p1_affine *table_out, const g1_t *base);
+void g1_mul_fixed_base(g1_t *out, const blst_p1_affine *table, const fr_t *b);
+void g2_mul(g2_t *out, const g2_t *a, const fr_t *b);
 void print_g1(const g1_t *g);
 
 #ifdef __cplusplus
@@ -18,6 +18,7 @@
 #include "common/alloc.h"
 
 #include <stdlib.h> /* For NULL */
+#include <string.h> /* For memset */
 
 /**
  * Calculate a linear combination of G1 group elements.
@@ -121,3 +122,113 @@ out:
     c_kzg_free(scalars);
     return ret;
 }
+
+/**
+ * Convert G1 group elements to affine representation.
+ *
+ * Infinity points are converted to the all-zero affine point, which blst treats as infinity. They
+ * are kept out of the batch conversion, since a single zero Z coordinate would break the shared
+ * inversion for every point.
+ *
+ * @param[out]  out The points in affine representation, length `len`
+ * @param[in]   p   Array of G1 group elements, length `len`
+ * @param[in]   len The number of group elements
+ */
+C_KZG_RET g1s_to_affine(blst_p1_affine *out, const g1_t *p, size_t len) {
+    C_KZG_RET ret;
+    blst_p1 *p_filtered = NULL;
+    blst_p1_affine *p_affine = NULL;
+
+    /* Allocate space for arrays */
+    ret = c_kzg_calloc((void **)&p_filtered, len, sizeof(blst_p1));
+    if (ret != C_KZG_OK) goto out;
+    ret = c_kzg_calloc((void **)&p_affine, len, sizeof(blst_p1_affine));
+    if (ret != C_KZG_OK) goto out;
+
+    /* Filter out zero points */
+    size_t new_len = 0;
+    for (size_t i = 0; i < len; i++) {
+        if (!blst_p1_is_inf(&p[i])) {
+            p_filtered[new_len++] = p[i];
+        }
+    }
+
+    /* Transform the non-zero points to affine representation */
+    if (new_len > 0) {
+        const blst_p1 *p_arg[2] = {p_filtered, NULL};
+        blst_p1s_to_affine(p_affine, p_arg, new_len);
+    }
+
+    /* Put the points back in their original positions */
+    size_t j = 0;
+    for (size_t i = 0; i < len; i++) {
+        if (blst_p1_is_inf(&p[i])) {
+            memset(&out[i], 0, sizeof(blst_p1_affine));
+        } else {
+            out[i] = p_affine[j++];
+        }
+    }
+
+out:
+    c_kzg_free(p_filtered);
+    c_kzg_free(p_affine);
+    return ret;
+}
+
+/**
+ * Calculate a linear combination of G1 group elements already in affine representation.
+ *
+ * This is the same as g1_lincomb_fast(), for callers that use the same points in several
+ * combinations and only want to pay for the conversion to affine once.
+ *
+ * @param[out]  out     The resulting sum-product
+ * @param[in]   p       Array of G1 group elements in affine representation, length `len`
+ * @param[in]   coeffs  Array of field elements, length `len`
+ * @param[in]   len     The number of group/field elements
+ *
+ * @remark This function returns G1_IDENTITY if called with the empty set as input.
+ */
+C_KZG_RET g1_lincomb_affine(g1_t *out, const blst_p1_affine *p, const fr_t *coeffs, size_t len) {
+    C_KZG_RET ret;
+    limb_t *scratch = NULL;
+    blst_p1_affine *p_filtered = NULL;
+    blst_scalar *scalars = NULL;
+
+    /* Allocate space for arrays */
+    ret = c_kzg_calloc((void **)&p_filtered, len, sizeof(blst_p1_affine));
+    if (ret != C_KZG_OK) goto out;
+    ret = c_kzg_calloc((void **)&scalars, len, sizeof(blst_scalar));
+    if (ret != C_KZG_OK) goto out;
+
+    /* Allocate space for Pippenger scratch */
+    size_t scratch_size = blst_p1s_mult_pippenger_scratch_sizeof(len);
+    ret = c_kzg_malloc((void **)&scratch, scratch_size);
+    if (ret != C_KZG_OK) goto out;
+
+    /* Filter out zero points, and transform the matching field elements to 256-bit scalars */
+    size_t new_len = 0;
+    for (size_t i = 0; i < len; i++) {
+        if (!blst_p1_affine_is_inf(&p[i])) {
+            p_filtered[new_len] = p[i];
+            blst_scalar_from_fr(&scalars[new_len], &coeffs[i]);
+            new_len++;
+        }
+    }
+
+    /* We were either given no inputs, or all zero inputs: return the point at infinity */
+    if (new_len == 0) {
+        *out = G1_IDENTITY;
+        goto out;
+    }
+
+    /* Call the Pippenger implementation */
+    const byte *scalars_arg[2] = {(byte *)scalars, NULL};
+    const blst_p1_affine *points_arg[2] = {p_filtered, NULL};
+    blst_p1s_mult_pippenger(out, points_arg, new_len, scalars_arg, BITS_PER_FIELD_ELEMENT, scratch);
+
+out:
+    c_kzg_free(scratch);
+    c_kzg_free(p_filtered);
+    c_kzg_free(scalars);
+    return ret;
+}
@@ -194,3 +194,86 @@ bool pairings_verify(const g1_t *a1, const g2_t *a2, const g1_t *b1, const g2_t
 
     return blst_fp12_is_one(&gt_point);
 }
+
+/**
+ * Test whether a product of pairings is one in G_T.
+ *
+ * Tests whether `e(g1s[0], g2s[0]) * ... * e(g1s[n - 1], g2s[n - 1]) == 1`. The Miller loops are
+ * multiplied together first, so that the whole product takes a single final exponentiation.
+ *
+ * @param[in]   g1s The G1 group points, length `n`
+ * @param[in]   g2s The G2 group points, length `n`
+ * @param[in]   n   The number of pairings
+ *
+ * @retval true  The product was one
+ * @retval false The product was not one
+ */
+bool pairings_product_is_one(const g1_t *g1s, const g2_t *g2s, size_t n) {
+    blst_fp12 loop, gt_point = *blst_fp12_one();
+    blst_p1_affine aa1;
+    blst_p2_affine aa2;
+
+    for (size_t i = 0; i < n; i++) {
+        /* The pairing with the point at infinity is one, so it can be left out */
+        if (blst_p1_is_inf(&g1s[i]) || blst_p2_is_inf(&g2s[i])) continue;
+
+        blst_p1_to_affine(&aa1, &g1s[i]);
+        blst_p2_to_affine(&aa2, &g2s[i]);
+        blst_miller_loop(&loop, &aa2, &aa1);
+        blst_fp12_mul(&gt_point, &gt_point, &loop);
+    }
+    blst_final_exp(&gt_point, &gt_point);
+
+    return blst_fp12_is_one(&gt_point);
+}
+
+/**
+ * Perform pairings with prepared G2 points and test whether the outcomes are equal in G_T.
+ *
+ * Tests whether `e(a1, a2) == e(b1, b2)`, where the G2 points are given as the lines from
+ * blst_precompute_lines(). This skips the G2 side of both Miller loops.
+ *
+ * @param[in]   a1          A G1 group point for the first pairing
+ * @param[in]   a2_lines    The prepared lines of the G2 point for the first pairing
+ * @param[in]   b1          A G1 group point for the second pairing
+ * @param[in]   b2_lines    The prepared lines of the G2 point for the second pairing
+ *
+ * @retval true  The pairings were equal
+ * @retval false The pairings were not equal
+ */
+bool pairings_verify_lines(
+    const g1_t *a1, const blst_fp6 *a2_lines, const g1_t *b1, const blst_fp6 *b2_lines
+) {
+    blst_fp12 loop0, loop1, gt_point;
+    blst_p1_affine aa1, bb1;
+
+    /*
+     * As an optimisation, we want to invert one of the pairings,
+     * so we negate one of the points.
+     */
+    g1_t a1neg = *a1;
+    blst_p1_cneg(&a1neg, true);
+
+    blst_p1_to_affine(&aa1, &a1neg);
+    blst_p1_to_affine(&bb1, b1);
+
+    /*
+     * The lines are evaluated at the G1 point directly, which does not account for the point at
+     * infinity. Its pairing with anything is one, so use that instead.
+     */
+    if (blst_p1_is_inf(a1)) {
+        loop0 = *blst_fp12_one();
+    } else {
+        blst_miller_loop_lines(&loop0, a2_lines, &aa1);
+    }
+    if (blst_p1_is_inf(b1)) {
+        loop1 = *blst_fp12_one();
+    } else {
+        blst_miller_loop_lines(&loop1, b2_lines, &bb1);
+    }
+
+    blst_fp12_mul(&gt_point, &loop0, &loop1);
+    blst_final_exp(&gt_point, &gt_point);
+
+    return blst_fp12_is_one(&gt_point);
+}
@@ -16,6 +16,7 @@
 
 #include "eip4844/eip4844.h"
 #include "common/alloc.h"
+#include "common/cache.h"
 #include "common/ec.h"
 #include "common/fr.h"
 #include "common/lincomb.h"
@@ -37,6 +38,9 @@
 /* Input size to the Fiat-Shamir challenge computation. */
 #define CHALLENGE_INPUT_SIZE (DOMAIN_STR_LENGTH + 16 + BYTES_PER_BLOB + BYTES_PER_COMMITMENT)
 
+/** The number of claims an accumulator can hold before it first needs to grow. */
+#define POINT_EVAL_ACCUMULATOR_INITIAL_CAPACITY 16
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Constants
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -47,6 +51,9 @@ static const char *FIAT_SHAMIR_PROTOCOL_DOMAIN = "FSBLOBVERIFY_V1_";
 /** The domain separator for verify_blob_kzg_proof's random challenge. */
 static const char *RANDOM_CHALLENGE_DOMAIN_VERIFY_BLOB_KZG_PROOF_BATCH = "RCKZGBATCH___V1_";
 
+/** The domain separator for the verify cache keys of blob proofs. */
+static const char *VERIFY_CACHE_DOMAIN_BLOB_KZG_PROOF = "VCBLOBKZGPROOFV1";
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper Functions
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -105,32 +112,6 @@ static C_KZG_RET fr_batch_inv(fr_t *out, const fr_t *a, int len) {
     return C_KZG_OK;
 }
 
-/**
- * Multiply a G2 group element by a field element.
- *
- * @param[out]  out The result, `a * b`
- * @param[in]   a   The G2 group element
- * @param[in]   b   The multiplier
- */
-static void g2_mul(g2_t *out, const g2_t *a, const fr_t *b) {
-    blst_scalar s;
-    blst_scalar_from_fr(&s, b);
-    blst_p2_mult(out, a, s.b, BITS_PER_FIELD_ELEMENT);
-}
-
-/**
- * Subtraction of G2 group elements.
- *
- * @param[out]  out The result, `a - b`
- * @param[in]   a   A G2 group element
- * @param[in]   b   The G2 group element to be subtracted
- */
-static void g2_sub(g2_t *out, const g2_t *a, const g2_t *b) {
-    g2_t bneg = *b;
-    blst_p2_cneg(&bneg, true);
-    blst_p2_add_or_double(out, a, &bneg);
-}
-
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // BLS12-381 Helper Functions
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -279,6 +260,40 @@ out:
     return ret;
 }
 
+/**
+ * Convert some blobs to KZG commitments.
+ *
+ * @param[out]  out     The resulting commitments, length `n`
+ * @param[in]   blobs   The blobs representing the polynomials to be committed to
+ * @param[in]   n       The number of blobs
+ * @param[in]   s       The trusted setup
+ *
+ * @remark Stops at the first blob which fails, leaving the commitments of later blobs unwritten.
+ */
+C_KZG_RET blob_to_kzg_commitments(
+    KZGCommitment *out, const Blob *blobs, uint64_t n, const KZGSettings *s
+) {
+    C_KZG_RET ret;
+    fr_t *poly = NULL;
+    g1_t commitment;
+
+    ret = new_fr_array(&poly, FIELD_ELEMENTS_PER_BLOB);
+    if (ret != C_KZG_OK) goto out;
+
+    /* Reuse the same polynomial for each blob */
+    for (size_t i = 0; i < n; i++) {
+        ret = blob_to_polynomial(poly, &blobs[i]);
+        if (ret != C_KZG_OK) goto out;
+        ret = poly_to_kzg_commitment(&commitment, poly, s);
+        if (ret != C_KZG_OK) goto out;
+        bytes_from_g1(&out[i], &commitment);
+    }
+
+out:
+    c_kzg_free(poly);
+    return ret;
+}
+
 /* Forward function declaration */
 static C_KZG_RET verify_kzg_proof_impl(
     bool *ok,
@@ -348,19 +363,27 @@ static C_KZG_RET verify_kzg_proof_impl(
     const g1_t *proof,
     const KZGSettings *s
 ) {
-    g2_t x_g2, X_minus_z;
-    g1_t y_g1, P_minus_y;
+    g1_t y_g1, z_proof, lhs_g1;
 
-    /* Calculate: X_minus_z */
-    g2_mul(&x_g2, blst_p2_generator(), z);
-    g2_sub(&X_minus_z, &s->g2_values_monomial[1], &x_g2);
+    /*
+     * The textbook check is e(P - [y], G2) = e(Q, [s - z]G2), which needs a G2 multiplication by
+     * z on every call. Moving the z term to the other side gives the equivalent check
+     * e(P - [y] + [z]Q, G2) = e(Q, [s]G2), where both G2 points are fixed and all of the scalar
+     * multiplications happen in the cheaper G1 group.
+     */
 
-    /* Calculate: P_minus_y */
-    g1_mul(&y_g1, blst_p1_generator(), y);
-    g1_sub(&P_minus_y, commitment, &y_g1);
+    /* Calculate: [y], using the precomputed generator table */
+    g1_mul_fixed_base(&y_g1, s->g1_generator_table, y);
 
-    /* Verify: P - y = Q * (X - z) */
-    *ok = pairings_verify(&P_minus_y, blst_p2_generator(), proof, &X_minus_z);
+    /* Calculate: [z]Q */
+    g1_mul(&z_proof, proof, z);
+
+    /* Calculate: P - [y] + [z]Q */
+    g1_sub(&lhs_g1, commitment, &y_g1);
+    blst_p1_add_or_double(&lhs_g1, &lhs_g1, &z_proof);
+
+    /* Verify: P - [y] + [z]Q = Q * [s] */
+    *ok = pairings_verify(&lhs_g1, blst_p2_generator(), proof, &s->g2_values_monomial[1]);
 
     return C_KZG_OK;
 }
@@ -664,21 +687,107 @@ out:
 }
 
 /**
- * Helper function for verify_blob_kzg_proof_batch(): actually perform the verification.
+ * Check a batch of KZG proofs with the given random linear combination weights.
+ *
+ * @param[out]  ok              True if the proofs are valid, otherwise false
+ * @param[in]   commitments_g1  Array of commitments to verify
+ * @param[in]   zs_fr           Array of evaluation points for the KZG proofs
+ * @param[in]   ys_fr           Array of evaluation results for the KZG proofs
+ * @param[in]   proofs_g1       Array of proofs used for verification
+ * @param[in]   r_powers        Array of weights for the random linear combination
+ * @param[in]   n               The number of commitments/proofs
+ * @param[in]   s               The trusted setup
+ *
+ * @remark This function only works for `n > 0`.
+ * @remark The weights must be derived from (at least) all of the inputs being checked.
+ */
+static C_KZG_RET verify_kzg_proof_batch_with_r_powers(
+    bool *ok,
+    const g1_t *commitments_g1,
+    const fr_t *zs_fr,
+    const fr_t *ys_fr,
+    const g1_t *proofs_g1,
+    const fr_t *r_powers,
+    size_t n,
+    const KZGSettings *s
+) {
+    C_KZG_RET ret;
+    g1_t proof_lincomb, y_lincomb_g1, rhs_g1;
+    fr_t y_lincomb, r_times_y;
+    g1_t *msm_points = NULL;
+    fr_t *msm_scalars = NULL;
+
+    assert(n > 0);
+
+    *ok = false;
+
+    /* First let's allocate our arrays */
+    ret = new_g1_array(&msm_points, 2 * n);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_fr_array(&msm_scalars, 2 * n);
+    if (ret != C_KZG_OK) goto out;
+
+    /* Compute \sum r^i * Proof_i */
+    ret = g1_lincomb_fast(&proof_lincomb, proofs_g1, r_powers, n);
+    if (ret != C_KZG_OK) goto out;
+
+    /*
+     * Rather than computing each C_i - [y_i] separately, we fold the commitments and the z-scaled
+     * proofs into a single MSM and subtract the y terms with one generator multiplication:
+     *   \sum r^i (C_i - [y_i]) + \sum r^i z_i Proof_i
+     *     = (\sum r^i C_i + \sum r^i z_i Proof_i) - [\sum r^i y_i]
+     */
+    y_lincomb = FR_ZERO;
+    for (size_t i = 0; i < n; i++) {
+        /* The first half of the MSM is \sum r^i C_i */
+        msm_points[i] = commitments_g1[i];
+        msm_scalars[i] = r_powers[i];
+
+        /* The second half of the MSM is \sum r^i z_i Proof_i */
+        msm_points[n + i] = proofs_g1[i];
+        blst_fr_mul(&msm_scalars[n + i], &r_powers[i], &zs_fr[i]);
+
+        /* Get \sum r^i y_i */
+        blst_fr_mul(&r_times_y, &r_powers[i], &ys_fr[i]);
+        blst_fr_add(&y_lincomb, &y_lincomb, &r_times_y);
+    }
+
+    /* Get \sum r^i C_i + \sum r^i z_i Proof_i */
+    ret = g1_lincomb_fast(&rhs_g1, msm_points, msm_scalars, 2 * n);
+    if (ret != C_KZG_OK) goto out;
+
+    /* Get [\sum r^i y_i] */
+    g1_mul_fixed_base(&y_lincomb_g1, s->g1_generator_table, &y_lincomb);
+
+    /* Get \sum r^i (C_i - [y_i]) + \sum r^i z_i Proof_i */
+    g1_sub(&rhs_g1, &rhs_g1, &y_lincomb_g1);
+
+    /* Do the pairing check! */
+    *ok = pairings_verify(&proof_lincomb, &s->g2_values_monomial[1], &rhs_g1, blst_p2_generator());
+
+out:
+    c_kzg_free(msm_points);
+    c_kzg_free(msm_scalars);
+    return ret;
+}
+
+/**
+ * Helper function for verify_kzg_proof_batch() and verify_blob_kzg_proof_batch(): actually
+ * perform the verification.
  *
  * @param[out]  ok              True if the proofs are valid, otherwise false
  * @param[in]   commitments_g1  Array of commitments to verify
  * @param[in]   zs_fr           Array of evaluation points for the KZG proofs
  * @param[in]   ys_fr           Array of evaluation results for the KZG proofs
  * @param[in]   proofs_g1       Array of proofs used for verification
- * @param[in]   n               The number of blobs/commitments/proofs
+ * @param[in]   n               The number of commitments/proofs
  * @param[in]   s               The trusted setup
  *
  * @remark This function only works for `n > 0`.
  * @remark This function assumes that `n` is trusted and that all input arrays contain `n` elements.
  * `n` should be the actual size of the arrays and not read off a length field in the protocol.
  */
-static C_KZG_RET verify_kzg_proof_batch(
+static C_KZG_RET verify_kzg_proof_batch_impl(
     bool *ok,
     const g1_t *commitments_g1,
     const fr_t *zs_fr,
@@ -688,22 +797,14 @@ static C_KZG_RET verify_kzg_proof_batch(
     const KZGSettings *s
 ) {
     C_KZG_RET ret;
-    g1_t proof_lincomb, proof_z_lincomb, C_minus_y_lincomb, rhs_g1;
     fr_t *r_powers = NULL;
-    g1_t *C_minus_y = NULL;
-    fr_t *r_times_z = NULL;
 
     assert(n > 0);
 
     *ok = false;
 
-    /* First let's allocate our arrays */
     ret = new_fr_array(&r_powers, n);
     if (ret != C_KZG_OK) goto out;
-    ret = new_g1_array(&C_minus_y, n);
-    if (ret != C_KZG_OK) goto out;
-    ret = new_fr_array(&r_times_z, n);
-    if (ret != C_KZG_OK) goto out;
 
     /* Compute the random lincomb challenges */
     ret = compute_r_powers_for_verify_kzg_proof_batch(
@@ -711,55 +812,137 @@ static C_KZG_RET verify_kzg_proof_batch(
     );
     if (ret != C_KZG_OK) goto out;
 
-    /* Compute \sum r^i * Proof_i */
-    g1_lincomb_naive(&proof_lincomb, proofs_g1, r_powers, n);
-
-    for (size_t i = 0; i < n; i++) {
-        g1_t ys_encrypted;
-        /* Get [y_i] */
-        g1_mul(&ys_encrypted, blst_p1_generator(), &ys_fr[i]);
-        /* Get C_i - [y_i] */
-        g1_sub(&C_minus_y[i], &commitments_g1[i], &ys_encrypted);
-        /* Get r^i * z_i */
-        blst_fr_mul(&r_times_z[i], &r_powers[i], &zs_fr[i]);
-    }
-
-    /* Get \sum r^i z_i Proof_i */
-    g1_lincomb_naive(&proof_z_lincomb, proofs_g1, r_times_z, n);
-    /* Get \sum r^i (C_i - [y_i]) */
-    g1_lincomb_naive(&C_minus_y_lincomb, C_minus_y, r_powers, n);
-    /* Get C_minus_y_lincomb + proof_z_lincomb */
-    blst_p1_add_or_double(&rhs_g1, &C_minus_y_lincomb, &proof_z_lincomb);
-
-    /* Do the pairing check! */
-    *ok = pairings_verify(&proof_lincomb, &s->g2_values_monomial[1], &rhs_g1, blst_p2_generator());
+    ret = verify_kzg_proof_batch_with_r_powers(
+        ok, commitments_g1, zs_fr, ys_fr, proofs_g1, r_powers, n, s
+    );
 
 out:
     c_kzg_free(r_powers);
-    c_kzg_free(C_minus_y);
-    c_kzg_free(r_times_z);
     return ret;
 }
 
 /**
- * Given a list of blobs and blob KZG proofs, verify that they correspond to the provided
- * commitments.
+ * Find the invalid proofs in the sub-batch `[offset, offset + n)` by recursive bisection.
+ *
+ * Each sub-batch is checked with the slice of the weights that belongs to it. When a sub-batch
+ * fails it is split in two, and if the left half passes the right half is known to be invalid
+ * without checking it. A single invalid proof is therefore found with O(log n) batch checks.
+ *
+ * @param[out]      invalid_indices_out The indices of the invalid proofs are appended here
+ * @param[in,out]   num_invalid_out     The number of indices written to `invalid_indices_out`
+ * @param[in]       commitments_g1      Array of commitments for the whole batch
+ * @param[in]       zs_fr               Array of evaluation points for the whole batch
+ * @param[in]       ys_fr               Array of evaluation results for the whole batch
+ * @param[in]       proofs_g1           Array of proofs for the whole batch
+ * @param[in]       r_powers            Array of weights for the whole batch
+ * @param[in]       offset              The index of the first proof of the sub-batch
+ * @param[in]       n                   The number of proofs in the sub-batch
+ * @param[in]       known_invalid       True if the sub-batch is already known to be invalid
+ * @param[in]       s                   The trusted setup
+ */
+static C_KZG_RET locate_invalid_kzg_proofs(
+    uint64_t *invalid_indices_out,
+    uint64_t *num_invalid_out,
+    const g1_t *commitments_g1,
+    const fr_t *zs_fr,
+    const fr_t *ys_fr,
+    const g1_t *proofs_g1,
+    const fr_t *r_powers,
+    size_t offset,
+    size_t n,
+    bool known_invalid,
+    const KZGSettings *s
+) {
+    C_KZG_RET ret;
+    bool ok;
+
+    if (!known_invalid) {
+        if (n == 1) {
+            ret = verify_kzg_proof_impl(
+                &ok, &commitments_g1[offset], &zs_fr[offset], &ys_fr[offset], &proofs_g1[offset], s
+            );
+        } else {
+            ret = verify_kzg_proof_batch_with_r_powers(
+                &ok,
+                &commitments_g1[offset],
+                &zs_fr[offset],
+                &ys_fr[offset],
+                &proofs_g1[offset],
+                &r_powers[offset],
+                n,
+                s
+            );
+        }
+        if (ret != C_KZG_OK) return ret;
+        if (ok) return C_KZG_OK;
+    }
+
+    /* We have found an invalid proof */
+    if (n == 1) {
+        invalid_indices_out[(*num_invalid_out)++] = offset;
+        return C_KZG_OK;
+    }
+
+    size_t half = n / 2;
+    uint64_t num_invalid_before = *num_invalid_out;
+    ret = locate_invalid_kzg_proofs(
+        invalid_indices_out,
+        num_invalid_out,
+        commitments_g1,
+        zs_fr,
+        ys_fr,
+        proofs_g1,
+        r_powers,
+        offset,
+        half,
+        false,
+        s
+    );
+    if (ret != C_KZG_OK) return ret;
+
+    /* If the left half is valid, the right half must hold the invalid proofs */
+    bool right_known_invalid = *num_invalid_out == num_invalid_before;
+    return locate_invalid_kzg_proofs(
+        invalid_indices_out,
+        num_invalid_out,
+        commitments_g1,
+        zs_fr,
+        ys_fr,
+        proofs_g1,
+        r_powers,
+        offset + half,
+        n - half,
+        right_known_invalid,
+        s
+    );
+}
+
+/**
+ * Given a list of commitments, evaluation points, claimed evaluations, and KZG proofs, verify that
+ * each proof is valid. That is, verify that `p_i(z_i) == y_i` for the polynomial `p_i` committed to
+ * by the i-th commitment.
+ *
+ * The openings do not need to be related to each other: they can be for different commitments and
+ * different points. The claims are checked together with a random linear combination, which costs
+ * two MSMs and a single pairing check regardless of `n`.
  *
  * @param[out]  ok                  True if the proofs are valid, otherwise false
- * @param[in]   blobs               Array of blobs to verify
- * @param[in]   commitments_bytes   Array of commitments to verify
- * @param[in]   proofs_bytes        Array of proofs used for verification
- * @param[in]   n                   The number of blobs/commitments/proofs
+ * @param[in]   commitments_bytes   Array of commitments, length `n`
+ * @param[in]   zs_bytes            Array of evaluation points, length `n`
+ * @param[in]   ys_bytes            Array of claimed evaluation results, length `n`
+ * @param[in]   proofs_bytes        Array of proofs, length `n`
+ * @param[in]   n                   The number of openings
  * @param[in]   s                   The trusted setup
  *
  * @remark This function accepts if called with `n==0`.
  * @remark This function assumes that `n` is trusted and that all input arrays contain `n` elements.
  * `n` should be the actual size of the arrays and not read off a length field in the protocol.
  */
-C_KZG_RET verify_blob_kzg_proof_batch(
+C_KZG_RET verify_kzg_proof_batch(
     bool *ok,
-    const Blob *blobs,
     const Bytes48 *commitments_bytes,
+    const Bytes32 *zs_bytes,
+    const Bytes32 *ys_bytes,
     const Bytes48 *proofs_bytes,
     uint64_t n,
     const KZGSettings *s
@@ -767,19 +950,22 @@ C_KZG_RET verify_blob_kzg_proof_batch(
     C_KZG_RET ret;
     g1_t *commitments_g1 = NULL;
     g1_t *proofs_g1 = NULL;
-    fr_t *evaluation_challenges_fr = NULL;
+    fr_t *zs_fr = NULL;
     fr_t *ys_fr = NULL;
-    fr_t *poly = NULL;
 
-    /* Exit early if we are given zero blobs */
+    *ok = false;
+
+    /* Exit early if we are given zero openings */
     if (n == 0) {
         *ok = true;
         return C_KZG_OK;
     }
 
-    /* For a single blob, just do a regular single verification */
+    /* For a single opening, just do a regular single verification */
     if (n == 1) {
-        return verify_blob_kzg_proof(ok, &blobs[0], &commitments_bytes[0], &proofs_bytes[0], s);
+        return verify_kzg_proof(
+            ok, &commitments_bytes[0], &zs_bytes[0], &ys_bytes[0], &proofs_bytes[0], s
+        );
     }
 
     /* We will need a bunch of arrays to store our objects... */
@@ -787,42 +973,776 @@ C_KZG_RET verify_blob_kzg_proof_batch(
     if (ret != C_KZG_OK) goto out;
     ret = new_g1_array(&proofs_g1, (size_t)n);
     if (ret != C_KZG_OK) goto out;
-    ret = new_fr_array(&evaluation_challenges_fr, (size_t)n);
+    ret = new_fr_array(&zs_fr, (size_t)n);
     if (ret != C_KZG_OK) goto out;
     ret = new_fr_array(&ys_fr, (size_t)n);
     if (ret != C_KZG_OK) goto out;
-    ret = new_fr_array(&poly, FIELD_ELEMENTS_PER_BLOB);
-    if (ret != C_KZG_OK) goto out;
 
+    /* Convert untrusted inputs to trusted inputs */
     for (size_t i = 0; i < n; i++) {
-        /* Convert each commitment to a g1 point */
         ret = bytes_to_kzg_commitment(&commitments_g1[i], &commitments_bytes[i]);
         if (ret != C_KZG_OK) goto out;
-
-        /* Convert each blob from bytes to a poly */
-        ret = blob_to_polynomial(poly, &blobs[i]);
+        ret = bytes_to_bls_field(&zs_fr[i], &zs_bytes[i]);
         if (ret != C_KZG_OK) goto out;
-
-        compute_challenge(&evaluation_challenges_fr[i], &blobs[i], &commitments_g1[i]);
-
-        ret = evaluate_polynomial_in_evaluation_form(
-            &ys_fr[i], poly, &evaluation_challenges_fr[i], s
-        );
+        ret = bytes_to_bls_field(&ys_fr[i], &ys_bytes[i]);
         if (ret != C_KZG_OK) goto out;
-
         ret = bytes_to_kzg_proof(&proofs_g1[i], &proofs_bytes[i]);
         if (ret != C_KZG_OK) goto out;
     }
 
-    ret = verify_kzg_proof_batch(
-        ok, commitments_g1, evaluation_challenges_fr, ys_fr, proofs_g1, (size_t)n, s
-    );
+    ret = verify_kzg_proof_batch_impl(ok, commitments_g1, zs_fr, ys_fr, proofs_g1, (size_t)n, s);
 
 out:
     c_kzg_free(commitments_g1);
     c_kzg_free(proofs_g1);
-    c_kzg_free(evaluation_challenges_fr);
+    c_kzg_free(zs_fr);
     c_kzg_free(ys_fr);
+    return ret;
+}
+
+/**
+ * Compute the evaluation challenge of a blob, and the blob's evaluation at it.
+ *
+ * @param[out]  z_fr_out        The evaluation challenge
+ * @param[out]  y_fr_out        The blob evaluation at the challenge
+ * @param[out]  poly            Scratch space for the blob polynomial
+ * @param[in]   blob            The blob
+ * @param[in]   commitment_g1   The validated commitment to the blob
+ * @param[in]   s               The trusted setup
+ */
+static C_KZG_RET compute_blob_evaluation(
+    fr_t *z_fr_out,
+    fr_t *y_fr_out,
+    fr_t *poly,
+    const Blob *blob,
+    const g1_t *commitment_g1,
+    const KZGSettings *s
+) {
+    C_KZG_RET ret;
+
+    /* Convert the blob from bytes to a poly */
+    ret = blob_to_polynomial(poly, blob);
+    if (ret != C_KZG_OK) return ret;
+
+    compute_challenge(z_fr_out, blob, commitment_g1);
+
+    return evaluate_polynomial_in_evaluation_form(y_fr_out, poly, z_fr_out, s);
+}
+
+/**
+ * Compute the evaluation challenge of each blob, and the blob's evaluation at it.
+ *
+ * @param[out]  zs_fr_out       The evaluation challenges, length `n`
+ * @param[out]  ys_fr_out       The blob evaluations at the challenges, length `n`
+ * @param[in]   blobs           Array of blobs, length `n`
+ * @param[in]   commitments_g1  The validated commitments to the blobs, length `n`
+ * @param[in]   n               The number of blobs/commitments
+ * @param[in]   s               The trusted setup
+ */
+static C_KZG_RET compute_blob_evaluations(
+    fr_t *zs_fr_out,
+    fr_t *ys_fr_out,
+    const Blob *blobs,
+    const g1_t *commitments_g1,
+    uint64_t n,
+    const KZGSettings *s
+) {
+    C_KZG_RET ret;
+    fr_t *poly = NULL;
+
+    ret = new_fr_array(&poly, FIELD_ELEMENTS_PER_BLOB);
+    if (ret != C_KZG_OK) goto out;
+
+    for (size_t i = 0; i < n; i++) {
+        ret = compute_blob_evaluation(
+            &zs_fr_out[i], &ys_fr_out[i], poly, &blobs[i], &commitments_g1[i], s
+        );
+        if (ret != C_KZG_OK) goto out;
+    }
+
+out:
     c_kzg_free(poly);
     return ret;
 }
+
+/**
+ * Helper function for verify_blob_kzg_proof_batch(), verify_blob_kzg_proof_batch_locate(),
+ * unified_verify_accumulator_add_blob() and the verification coalescer: decode the inputs and
+ * compute the evaluation challenges and the evaluations at them.
+ *
+ * @param[out]  commitments_g1_out  The decoded commitments, length `n`
+ * @param[out]  zs_fr_out           The evaluation challenges, length `n`
+ * @param[out]  ys_fr_out           The blob evaluations at the challenges, length `n`
+ * @param[out]  proofs_g1_out       The decoded proofs, length `n`
+ * @param[in]   blobs               Array of blobs to verify
+ * @param[in]   commitments_bytes   Array of commitments to verify
+ * @param[in]   proofs_bytes        Array of proofs used for verification
+ * @param[in]   n                   The number of blobs/commitments/proofs
+ * @param[in]   s                   The trusted setup
+ */
+C_KZG_RET prepare_blob_kzg_proof_batch(
+    g1_t *commitments_g1_out,
+    fr_t *zs_fr_out,
+    fr_t *ys_fr_out,
+    g1_t *proofs_g1_out,
+    const Blob *blobs,
+    const Bytes48 *commitments_bytes,
+    const Bytes48 *proofs_bytes,
+    uint64_t n,
+    const KZGSettings *s
+) {
+    C_KZG_RET ret;
+
+    /* Do conversions first to fail fast, compute_challenge is expensive */
+    for (size_t i = 0; i < n; i++) {
+        ret = bytes_to_kzg_commitment(&commitments_g1_out[i], &commitments_bytes[i]);
+        if (ret != C_KZG_OK) return ret;
+        ret = bytes_to_kzg_proof(&proofs_g1_out[i], &proofs_bytes[i]);
+        if (ret != C_KZG_OK) return ret;
+    }
+
+    return compute_blob_evaluations(zs_fr_out, ys_fr_out, blobs, commitments_g1_out, n, s);
+}
+
+/**
+ * Helper function for verify_blob_kzg_proof_batch(): verify some of the proofs without consulting
+ * the verify cache.
+ *
+ * @param[out]  ok                  True if the proofs are valid, otherwise false
+ * @param[in]   blobs               Array of blobs to verify
+ * @param[in]   commitments_bytes   Array of commitments to verify
+ * @param[in]   proofs_bytes        Array of proofs used for verification
+ * @param[in]   indices             The entries of the arrays to verify, or NULL for the first `n`
+ * @param[in]   n                   The number of entries to verify
+ * @param[in]   s                   The trusted setup
+ */
+static C_KZG_RET verify_blob_kzg_proof_batch_uncached(
+    bool *ok,
+    const Blob *blobs,
+    const Bytes48 *commitments_bytes,
+    const Bytes48 *proofs_bytes,
+    const size_t *indices,
+    size_t n,
+    const KZGSettings *s
+) {
+    C_KZG_RET ret;
+    g1_t *commitments_g1 = NULL;
+    g1_t *proofs_g1 = NULL;
+    fr_t *evaluation_challenges_fr = NULL;
+    fr_t *ys_fr = NULL;
+    fr_t *poly = NULL;
+
+    /* Exit early if we are given zero blobs */
+    if (n == 0) {
+        *ok = true;
+        return C_KZG_OK;
+    }
+
+    /* For a single blob, just do a regular single verification */
+    if (n == 1) {
+        size_t j = indices == NULL ? 0 : indices[0];
+        return verify_blob_kzg_proof(ok, &blobs[j], &commitments_bytes[j], &proofs_bytes[j], s);
+    }
+
+    /* We will need a bunch of arrays to store our objects... */
+    ret = new_g1_array(&commitments_g1, n);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_g1_array(&proofs_g1, n);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_fr_array(&evaluation_challenges_fr, n);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_fr_array(&ys_fr, n);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_fr_array(&poly, FIELD_ELEMENTS_PER_BLOB);
+    if (ret != C_KZG_OK) goto out;
+
+    /* Do conversions first to fail fast, compute_challenge is expensive */
+    for (size_t i = 0; i < n; i++) {
+        size_t j = indices == NULL ? i : indices[i];
+        ret = bytes_to_kzg_commitment(&commitments_g1[i], &commitments_bytes[j]);
+        if (ret != C_KZG_OK) goto out;
+        ret = bytes_to_kzg_proof(&proofs_g1[i], &proofs_bytes[j]);
+        if (ret != C_KZG_OK) goto out;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        size_t j = indices == NULL ? i : indices[i];
+        ret = compute_blob_evaluation(
+            &evaluation_challenges_fr[i], &ys_fr[i], poly, &blobs[j], &commitments_g1[i], s
+        );
+        if (ret != C_KZG_OK) goto out;
+    }
+
+    ret = verify_kzg_proof_batch_impl(
+        ok, commitments_g1, evaluation_challenges_fr, ys_fr, proofs_g1, n, s
+    );
+
+out:
+    c_kzg_free(commitments_g1);
+    c_kzg_free(proofs_g1);
+    c_kzg_free(evaluation_challenges_fr);
+    c_kzg_free(ys_fr);
+    c_kzg_free(poly);
+    return ret;
+}
+
+/**
+ * Given a list of blobs and blob KZG proofs, verify that they correspond to the provided
+ * commitments.
+ *
+ * @param[out]  ok                  True if the proofs are valid, otherwise false
+ * @param[in]   blobs               Array of blobs to verify
+ * @param[in]   commitments_bytes   Array of commitments to verify
+ * @param[in]   proofs_bytes        Array of proofs used for verification
+ * @param[in]   n                   The number of blobs/commitments/proofs
+ * @param[in]   s                   The trusted setup
+ *
+ * @remark This function accepts if called with `n==0`.
+ * @remark If the settings have a verify cache, proofs that were accepted before are skipped, and
+ * the proofs accepted now are added to it.
+ * @remark This function assumes that `n` is trusted and that all input arrays contain `n` elements.
+ * `n` should be the actual size of the arrays and not read off a length field in the protocol.
+ */
+C_KZG_RET verify_blob_kzg_proof_batch(
+    bool *ok,
+    const Blob *blobs,
+    const Bytes48 *commitments_bytes,
+    const Bytes48 *proofs_bytes,
+    uint64_t n,
+    const KZGSettings *s
+) {
+    C_KZG_RET ret;
+    Bytes32 *keys = NULL;
+    bool *is_cached = NULL;
+    size_t *uncached_indices = NULL;
+    size_t num_uncached = 0;
+
+    if (s->verify_cache == NULL || n == 0) {
+        return verify_blob_kzg_proof_batch_uncached(
+            ok, blobs, commitments_bytes, proofs_bytes, NULL, (size_t)n, s
+        );
+    }
+
+    *ok = false;
+
+    ret = c_kzg_calloc((void **)&keys, (size_t)n, sizeof(Bytes32));
+    if (ret != C_KZG_OK) goto out;
+    ret = new_bool_array(&is_cached, (size_t)n);
+    if (ret != C_KZG_OK) goto out;
+
+    for (size_t i = 0; i < n; i++) {
+        compute_verify_cache_key(
+            &keys[i],
+            VERIFY_CACHE_DOMAIN_BLOB_KZG_PROOF,
+            &commitments_bytes[i],
+            0,
+            blobs[i].bytes,
+            BYTES_PER_BLOB,
+            &proofs_bytes[i]
+        );
+    }
+    verify_cache_contains_many(s->verify_cache, is_cached, keys, (size_t)n);
+
+    for (size_t i = 0; i < n; i++) {
+        if (!is_cached[i]) num_uncached++;
+    }
+
+    /* Exit early if every proof was accepted before */
+    if (num_uncached == 0) {
+        *ok = true;
+        goto out;
+    }
+
+    ret = c_kzg_calloc((void **)&uncached_indices, num_uncached, sizeof(size_t));
+    if (ret != C_KZG_OK) goto out;
+
+    /* Index the proofs that still need verifying, keeping their keys in step */
+    num_uncached = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (is_cached[i]) continue;
+        uncached_indices[num_uncached] = i;
+        keys[num_uncached] = keys[i];
+        num_uncached++;
+    }
+
+    ret = verify_blob_kzg_proof_batch_uncached(
+        ok, blobs, commitments_bytes, proofs_bytes, uncached_indices, num_uncached, s
+    );
+    if (ret != C_KZG_OK) goto out;
+
+    /* Only remember the proofs once they have all been accepted */
+    if (*ok) verify_cache_insert_many(s->verify_cache, keys, num_uncached);
+
+out:
+    c_kzg_free(keys);
+    c_kzg_free(is_cached);
+    c_kzg_free(uncached_indices);
+    return ret;
+}
+
+/**
+ * Given a list of blobs and blob KZG proofs, verify that they correspond to the provided
+ * commitments, and find the ones that do not.
+ *
+ * The whole batch is checked first. Only if that fails is it bisected to find the invalid items,
+ * reusing the decoded inputs, the evaluation challenges, and the batch weights throughout.
+ *
+ * @param[out]  ok                  True if the proofs are valid, otherwise false
+ * @param[out]  invalid_indices_out The indices of the invalid items in ascending order, length `n`
+ * @param[out]  num_invalid_out     The number of indices written to `invalid_indices_out`
+ * @param[in]   blobs               Array of blobs to verify
+ * @param[in]   commitments_bytes   Array of commitments to verify
+ * @param[in]   proofs_bytes        Array of proofs used for verification
+ * @param[in]   n                   The number of blobs/commitments/proofs
+ * @param[in]   s                   The trusted setup
+ *
+ * @remark This function accepts if called with `n==0`.
+ * @remark This function assumes that `n` is trusted and that all input arrays contain `n` elements.
+ * `n` should be the actual size of the arrays and not read off a length field in the protocol.
+ */
+C_KZG_RET verify_blob_kzg_proof_batch_locate(
+    bool *ok,
+    uint64_t *invalid_indices_out,
+    uint64_t *num_invalid_out,
+    const Blob *blobs,
+    const Bytes48 *commitments_bytes,
+    const Bytes48 *proofs_bytes,
+    uint64_t n,
+    const KZGSettings *s
+) {
+    C_KZG_RET ret;
+    g1_t *commitments_g1 = NULL;
+    g1_t *proofs_g1 = NULL;
+    fr_t *evaluation_challenges_fr = NULL;
+    fr_t *ys_fr = NULL;
+    fr_t *r_powers = NULL;
+
+    *ok = false;
+    *num_invalid_out = 0;
+
+    /* Exit early if we are given zero blobs */
+    if (n == 0) {
+        *ok = true;
+        return C_KZG_OK;
+    }
+
+    /* We will need a bunch of arrays to store our objects... */
+    ret = new_g1_array(&commitments_g1, (size_t)n);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_g1_array(&proofs_g1, (size_t)n);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_fr_array(&evaluation_challenges_fr, (size_t)n);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_fr_array(&ys_fr, (size_t)n);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_fr_array(&r_powers, (size_t)n);
+    if (ret != C_KZG_OK) goto out;
+
+    ret = prepare_blob_kzg_proof_batch(
+        commitments_g1,
+        evaluation_challenges_fr,
+        ys_fr,
+        proofs_g1,
+        blobs,
+        commitments_bytes,
+        proofs_bytes,
+        n,
+        s
+    );
+    if (ret != C_KZG_OK) goto out;
+
+    /* Compute the random lincomb challenges once, every sub-batch uses its slice of them */
+    ret = compute_r_powers_for_verify_kzg_proof_batch(
+        r_powers, commitments_g1, evaluation_challenges_fr, ys_fr, proofs_g1, (size_t)n
+    );
+    if (ret != C_KZG_OK) goto out;
+
+    ret = locate_invalid_kzg_proofs(
+        invalid_indices_out,
+        num_invalid_out,
+        commitments_g1,
+        evaluation_challenges_fr,
+        ys_fr,
+        proofs_g1,
+        r_powers,
+        0,
+        (size_t)n,
+        false,
+        s
+    );
+    if (ret != C_KZG_OK) goto out;
+
+    *ok = *num_invalid_out == 0;
+
+out:
+    c_kzg_free(commitments_g1);
+    c_kzg_free(proofs_g1);
+    c_kzg_free(evaluation_challenges_fr);
+    c_kzg_free(ys_fr);
+    c_kzg_free(r_powers);
+    return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Point Evaluation Accumulator
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Initialize an empty point evaluation accumulator.
+ *
+ * @param[out]  acc The accumulator to initialize
+ *
+ * @remark Release the accumulator's memory later with kzg_point_eval_accumulator_free().
+ */
+void kzg_point_eval_accumulator_init(KZGPointEvalAccumulator *acc) {
+    acc->commitments = NULL;
+    acc->zs = NULL;
+    acc->ys = NULL;
+    acc->proofs = NULL;
+    acc->length = 0;
+    acc->capacity = 0;
+}
+
+/**
+ * Free the memory held by a point evaluation accumulator. Any claims it holds are discarded.
+ *
+ * @param[in]   acc The accumulator to free
+ */
+void kzg_point_eval_accumulator_free(KZGPointEvalAccumulator *acc) {
+    if (acc == NULL) return;
+    c_kzg_free(acc->commitments);
+    c_kzg_free(acc->zs);
+    c_kzg_free(acc->ys);
+    c_kzg_free(acc->proofs);
+    acc->length = 0;
+    acc->capacity = 0;
+}
+
+/**
+ * Double the capacity of a point evaluation accumulator, keeping the claims it holds.
+ *
+ * @param[in,out]   acc The accumulator to grow
+ */
+static C_KZG_RET point_eval_accumulator_grow(KZGPointEvalAccumulator *acc) {
+    C_KZG_RET ret;
+    g1_t *commitments = NULL;
+    fr_t *zs = NULL;
+    fr_t *ys = NULL;
+    g1_t *proofs = NULL;
+    size_t capacity = acc->capacity == 0 ? POINT_EVAL_ACCUMULATOR_INITIAL_CAPACITY
+                                         : 2 * acc->capacity;
+
+    ret = new_g1_array(&commitments, capacity);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_fr_array(&zs, capacity);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_fr_array(&ys, capacity);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_g1_array(&proofs, capacity);
+    if (ret != C_KZG_OK) goto out;
+
+    if (acc->length > 0) {
+        memcpy(commitments, acc->commitments, acc->length * sizeof(g1_t));
+        memcpy(zs, acc->zs, acc->length * sizeof(fr_t));
+        memcpy(ys, acc->ys, acc->length * sizeof(fr_t));
+        memcpy(proofs, acc->proofs, acc->length * sizeof(g1_t));
+    }
+
+    /* Hand the old arrays to the cleanup below, and keep the new ones */
+    g1_t *old_commitments = acc->commitments;
+    fr_t *old_zs = acc->zs;
+    fr_t *old_ys = acc->ys;
+    g1_t *old_proofs = acc->proofs;
+    acc->commitments = commitments;
+    acc->zs = zs;
+    acc->ys = ys;
+    acc->proofs = proofs;
+    acc->capacity = capacity;
+    commitments = old_commitments;
+    zs = old_zs;
+    ys = old_ys;
+    proofs = old_proofs;
+
+out:
+    c_kzg_free(commitments);
+    c_kzg_free(zs);
+    c_kzg_free(ys);
+    c_kzg_free(proofs);
+    return ret;
+}
+
+/**
+ * Add a point evaluation claim to an accumulator, deferring its verification to
+ * kzg_point_eval_accumulator_finalize().
+ *
+ * The inputs are validated immediately, so malformed inputs are rejected here exactly as
+ * verify_kzg_proof() would reject them. Only the pairing check is deferred.
+ *
+ * @param[in,out]   acc                 The accumulator
+ * @param[in]       commitment_bytes    The commitment to verify
+ * @param[in]       z_bytes             The evaluation point
+ * @param[in]       y_bytes             The claimed evaluation result
+ * @param[in]       proof_bytes         The KZG proof
+ *
+ * @remark The accumulator is left unchanged if this returns an error.
+ */
+C_KZG_RET kzg_point_eval_accumulator_add(
+    KZGPointEvalAccumulator *acc,
+    const Bytes48 *commitment_bytes,
+    const Bytes32 *z_bytes,
+    const Bytes32 *y_bytes,
+    const Bytes48 *proof_bytes
+) {
+    C_KZG_RET ret;
+    g1_t commitment_g1, proof_g1;
+    fr_t z_fr, y_fr;
+
+    /* Convert untrusted inputs to trusted inputs */
+    ret = bytes_to_kzg_commitment(&commitment_g1, commitment_bytes);
+    if (ret != C_KZG_OK) return ret;
+    ret = bytes_to_bls_field(&z_fr, z_bytes);
+    if (ret != C_KZG_OK) return ret;
+    ret = bytes_to_bls_field(&y_fr, y_bytes);
+    if (ret != C_KZG_OK) return ret;
+    ret = bytes_to_kzg_proof(&proof_g1, proof_bytes);
+    if (ret != C_KZG_OK) return ret;
+
+    if (acc->length == acc->capacity) {
+        ret = point_eval_accumulator_grow(acc);
+        if (ret != C_KZG_OK) return ret;
+    }
+
+    acc->commitments[acc->length] = commitment_g1;
+    acc->zs[acc->length] = z_fr;
+    acc->ys[acc->length] = y_fr;
+    acc->proofs[acc->length] = proof_g1;
+    acc->length++;
+
+    return C_KZG_OK;
+}
+
+/**
+ * Verify every claim held by a point evaluation accumulator.
+ *
+ * All claims are first checked together with a random linear combination, which costs a single
+ * pairing check however many claims there are. Only if that aggregate check fails are the claims
+ * verified one by one, so that the caller can tell which of them are invalid.
+ *
+ * @param[out]      ok      True if all claims are valid, otherwise false
+ * @param[out]      item_ok If not NULL, the validity of each claim, length `acc->length`
+ * @param[in,out]   acc     The accumulator
+ * @param[in]       s       The trusted setup
+ *
+ * @remark This function accepts if the accumulator is empty.
+ * @remark On success the accumulator is emptied, keeping its memory, so it can be reused.
+ */
+C_KZG_RET kzg_point_eval_accumulator_finalize(
+    bool *ok, bool *item_ok, KZGPointEvalAccumulator *acc, const KZGSettings *s
+) {
+    C_KZG_RET ret;
+
+    *ok = true;
+
+    /* Exit early if there is nothing to verify */
+    if (acc->length == 0) return C_KZG_OK;
+
+    ret = verify_kzg_proof_batch_impl(
+        ok, acc->commitments, acc->zs, acc->ys, acc->proofs, acc->length, s
+    );
+    if (ret != C_KZG_OK) goto out;
+
+    if (item_ok != NULL) {
+        for (size_t i = 0; i < acc->length; i++) {
+            /* The aggregate check passed, so every claim is valid */
+            if (*ok) {
+                item_ok[i] = true;
+                continue;
+            }
+
+            /* Otherwise, fall back to checking each claim on its own */
+            ret = verify_kzg_proof_impl(
+                &item_ok[i], &acc->commitments[i], &acc->zs[i], &acc->ys[i], &acc->proofs[i], s
+            );
+            if (ret != C_KZG_OK) goto out;
+        }
+    }
+
+    acc->length = 0;
+
+out:
+    return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Decoded Handles
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Decompress and validate a commitment once, for use with the `_with_handles` functions.
+ *
+ * @param[out]  out     The commitment handle
+ * @param[in]   bytes   The commitment bytes
+ */
+C_KZG_RET kzg_commitment_handle_from_bytes(KZGCommitmentHandle *out, const Bytes48 *bytes) {
+    C_KZG_RET ret;
+    g1_t commitment_g1;
+
+    ret = bytes_to_kzg_commitment(&commitment_g1, bytes);
+    if (ret != C_KZG_OK) return ret;
+    blst_p1_to_affine(&out->point, &commitment_g1);
+
+    return C_KZG_OK;
+}
+
+/**
+ * Decompress and validate a proof once, for use with the `_with_handles` functions.
+ *
+ * @param[out]  out     The proof handle
+ * @param[in]   bytes   The proof bytes
+ */
+C_KZG_RET kzg_proof_handle_from_bytes(KZGProofHandle *out, const Bytes48 *bytes) {
+    C_KZG_RET ret;
+    g1_t proof_g1;
+
+    ret = bytes_to_kzg_proof(&proof_g1, bytes);
+    if (ret != C_KZG_OK) return ret;
+    blst_p1_to_affine(&out->point, &proof_g1);
+
+    return C_KZG_OK;
+}
+
+/**
+ * Verify a KZG proof claiming that `p(z) == y`, like verify_kzg_proof(), but with a commitment and
+ * proof that have already been validated.
+ *
+ * @param[out]  ok          True if the proof is valid, otherwise false
+ * @param[in]   commitment  The commitment
+ * @param[in]   z_bytes     The evaluation point
+ * @param[in]   y_bytes     The claimed evaluation result
+ * @param[in]   proof       The KZG proof
+ * @param[in]   s           The trusted setup
+ */
+C_KZG_RET verify_kzg_proof_with_handles(
+    bool *ok,
+    const KZGCommitmentHandle *commitment,
+    const Bytes32 *z_bytes,
+    const Bytes32 *y_bytes,
+    const KZGProofHandle *proof,
+    const KZGSettings *s
+) {
+    C_KZG_RET ret;
+    fr_t z_fr, y_fr;
+    g1_t commitment_g1, proof_g1;
+
+    *ok = false;
+
+    ret = bytes_to_bls_field(&z_fr, z_bytes);
+    if (ret != C_KZG_OK) return ret;
+    ret = bytes_to_bls_field(&y_fr, y_bytes);
+    if (ret != C_KZG_OK) return ret;
+
+    blst_p1_from_affine(&commitment_g1, &commitment->point);
+    blst_p1_from_affine(&proof_g1, &proof->point);
+
+    return verify_kzg_proof_impl(ok, &commitment_g1, &z_fr, &y_fr, &proof_g1, s);
+}
+
+/**
+ * Verify a blob proof, like verify_blob_kzg_proof(), but with a commitment and proof that have
+ * already been validated.
+ *
+ * @param[out]  ok          True if the proof is valid, otherwise false
+ * @param[in]   blob        The blob to check
+ * @param[in]   commitment  The commitment to the blob
+ * @param[in]   proof       The blob proof
+ * @param[in]   s           The trusted setup
+ */
+C_KZG_RET verify_blob_kzg_proof_with_handles(
+    bool *ok,
+    const Blob *blob,
+    const KZGCommitmentHandle *commitment,
+    const KZGProofHandle *proof,
+    const KZGSettings *s
+) {
+    C_KZG_RET ret;
+    fr_t evaluation_challenge_fr, y_fr;
+    g1_t commitment_g1, proof_g1;
+
+    *ok = false;
+
+    blst_p1_from_affine(&commitment_g1, &commitment->point);
+    blst_p1_from_affine(&proof_g1, &proof->point);
+
+    ret = compute_blob_evaluations(&evaluation_challenge_fr, &y_fr, blob, &commitment_g1, 1, s);
+    if (ret != C_KZG_OK) return ret;
+
+    return verify_kzg_proof_impl(ok, &commitment_g1, &evaluation_challenge_fr, &y_fr, &proof_g1, s);
+}
+
+/**
+ * Verify a batch of blob proofs, like verify_blob_kzg_proof_batch(), but with commitments and
+ * proofs that have already been validated.
+ *
+ * @param[out]  ok          True if the proofs are valid, otherwise false
+ * @param[in]   blobs       Array of blobs to verify
+ * @param[in]   commitments Array of commitments to verify
+ * @param[in]   proofs      Array of proofs used for verification
+ * @param[in]   n           The number of blobs/commitments/proofs
+ * @param[in]   s           The trusted setup
+ *
+ * @remark This function accepts if called with `n==0`.
+ * @remark This function assumes that `n` is trusted and that all input arrays contain `n` elements.
+ */
+C_KZG_RET verify_blob_kzg_proof_batch_with_handles(
+    bool *ok,
+    const Blob *blobs,
+    const KZGCommitmentHandle *commitments,
+    const KZGProofHandle *proofs,
+    uint64_t n,
+    const KZGSettings *s
+) {
+    C_KZG_RET ret;
+    g1_t *commitments_g1 = NULL;
+    g1_t *proofs_g1 = NULL;
+    fr_t *evaluation_challenges_fr = NULL;
+    fr_t *ys_fr = NULL;
+
+    /* Exit early if we are given zero blobs */
+    if (n == 0) {
+        *ok = true;
+        return C_KZG_OK;
+    }
+
+    /* For a single blob, just do a regular single verification */
+    if (n == 1) {
+        return verify_blob_kzg_proof_with_handles(ok, &blobs[0], &commitments[0], &proofs[0], s);
+    }
+
+    ret = new_g1_array(&commitments_g1, (size_t)n);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_g1_array(&proofs_g1, (size_t)n);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_fr_array(&evaluation_challenges_fr, (size_t)n);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_fr_array(&ys_fr, (size_t)n);
+    if (ret != C_KZG_OK) goto out;
+
+    for (size_t i = 0; i < n; i++) {
+        blst_p1_from_affine(&commitments_g1[i], &commitments[i].point);
+        blst_p1_from_affine(&proofs_g1[i], &proofs[i].point);
+    }
+
+    ret = compute_blob_evaluations(evaluation_challenges_fr, ys_fr, blobs, commitments_g1, n, s);
+    if (ret != C_KZG_OK) goto out;
+
+    ret = verify_kzg_proof_batch_impl(
+        ok, commitments_g1, evaluation_challenges_fr, ys_fr, proofs_g1, (size_t)n, s
+    );
+
+out:
+    c_kzg_free(commitments_g1);
+    c_kzg_free(proofs_g1);
+    c_kzg_free(evaluation_challenges_fr);
+    c_kzg_free(ys_fr);
+    return ret;
+}
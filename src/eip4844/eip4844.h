@@ -32,6 +32,44 @@ typedef Bytes48 KZGCommitment;
 /** A trusted (valid) KZG proof. */
 typedef Bytes48 KZGProof;
 
+/**
+ * A KZG commitment that has already been decompressed and checked to be in G1, so that it can be
+ * used any number of times without repeating that work. Make one with
+ * kzg_commitment_handle_from_bytes() and treat its contents as opaque.
+ */
+typedef struct {
+    /** The validated commitment. */
+    blst_p1_affine point;
+} KZGCommitmentHandle;
+
+/**
+ * A KZG proof that has already been decompressed and checked to be in G1. Make one with
+ * kzg_proof_handle_from_bytes() and treat its contents as opaque.
+ */
+typedef struct {
+    /** The validated proof. */
+    blst_p1_affine point;
+} KZGProofHandle;
+
+/**
+ * Collects point evaluation claims so that they can be verified together, for example all of the
+ * point evaluation precompile calls in a block. The claims are stored already decoded.
+ */
+typedef struct {
+    /** The commitments of the claims. */
+    g1_t *commitments;
+    /** The evaluation points of the claims. */
+    fr_t *zs;
+    /** The claimed evaluation results. */
+    fr_t *ys;
+    /** The proofs of the claims. */
+    g1_t *proofs;
+    /** The number of claims held. */
+    size_t length;
+    /** The number of claims that fit before the arrays need to grow. */
+    size_t capacity;
+} KZGPointEvalAccumulator;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Public Functions
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -42,6 +80,10 @@ extern "C" {
 
 C_KZG_RET blob_to_kzg_commitment(KZGCommitment *out, const Blob *blob, const KZGSettings *s);
 
+C_KZG_RET blob_to_kzg_commitments(
+    KZGCommitment *out, const Blob *blobs, uint64_t n, const KZGSettings *s
+);
+
 C_KZG_RET compute_kzg_proof(
     KZGProof *proof_out,
     Bytes32 *y_out,
@@ -63,6 +105,16 @@ C_KZG_RET verify_kzg_proof(
     const KZGSettings *s
 );
 
+C_KZG_RET verify_kzg_proof_batch(
+    bool *ok,
+    const Bytes48 *commitments_bytes,
+    const Bytes32 *zs_bytes,
+    const Bytes32 *ys_bytes,
+    const Bytes48 *proofs_bytes,
+    uint64_t n,
+    const KZGSettings *s
+);
+
 C_KZG_RET verify_blob_kzg_proof(
     bool *ok,
     const Blob *blob,
@@ -80,9 +132,79 @@ C_KZG_RET verify_blob_kzg_proof_batch(
     const KZGSettings *s
 );
 
+C_KZG_RET verify_blob_kzg_proof_batch_locate(
+    bool *ok,
+    uint64_t *invalid_indices_out,
+    uint64_t *num_invalid_out,
+    const Blob *blobs,
+    const Bytes48 *commitments_bytes,
+    const Bytes48 *proofs_bytes,
+    uint64_t n,
+    const KZGSettings *s
+);
+
+void kzg_point_eval_accumulator_init(KZGPointEvalAccumulator *acc);
+
+void kzg_point_eval_accumulator_free(KZGPointEvalAccumulator *acc);
+
+C_KZG_RET kzg_point_eval_accumulator_add(
+    KZGPointEvalAccumulator *acc,
+    const Bytes48 *commitment_bytes,
+    const Bytes32 *z_bytes,
+    const Bytes32 *y_bytes,
+    const Bytes48 *proof_bytes
+);
+
+C_KZG_RET kzg_point_eval_accumulator_finalize(
+    bool *ok, bool *item_ok, KZGPointEvalAccumulator *acc, const KZGSettings *s
+);
+
+C_KZG_RET kzg_commitment_handle_from_bytes(KZGCommitmentHandle *out, const Bytes48 *bytes);
+
+C_KZG_RET kzg_proof_handle_from_bytes(KZGProofHandle *out, const Bytes48 *bytes);
+
+C_KZG_RET verify_kzg_proof_with_handles(
+    bool *ok,
+    const KZGCommitmentHandle *commitment,
+    const Bytes32 *z_bytes,
+    const Bytes32 *y_bytes,
+    const KZGProofHandle *proof,
+    const KZGSettings *s
+);
+
+C_KZG_RET verify_blob_kzg_proof_with_handles(
+    bool *ok,
+    const Blob *blob,
+    const KZGCommitmentHandle *commitment,
+    const KZGProofHandle *proof,
+    const KZGSettings *s
+);
+
+C_KZG_RET verify_blob_kzg_proof_batch_with_handles(
+    bool *ok,
+    const Blob *blobs,
+    const KZGCommitmentHandle *commitments,
+    const KZGProofHandle *proofs,
+    uint64_t n,
+    const KZGSettings *s
+);
+
 /* Internal function exposed for testing purposes */
 void compute_challenge(fr_t *eval_challenge_out, const Blob *blob, const g1_t *commitment);
 
+/* Internal function shared with the EIP-7594 unified accumulator and the verification coalescer */
+C_KZG_RET prepare_blob_kzg_proof_batch(
+    g1_t *commitments_g1_out,
+    fr_t *zs_fr_out,
+    fr_t *ys_fr_out,
+    g1_t *proofs_g1_out,
+    const Blob *blobs,
+    const Bytes48 *commitments_bytes,
+    const Bytes48 *proofs_bytes,
+    uint64_t n,
+    const KZGSettings *s
+);
+
 #ifdef __cplusplus
 }
 #endif
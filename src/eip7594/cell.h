@@ -36,6 +36,9 @@
 /** The number of cells in an extended blob. */
 #define CELLS_PER_EXT_BLOB (FIELD_ELEMENTS_PER_EXT_BLOB / FIELD_ELEMENTS_PER_CELL)
 
+/** The window size of the fixed-base MSM used to commit to cell-sized polynomials. */
+#define CELL_MONOMIAL_TABLE_WBITS 8
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Types
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -16,6 +16,7 @@
 
 #include "eip7594/eip7594.h"
 #include "common/alloc.h"
+#include "common/cache.h"
 #include "common/fr.h"
 #include "common/lincomb.h"
 #include "common/utils.h"
@@ -27,6 +28,10 @@
 #include <assert.h> /* For assert */
 #include <string.h> /* For memcpy & strlen */
 
+#ifdef _OPENMP
+#include <omp.h> /* For omp_in_parallel */
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Macros
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -34,6 +39,26 @@
 /** Length of the domain string. */
 #define DOMAIN_STR_LENGTH 16
 
+/** The number of cells a CellVerifyAccumulator holds before adding them to its running sums. */
+#define CELL_VERIFY_ACCUMULATOR_CHUNK_SIZE 64
+
+/**
+ * Emit an OpenMP directive. These are only active when the library is built with OpenMP (e.g.
+ * with `-fopenmp`), which is the opt-in parallel mode for cell proof verification. Otherwise they
+ * expand to nothing and the code runs sequentially.
+ */
+#ifdef _OPENMP
+#define OMP_PRAGMA(x) _Pragma(#x)
+#else
+#define OMP_PRAGMA(x)
+#endif
+
+/**
+ * The number of cells below which a cell proof batch is verified without forking worker threads.
+ * Smaller batches take less time to verify than waking the threads does.
+ */
+#define PARALLEL_VERIFY_MIN_CELLS 32
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Constants
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -41,6 +66,12 @@
 /** The domain separator for verify_cell_kzg_proof_batch's random challenge. */
 static const char *RANDOM_CHALLENGE_DOMAIN_VERIFY_CELL_KZG_PROOF_BATCH = "RCKZGCBATCH__V1_";
 
+/** The domain separator for verify_blob_cell_kzg_proofs's random challenge. */
+static const char *RANDOM_CHALLENGE_DOMAIN_VERIFY_BLOB_CELL_KZG_PROOFS = "RCKZGBCELLS__V1_";
+
+/** The domain separator for the verify cache keys of cell proofs. */
+static const char *VERIFY_CACHE_DOMAIN_CELL_KZG_PROOF = "VCCELLKZGPROOFV1";
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Compute
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -145,6 +176,38 @@ out:
     return ret;
 }
 
+/**
+ * Given some blobs, compute all of their cells and proofs.
+ *
+ * @param[out]  cells   An array of n * CELLS_PER_EXT_BLOB cells, those of blobs[i] at
+ *                      i * CELLS_PER_EXT_BLOB
+ * @param[out]  proofs  An array of n * CELLS_PER_EXT_BLOB proofs, laid out like the cells
+ * @param[in]   blobs   The blobs to get cells/proofs for
+ * @param[in]   n       The number of blobs
+ * @param[in]   s       The trusted setup
+ *
+ * @remark If cells is NULL, they won't be computed.
+ * @remark If proofs is NULL, they won't be computed.
+ * @remark Stops at the first blob which fails, leaving the outputs of later blobs unwritten.
+ */
+C_KZG_RET compute_cells_and_kzg_proofs_batch(
+    Cell *cells, KZGProof *proofs, const Blob *blobs, uint64_t n, const KZGSettings *s
+) {
+    C_KZG_RET ret;
+
+    for (size_t i = 0; i < n; i++) {
+        ret = compute_cells_and_kzg_proofs(
+            cells != NULL ? &cells[i * CELLS_PER_EXT_BLOB] : NULL,
+            proofs != NULL ? &proofs[i * CELLS_PER_EXT_BLOB] : NULL,
+            &blobs[i],
+            s
+        );
+        if (ret != C_KZG_OK) return ret;
+    }
+
+    return C_KZG_OK;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Recover
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -306,10 +369,33 @@ static void commitments_copy(Bytes48 *dst, const Bytes48 *src) {
     memcpy(dst->bytes, src->bytes, BYTES_PER_COMMITMENT);
 }
 
+/**
+ * Helper function to hash a commitment to a slot in the deduplication table.
+ *
+ * @param[in]   commitment  The commitment to hash
+ * @param[in]   key         The key for the hash, derived from all of the commitments
+ *
+ * @return The 64-bit hash of the commitment.
+ */
+static uint64_t commitment_hash(const Bytes48 *commitment, uint64_t key) {
+    uint64_t h = key;
+    for (size_t i = 0; i < BYTES_PER_COMMITMENT; i += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, &commitment->bytes[i], sizeof(uint64_t));
+        h = (h ^ word) * 0x9e3779b97f4a7c15;
+        h ^= h >> 32;
+    }
+    return h;
+}
+
 /**
  * Convert a list of commitments with potential duplicates to a list of unique commitments. Also
  * returns a list of indices which point to those new unique commitments.
  *
+ * Commitments are looked up in an open-addressing hash table with linear probing, so the cost is
+ * linear in the number of commitments. The hash is keyed with a digest of all of the commitments,
+ * which keeps an attacker from cheaply choosing commitments that collide in the table.
+ *
  * @param[in,out]   commitments_out Updated to only contain unique commitments
  * @param[out]      indices_out     Used as map between old/new commitments
  * @param[in,out]   count_out       Number of commitments before and after
@@ -318,53 +404,78 @@ static void commitments_copy(Bytes48 *dst, const Bytes48 *src) {
  * @remark The number of commitments/indices must be the same.
  * @remark The length of `indices_out` is unchanged.
  * @remark `count_out` is updated to be the number of unique commitments.
+ * @remark The unique commitments keep the order of their first occurrence.
  */
-static void deduplicate_commitments(
+static C_KZG_RET deduplicate_commitments(
     Bytes48 *commitments_out, uint64_t *indices_out, size_t *count_out
 ) {
+    C_KZG_RET ret;
+    Bytes32 digest;
+    uint64_t key;
+    uint64_t *slots = NULL;
+    size_t num_slots = 1;
+
     /* Bail early if there are no commitments */
-    if (*count_out == 0) return;
+    if (*count_out == 0) return C_KZG_OK;
+
+    /* Keep the table at most half full, so probe sequences stay short */
+    while (num_slots < 2 * *count_out) {
+        num_slots <<= 1;
+    }
+
+    /* Each slot holds one plus the index of a unique commitment, zero marks an empty slot */
+    ret = c_kzg_calloc((void **)&slots, num_slots, sizeof(uint64_t));
+    if (ret != C_KZG_OK) goto out;
 
-    /* The first commitment is always new */
-    indices_out[0] = 0;
-    size_t new_count = 1;
+    /* Derive the hash key from all of the commitments */
+    blst_sha256(digest.bytes, commitments_out[0].bytes, *count_out * sizeof(Bytes48));
+    memcpy(&key, digest.bytes, sizeof(key));
 
     /* Create list of unique commitments & indices to them */
-    for (size_t i = 1; i < *count_out; i++) {
-        bool exist = false;
-        for (size_t j = 0; j < new_count; j++) {
-            if (commitments_equal(&commitments_out[i], &commitments_out[j])) {
+    size_t new_count = 0;
+    for (size_t i = 0; i < *count_out; i++) {
+        size_t slot = (size_t)(commitment_hash(&commitments_out[i], key) & (num_slots - 1));
+        while (true) {
+            if (slots[slot] == 0) {
+                /* This is a new commitment */
+                commitments_copy(&commitments_out[new_count], &commitments_out[i]);
+                indices_out[i] = new_count;
+                new_count++;
+                slots[slot] = new_count;
+                break;
+            }
+            if (commitments_equal(&commitments_out[i], &commitments_out[slots[slot] - 1])) {
                 /* This commitment already exists */
-                indices_out[i] = j;
-                exist = true;
+                indices_out[i] = slots[slot] - 1;
                 break;
             }
-        }
-        if (!exist) {
-            /* This is a new commitment */
-            commitments_copy(&commitments_out[new_count], &commitments_out[i]);
-            indices_out[i] = new_count;
-            new_count++;
+            slot = (slot + 1) & (num_slots - 1);
         }
     }
 
     /* Update the count */
     *count_out = new_count;
+
+out:
+    c_kzg_free(slots);
+    return ret;
 }
 
 /**
- * Compute the challenge value used for batch verification of cell KZG proofs.
+ * Helper function for compute_verify_cell_kzg_proof_batch_challenge(): hash some entries of the
+ * cell arrays.
  *
  * @param[out]  challenge_out       The output challenge as a BLS field element
  * @param[in]   commitments_bytes   The input commitments, length `num_commitments`
  * @param[in]   num_commitments     The number of commitments
  * @param[in]   commitment_indices  The cell commitment indices, length `num_cells`
- * @param[in]   cell_indices        The cell indices, length `num_cells`
- * @param[in]   cells               The cells, length `num_cells`
- * @param[in]   proofs_bytes        The cell proofs, length `num_cells`
+ * @param[in]   cell_indices        The cell indices
+ * @param[in]   cells               The cells
+ * @param[in]   proofs_bytes        The cell proofs
+ * @param[in]   entries             The entries of the cell arrays to hash, or NULL for all
  * @param[in]   num_cells           The number of cells
  */
-C_KZG_RET compute_verify_cell_kzg_proof_batch_challenge(
+static C_KZG_RET compute_verify_cell_kzg_proof_batch_challenge_entries(
     fr_t *challenge_out,
     const Bytes48 *commitments_bytes,
     uint64_t num_commitments,
@@ -372,6 +483,7 @@ C_KZG_RET compute_verify_cell_kzg_proof_batch_challenge(
     const uint64_t *cell_indices,
     const Cell *cells,
     const Bytes48 *proofs_bytes,
+    const size_t *entries,
     uint64_t num_cells
 ) {
     C_KZG_RET ret;
@@ -427,20 +539,22 @@ C_KZG_RET compute_verify_cell_kzg_proof_batch_challenge(
     }
 
     for (size_t i = 0; i < num_cells; i++) {
+        size_t j = entries == NULL ? i : entries[i];
+
         /* Copy row id */
         bytes_from_uint64(offset, commitment_indices[i]);
         offset += sizeof(uint64_t);
 
         /* Copy column id */
-        bytes_from_uint64(offset, cell_indices[i]);
+        bytes_from_uint64(offset, cell_indices[j]);
         offset += sizeof(uint64_t);
 
         /* Copy cell */
-        memcpy(offset, &cells[i], BYTES_PER_CELL);
+        memcpy(offset, &cells[j], BYTES_PER_CELL);
         offset += BYTES_PER_CELL;
 
         /* Copy proof */
-        memcpy(offset, &proofs_bytes[i], BYTES_PER_PROOF);
+        memcpy(offset, &proofs_bytes[j], BYTES_PER_PROOF);
         offset += BYTES_PER_PROOF;
     }
 
@@ -459,122 +573,276 @@ out:
 }
 
 /**
- * Compute the sum of the commitments weighted by the powers of r.
+ * Compute the challenge value used for batch verification of cell KZG proofs.
+ *
+ * @param[out]  challenge_out       The output challenge as a BLS field element
+ * @param[in]   commitments_bytes   The input commitments, length `num_commitments`
+ * @param[in]   num_commitments     The number of commitments
+ * @param[in]   commitment_indices  The cell commitment indices, length `num_cells`
+ * @param[in]   cell_indices        The cell indices, length `num_cells`
+ * @param[in]   cells               The cells, length `num_cells`
+ * @param[in]   proofs_bytes        The cell proofs, length `num_cells`
+ * @param[in]   num_cells           The number of cells
+ */
+C_KZG_RET compute_verify_cell_kzg_proof_batch_challenge(
+    fr_t *challenge_out,
+    const Bytes48 *commitments_bytes,
+    uint64_t num_commitments,
+    const uint64_t *commitment_indices,
+    const uint64_t *cell_indices,
+    const Cell *cells,
+    const Bytes48 *proofs_bytes,
+    uint64_t num_cells
+) {
+    return compute_verify_cell_kzg_proof_batch_challenge_entries(
+        challenge_out,
+        commitments_bytes,
+        num_commitments,
+        commitment_indices,
+        cell_indices,
+        cells,
+        proofs_bytes,
+        NULL,
+        num_cells
+    );
+}
+
+/**
+ * Compute the weight of each unique commitment, the sum of the powers of r of its cells.
  *
- * @param[out]  sum_of_commitments_out  The resulting G1 sum of the commitments
- * @param[in]   unique_commitments      Array of unique commitments, length `num_commitments`
+ * @param[out]  commitment_weights_out  The weights, length `num_commitments`
  * @param[in]   commitment_indices      Indices mapping to unique commitments, length `num_cells`
  * @param[in]   r_powers                Array of powers of r used for weighting, length `num_cells`
  * @param[in]   num_commitments         The number of unique commitments
  * @param[in]   num_cells               The number of cells
  */
-static C_KZG_RET compute_weighted_sum_of_commitments(
-    g1_t *sum_of_commitments_out,
-    const Bytes48 *unique_commitments,
+static void compute_commitment_weights(
+    fr_t *commitment_weights_out,
     const uint64_t *commitment_indices,
     const fr_t *r_powers,
     size_t num_commitments,
     uint64_t num_cells
 ) {
-    C_KZG_RET ret;
-    g1_t *commitments_g1 = NULL;
-    fr_t *commitment_weights = NULL;
-
-    ret = new_fr_array(&commitment_weights, num_commitments);
-    if (ret != C_KZG_OK) goto out;
-    ret = new_g1_array(&commitments_g1, num_commitments);
-    if (ret != C_KZG_OK) goto out;
-
+    /* Initialize the weights to zero */
     for (size_t i = 0; i < num_commitments; i++) {
-        /* Convert & validate commitment */
-        ret = bytes_to_kzg_commitment(&commitments_g1[i], &unique_commitments[i]);
-        if (ret != C_KZG_OK) goto out;
-
-        /* Initialize the weight to zero */
-        commitment_weights[i] = FR_ZERO;
+        commitment_weights_out[i] = FR_ZERO;
     }
 
     /* Update commitment weights */
     for (uint64_t i = 0; i < num_cells; i++) {
         blst_fr_add(
-            &commitment_weights[commitment_indices[i]],
-            &commitment_weights[commitment_indices[i]],
+            &commitment_weights_out[commitment_indices[i]],
+            &commitment_weights_out[commitment_indices[i]],
             &r_powers[i]
         );
     }
+}
+
+/**
+ * Get the powers of the inverse coset factor h_k^{-1},
+ *  where `h_k` is the coset factor for cell with index `k`.
+ *
+ * Multiplying the coefficients of a polynomial element-wise by these powers is equivalent to
+ * shift_poly() with h_k^{-1}, without recomputing the powers every time.
+ *
+ * @param[in]   cell_index  The index of the cell
+ * @param[in]   s           The trusted setup
+ *
+ * @return The powers h_k^{-j} for `j` in `0..FIELD_ELEMENTS_PER_CELL`.
+ */
+static const fr_t *get_inv_coset_shift_powers_for_cell(uint64_t cell_index, const KZGSettings *s) {
+    assert(cell_index < CELLS_PER_EXT_BLOB);
+    return &s->cell_inv_coset_shift_powers[cell_index * FIELD_ELEMENTS_PER_CELL];
+}
+
+/**
+ * Get h_k^{n}, where `h_k` is the coset factor for cell with index `k`.
+ *
+ * @param[out]  coset_factor_out    Pointer to store h_k^{n}
+ * @param[in]   cell_index          The index of the cell
+ * @param[in]   s                   The trusted setup
+ */
+static void get_coset_shift_pow_for_cell(
+    fr_t *coset_factor_out, uint64_t cell_index, const KZGSettings *s
+) {
+    assert(cell_index < CELLS_PER_EXT_BLOB);
+    *coset_factor_out = s->cell_coset_shift_pows[cell_index];
+}
+
+/**
+ * Shift a cell-sized polynomial by h_k^{-1}, where `h_k` is the coset factor for cell with index
+ * `k`, using the precomputed powers of h_k^{-1}.
+ *
+ * @param[in,out]   poly        The polynomial, length `FIELD_ELEMENTS_PER_CELL`
+ * @param[in]       cell_index  The index of the cell
+ * @param[in]       s           The trusted setup
+ */
+static void shift_cell_poly(fr_t *poly, uint64_t cell_index, const KZGSettings *s) {
+    const fr_t *inv_coset_factor_powers = get_inv_coset_shift_powers_for_cell(cell_index, s);
+
+    /* The zeroth power is one, so the constant term stays the same */
+    for (size_t i = 1; i < FIELD_ELEMENTS_PER_CELL; i++) {
+        blst_fr_mul(&poly[i], &poly[i], &inv_coset_factor_powers[i]);
+    }
+}
+
+/**
+ * Commit to a cell-sized polynomial in monomial form.
+ *
+ * Since the bases are always the first `FIELD_ELEMENTS_PER_CELL` monomial G1 points, this uses
+ * the fixed-base table in the settings rather than a generic MSM.
+ *
+ * @param[out]  commitment_out  The commitment to the polynomial
+ * @param[in]   poly            The polynomial, length `FIELD_ELEMENTS_PER_CELL`
+ * @param[in]   s               The trusted setup
+ */
+static C_KZG_RET commit_to_cell_poly(g1_t *commitment_out, const fr_t *poly, const KZGSettings *s) {
+    C_KZG_RET ret;
+    limb_t *scratch = NULL;
+    blst_scalar scalars[FIELD_ELEMENTS_PER_CELL];
 
-    /* Compute commitment sum */
-    ret = g1_lincomb_fast(
-        sum_of_commitments_out, commitments_g1, commitment_weights, num_commitments
+    ret = c_kzg_malloc(
+        (void **)&scratch, blst_p1s_mult_wbits_scratch_sizeof(FIELD_ELEMENTS_PER_CELL)
     );
     if (ret != C_KZG_OK) goto out;
 
+    for (size_t i = 0; i < FIELD_ELEMENTS_PER_CELL; i++) {
+        blst_scalar_from_fr(&scalars[i], &poly[i]);
+    }
+
+    const byte *scalars_arg[2] = {(const byte *)scalars, NULL};
+    blst_p1s_mult_wbits(
+        commitment_out,
+        s->g1_monomial_cell_table,
+        CELL_MONOMIAL_TABLE_WBITS,
+        FIELD_ELEMENTS_PER_CELL,
+        scalars_arg,
+        BITS_PER_FIELD_ELEMENT,
+        scratch
+    );
+
 out:
-    c_kzg_free(commitment_weights);
-    c_kzg_free(commitments_g1);
+    c_kzg_free(scratch);
     return ret;
 }
 
 /**
- * Compute the inverse coset factor h_k^{-1},
- *  where `h_k` is the coset factor for cell with index `k`.
+ * Compute the interpolation polynomial for a single column of aggregated cells.
  *
- * @param[out]  inv_coset_factor_out    Pointer to store the computed inverse coset factor
- * @param[in]   cell_index              The index of the cell
- * @param[in]   s                       The trusted setup
+ * @param[out]      poly_out    The interpolation polynomial, length `FIELD_ELEMENTS_PER_CELL`
+ * @param[in,out]   column      The aggregated column, length `FIELD_ELEMENTS_PER_CELL`
+ * @param[in]       cell_index  The index of the column
+ * @param[in]       s           The trusted setup
+ *
+ * @remark The column is bit-reversed in place, so its contents are not preserved.
  */
-static void get_inv_coset_shift_for_cell(
-    fr_t *inv_coset_factor_out, uint64_t cell_index, const KZGSettings *s
+static C_KZG_RET interpolate_cell_column(
+    fr_t *poly_out, fr_t *column, uint64_t cell_index, const KZGSettings *s
 ) {
-    /*
-     * Get the cell index in reverse-bit order.
-     * This index points to this cell's coset factor h_k in the roots_of_unity array.
-     */
-    uint64_t cell_idx_rbl = reverse_bits_limited(CELLS_PER_EXT_BLOB, cell_index);
+    C_KZG_RET ret;
+
+    ret = bit_reversal_permutation(column, sizeof(fr_t), FIELD_ELEMENTS_PER_CELL);
+    if (ret != C_KZG_OK) return ret;
 
     /*
-     * Observe that for every element in roots_of_unity, we can find its inverse by
-     * accessing its reflected element.
-     *
-     * For example, consider a multiplicative subgroup with eight elements:
-     *   roots = {w^0, w^1, w^2, ... w^7, w^0}
-     * For a root of unity in roots[i], we can find its inverse in roots[-i].
+     * Get interpolation polynomial for this column. To do so we first do an IDFT over the roots
+     * of unity and then we scale the coefficients by the coset factor. We can't do an IDFT
+     * directly over the coset because it's not a subgroup.
      */
-    assert(cell_idx_rbl <= FIELD_ELEMENTS_PER_EXT_BLOB);
-    uint64_t inv_coset_factor_idx = FIELD_ELEMENTS_PER_EXT_BLOB - cell_idx_rbl;
+    ret = fr_ifft(poly_out, column, FIELD_ELEMENTS_PER_CELL, s);
+    if (ret != C_KZG_OK) return ret;
 
-    /* Get h_k^{-1} using the index */
-    assert(inv_coset_factor_idx < FIELD_ELEMENTS_PER_EXT_BLOB + 1);
-    *inv_coset_factor_out = s->roots_of_unity[inv_coset_factor_idx];
+    /* Shift the poly by h_k^{-1} where h_k is the coset factor for this cell */
+    shift_cell_poly(poly_out, cell_index, s);
+
+    return C_KZG_OK;
 }
 
 /**
- * Compute h_k^{n}, where `h_k` is the coset factor for cell with index `k`.
+ * Compute the interpolation polynomial of each aggregated column, sum them, and commit to the sum.
  *
- * @param[out]  coset_factor_out    Pointer to store h_k^{n}
- * @param[in]   cell_index          The index of the cell
- * @param[in]   s                   The trusted setup
+ * @param[out]      commitment_out          Commitment to the aggregated interpolation poly
+ * @param[in,out]   aggregated_column_cells The aggregated columns, one cell wide each
+ * @param[in]       is_cell_used            Whether each column holds any cells
+ * @param[in]       s                       The trusted setup
+ *
+ * @remark The used columns are bit-reversed in place, so their contents are not preserved.
  */
-static void get_coset_shift_pow_for_cell(
-    fr_t *coset_factor_out, uint64_t cell_index, const KZGSettings *s
+static C_KZG_RET commit_to_aggregated_columns(
+    g1_t *commitment_out,
+    fr_t *aggregated_column_cells,
+    const bool *is_cell_used,
+    const KZGSettings *s
 ) {
-    /*
-     * Get the cell index in reverse-bit order.
-     * This index points to this cell's coset factor h_k in the roots_of_unity array.
-     */
-    uint64_t cell_idx_rbl = reverse_bits_limited(CELLS_PER_EXT_BLOB, cell_index);
+    C_KZG_RET ret;
+    fr_t *column_interpolation_polys = NULL;
+    fr_t *aggregated_interpolation_poly = NULL;
+
+    ret = new_fr_array(&column_interpolation_polys, FIELD_ELEMENTS_PER_EXT_BLOB);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_fr_array(&aggregated_interpolation_poly, FIELD_ELEMENTS_PER_CELL);
+    if (ret != C_KZG_OK) goto out;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Compute interpolation polynomials using the aggregated cells
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /* Start with a zeroed out poly */
+    for (size_t i = 0; i < FIELD_ELEMENTS_PER_CELL; i++) {
+        aggregated_interpolation_poly[i] = FR_ZERO;
+    }
 
     /*
-     * Get the index to h_k^n in the roots_of_unity array.
-     *
-     * Multiplying the index of h_k by n, effectively raises h_k to the n-th power,
-     * because advancing in the roots_of_unity array corresponds to increasing exponents.
+     * Interpolate each column. The columns are independent, so in the parallel mode they are
+     * spread across the worker threads. Outside of an active parallel region, the columns are
+     * interpolated in turn on this thread without deferring them as tasks.
      */
-    uint64_t h_k_pow_idx = cell_idx_rbl * FIELD_ELEMENTS_PER_CELL;
+    OMP_PRAGMA(omp taskloop if(omp_in_parallel()) shared(ret))
+    for (size_t i = 0; i < CELLS_PER_EXT_BLOB; i++) {
+        /* We can skip columns without any cells */
+        if (!is_cell_used[i]) continue;
+
+        /* Offset to the first cell for this column */
+        size_t index = i * FIELD_ELEMENTS_PER_CELL;
+
+        /*
+         * Reach into the big array and permute the right column.
+         * No need to copy the data, we are not gonna use them again.
+         */
+        C_KZG_RET column_ret = interpolate_cell_column(
+            &column_interpolation_polys[index], &aggregated_column_cells[index], i, s
+        );
+        if (column_ret != C_KZG_OK) {
+            OMP_PRAGMA(omp atomic write)
+            ret = column_ret;
+        }
+    }
+    if (ret != C_KZG_OK) goto out;
+
+    /* Sum the interpolation polynomials */
+    for (size_t i = 0; i < CELLS_PER_EXT_BLOB; i++) {
+        if (!is_cell_used[i]) continue;
+        size_t index = i * FIELD_ELEMENTS_PER_CELL;
+        for (size_t k = 0; k < FIELD_ELEMENTS_PER_CELL; k++) {
+            blst_fr_add(
+                &aggregated_interpolation_poly[k],
+                &aggregated_interpolation_poly[k],
+                &column_interpolation_polys[index + k]
+            );
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Commit to the aggregated interpolation polynomial
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ret = commit_to_cell_poly(commitment_out, aggregated_interpolation_poly, s);
+    if (ret != C_KZG_OK) goto out;
 
-    /* Get h_k^n using the index */
-    assert(h_k_pow_idx < FIELD_ELEMENTS_PER_EXT_BLOB + 1);
-    *coset_factor_out = s->roots_of_unity[h_k_pow_idx];
+out:
+    c_kzg_free(column_interpolation_polys);
+    c_kzg_free(aggregated_interpolation_poly);
+    return ret;
 }
 
 /**
@@ -585,7 +853,7 @@ static void get_coset_shift_pow_for_cell(
  * @param[out]  commitment_out  Commitment to the aggregated interpolation poly
  * @param[in]   r_powers        Precomputed powers of the random challenge, length `num_cells`
  * @param[in]   cell_indices    Indices of the cells, length `num_cells`
- * @param[in]   cells           Array of cells, length `num_cells`
+ * @param[in]   cells_fr        Field elements of the cells, `FIELD_ELEMENTS_PER_CELL` per cell
  * @param[in]   num_cells       Number of cells
  * @param[in]   s               The trusted setup
  */
@@ -593,15 +861,13 @@ static C_KZG_RET compute_commitment_to_aggregated_interpolation_poly(
     g1_t *commitment_out,
     const fr_t *r_powers,
     const uint64_t *cell_indices,
-    const Cell *cells,
+    const fr_t *cells_fr,
     uint64_t num_cells,
     const KZGSettings *s
 ) {
     C_KZG_RET ret;
     bool *is_cell_used = NULL;
     fr_t *aggregated_column_cells = NULL;
-    fr_t *column_interpolation_poly = NULL;
-    fr_t *aggregated_interpolation_poly = NULL;
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
     // Array allocations
@@ -611,10 +877,6 @@ static C_KZG_RET compute_commitment_to_aggregated_interpolation_poly(
     if (ret != C_KZG_OK) goto out;
     ret = new_fr_array(&aggregated_column_cells, FIELD_ELEMENTS_PER_EXT_BLOB);
     if (ret != C_KZG_OK) goto out;
-    ret = new_fr_array(&column_interpolation_poly, FIELD_ELEMENTS_PER_CELL);
-    if (ret != C_KZG_OK) goto out;
-    ret = new_fr_array(&aggregated_interpolation_poly, FIELD_ELEMENTS_PER_CELL);
-    if (ret != C_KZG_OK) goto out;
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
     // Aggregate cells from the same column
@@ -640,17 +902,11 @@ static C_KZG_RET compute_commitment_to_aggregated_interpolation_poly(
 
         /* Iterate over every field element of this cell: scale it and aggregate it */
         for (size_t fr_index = 0; fr_index < FIELD_ELEMENTS_PER_CELL; fr_index++) {
-            fr_t original_fr, scaled_fr;
-
-            /* Get the field element at this offset */
-            size_t offset = fr_index * BYTES_PER_FIELD_ELEMENT;
-            ret = bytes_to_bls_field(
-                &original_fr, (const Bytes32 *)&cells[cell_index].bytes[offset]
-            );
-            if (ret != C_KZG_OK) goto out;
+            fr_t scaled_fr;
 
             /* Scale the field element by the appropriate power of r */
-            blst_fr_mul(&scaled_fr, &original_fr, &r_powers[cell_index]);
+            size_t offset = (size_t)cell_index * FIELD_ELEMENTS_PER_CELL + fr_index;
+            blst_fr_mul(&scaled_fr, &cells_fr[offset], &r_powers[cell_index]);
 
             /* Figure out the right index for this field element within the extended array */
             size_t array_index = (size_t)column_index * FIELD_ELEMENTS_PER_CELL + fr_index;
@@ -678,166 +934,130 @@ static C_KZG_RET compute_commitment_to_aggregated_interpolation_poly(
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    // Compute interpolation polynomials using the aggregated cells
-    ////////////////////////////////////////////////////////////////////////////////////////////////
-
-    /* Start with a zeroed out poly */
-    for (size_t i = 0; i < FIELD_ELEMENTS_PER_CELL; i++) {
-        aggregated_interpolation_poly[i] = FR_ZERO;
-    }
-
-    /* Interpolate each column */
-    for (size_t i = 0; i < CELLS_PER_EXT_BLOB; i++) {
-        /* We can skip columns without any cells */
-        if (!is_cell_used[i]) continue;
-
-        /* Offset to the first cell for this column */
-        size_t index = i * FIELD_ELEMENTS_PER_CELL;
-
-        /*
-         * Reach into the big array and permute the right column.
-         * No need to copy the data, we are not gonna use them again.
-         */
-        ret = bit_reversal_permutation(
-            &aggregated_column_cells[index], sizeof(fr_t), FIELD_ELEMENTS_PER_CELL
-        );
-        if (ret != C_KZG_OK) goto out;
-
-        /*
-         * Get interpolation polynomial for this column. To do so we first do an IDFT over the roots
-         * of unity and then we scale the coefficients by the coset factor. We can't do an IDFT
-         * directly over the coset because it's not a subgroup.
-         */
-        ret = fr_ifft(
-            column_interpolation_poly, &aggregated_column_cells[index], FIELD_ELEMENTS_PER_CELL, s
-        );
-        if (ret != C_KZG_OK) goto out;
-
-        /* Shift the poly by h_k^{-1} where h_k is the coset factor for this cell */
-        fr_t inv_coset_factor;
-        get_inv_coset_shift_for_cell(&inv_coset_factor, i, s);
-        shift_poly(column_interpolation_poly, FIELD_ELEMENTS_PER_CELL, &inv_coset_factor);
-
-        /* Update the aggregated poly */
-        for (size_t k = 0; k < FIELD_ELEMENTS_PER_CELL; k++) {
-            blst_fr_add(
-                &aggregated_interpolation_poly[k],
-                &aggregated_interpolation_poly[k],
-                &column_interpolation_poly[k]
-            );
-        }
-    }
-
-    ////////////////////////////////////////////////////////////////////////////////////////////////
-    // Commit to the aggregated interpolation polynomial
+    // Interpolate the aggregated columns and commit to the sum
     ////////////////////////////////////////////////////////////////////////////////////////////////
 
-    ret = g1_lincomb_fast(
-        commitment_out,
-        s->g1_values_monomial,
-        aggregated_interpolation_poly,
-        FIELD_ELEMENTS_PER_CELL
-    );
+    ret = commit_to_aggregated_columns(commitment_out, aggregated_column_cells, is_cell_used, s);
     if (ret != C_KZG_OK) goto out;
 
 out:
     c_kzg_free(is_cell_used);
     c_kzg_free(aggregated_column_cells);
-    c_kzg_free(column_interpolation_poly);
-    c_kzg_free(aggregated_interpolation_poly);
     return ret;
 }
 
 /**
- * Compute weighted sum of proofs.
+ * Compute the weights of the proofs, the powers of r scaled by the coset factors.
  *
- * @param[out]  weighted_proof_lincomb  The resulting G1 sum of the proofs scaled by coset factors
- * @param[in]   proofs_g1               Array of proofs, length `num_cells`
- * @param[in]   r_powers                Array of powers of r used for weighting, length `num_cells`
- * @param[in]   cell_indices            Array of cell indices, length `num_cells`
- * @param[in]   num_cells               The number of cells
- * @param[in]   s                       The trusted setup
+ * @param[out]  weighted_powers_of_r_out    The weights, length `num_cells`
+ * @param[in]   r_powers                    Array of powers of r, length `num_cells`
+ * @param[in]   cell_indices                Array of cell indices, length `num_cells`
+ * @param[in]   num_cells                   The number of cells
+ * @param[in]   s                           The trusted setup
  */
-static C_KZG_RET computed_weighted_sum_of_proofs(
-    g1_t *weighted_proof_sum_out,
-    const g1_t *proofs_g1,
+static void compute_weighted_powers_of_r(
+    fr_t *weighted_powers_of_r_out,
     const fr_t *r_powers,
     const uint64_t *cell_indices,
     uint64_t num_cells,
     const KZGSettings *s
 ) {
-    C_KZG_RET ret;
-    fr_t *weighted_powers_of_r = NULL;
-
-    ret = new_fr_array(&weighted_powers_of_r, (size_t)num_cells);
-    if (ret != C_KZG_OK) goto out;
-
     for (uint64_t i = 0; i < num_cells; i++) {
         /* Get scaling factor h_k^n where h_k is the coset factor for this cell */
         fr_t h_k_pow;
         get_coset_shift_pow_for_cell(&h_k_pow, (size_t)cell_indices[i], s);
 
         /* Scale the power of r by h_k^n */
-        blst_fr_mul(&weighted_powers_of_r[i], &r_powers[i], &h_k_pow);
+        blst_fr_mul(&weighted_powers_of_r_out[i], &r_powers[i], &h_k_pow);
     }
+}
 
-    ret = g1_lincomb_fast(weighted_proof_sum_out, proofs_g1, weighted_powers_of_r, (size_t)num_cells);
+/**
+ * The decoded inputs of a batch of cell proofs, shared by every check made on that batch.
+ */
+typedef struct {
+    /** The unique commitments in affine representation, length `num_commitments`. */
+    blst_p1_affine *commitments_affine;
+    /** Indices mapping each cell to its unique commitment, length `num_cells`. */
+    uint64_t *commitment_indices;
+    /** The indices of the cells, length `num_cells`. */
+    uint64_t *cell_indices;
+    /** The field elements of the cells, length `num_cells * FIELD_ELEMENTS_PER_CELL`. */
+    fr_t *cells_fr;
+    /** The proofs for the cells in affine representation, length `num_cells`. */
+    blst_p1_affine *proofs_affine;
+    /** The powers of the random challenge, length `num_cells`. */
+    fr_t *r_powers;
+    /** The number of unique commitments. */
+    size_t num_commitments;
+    /** The number of cells. */
+    size_t num_cells;
+} CellProofBatch;
 
-out:
-    c_kzg_free(weighted_powers_of_r);
-    return ret;
+/**
+ * Free the arrays held by a batch of cell proofs.
+ *
+ * @param[in]   batch   The batch to free
+ */
+static void free_cell_kzg_proof_batch(CellProofBatch *batch) {
+    c_kzg_free(batch->commitments_affine);
+    c_kzg_free(batch->commitment_indices);
+    c_kzg_free(batch->cell_indices);
+    c_kzg_free(batch->cells_fr);
+    c_kzg_free(batch->proofs_affine);
+    c_kzg_free(batch->r_powers);
 }
 
 /**
- * Given some cells, verify that their proofs are valid.
+ * Validate and decode the inputs of a batch of cell proofs, and derive the weights for the random
+ * linear combination from them.
  *
- * @param[out]  ok                  True if the proofs are valid
- * @param[in]   commitments_bytes   The commitments for the cells, length `num_cells`
- * @param[in]   cell_indices        The indices for the cells, length `num_cells`
- * @param[in]   cells               The cells to check, length `num_cells`
- * @param[in]   proofs_bytes        The proofs for the cells, length `num_cells`
- * @param[in]   num_cells           The number of cells provided
- * @param[in]   s                   The trusted setup
+ * @param[out]  batch               The decoded batch
+ * @param[in]   commitments_bytes   The commitments for the cells
+ * @param[in]   cell_indices        The indices for the cells
+ * @param[in]   cells               The cells to check
+ * @param[in]   proofs_bytes        The proofs for the cells
+ * @param[in]   entries             The entries of the arrays to check, or NULL for all
+ * @param[in]   num_cells           The number of cells to check
+ * @param[in]   commitment_handles  If not NULL, the already validated commitments
+ * @param[in]   proof_handles       If not NULL, the already validated proofs
+ *
+ * @remark The batch must be freed with free_cell_kzg_proof_batch(), even if this fails.
+ * @remark The handles, if given, must match the bytes, which are still hashed for the challenge.
  */
-C_KZG_RET verify_cell_kzg_proof_batch(
-    bool *ok,
+static C_KZG_RET prepare_cell_kzg_proof_batch(
+    CellProofBatch *batch,
     const Bytes48 *commitments_bytes,
     const uint64_t *cell_indices,
     const Cell *cells,
     const Bytes48 *proofs_bytes,
+    const size_t *entries,
     uint64_t num_cells,
-    const KZGSettings *s
+    const KZGCommitmentHandle *commitment_handles,
+    const KZGProofHandle *proof_handles
 ) {
     C_KZG_RET ret;
     fr_t r;
-    g1_t interpolation_poly_commit;
-    g1_t final_g1_sum;
-    g1_t proof_lincomb;
-    g1_t weighted_sum_of_proofs;
-    g2_t power_of_s = s->g2_values_monomial[FIELD_ELEMENTS_PER_CELL];
-    size_t num_commitments;
-
-    /* Arrays */
     Bytes48 *unique_commitments = NULL;
-    uint64_t *commitment_indices = NULL;
-    fr_t *r_powers = NULL;
-    g1_t *proofs_g1 = NULL;
-
-    *ok = false;
+    g1_t *points_g1 = NULL;
 
-    /* Exit early if we are given zero cells */
-    if (num_cells == 0) {
-        *ok = true;
-        return C_KZG_OK;
-    }
+    batch->commitments_affine = NULL;
+    batch->commitment_indices = NULL;
+    batch->cell_indices = NULL;
+    batch->cells_fr = NULL;
+    batch->proofs_affine = NULL;
+    batch->r_powers = NULL;
+    batch->num_commitments = 0;
+    batch->num_cells = (size_t)num_cells;
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
     // Sanity checks
     ////////////////////////////////////////////////////////////////////////////////////////////////
 
     for (size_t i = 0; i < num_cells; i++) {
+        size_t j = entries == NULL ? i : entries[i];
         /* Make sure column index is valid */
-        if (cell_indices[i] >= CELLS_PER_EXT_BLOB) return C_KZG_BADARGS;
+        if (cell_indices[j] >= CELLS_PER_EXT_BLOB) return C_KZG_BADARGS;
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -846,7 +1066,9 @@ C_KZG_RET verify_cell_kzg_proof_batch(
 
     ret = c_kzg_calloc((void **)&unique_commitments, (size_t)num_cells, sizeof(Bytes48));
     if (ret != C_KZG_OK) goto out;
-    ret = c_kzg_calloc((void **)&commitment_indices, (size_t)num_cells, sizeof(uint64_t));
+    ret = c_kzg_calloc((void **)&batch->commitment_indices, (size_t)num_cells, sizeof(uint64_t));
+    if (ret != C_KZG_OK) goto out;
+    ret = c_kzg_calloc((void **)&batch->cell_indices, (size_t)num_cells, sizeof(uint64_t));
     if (ret != C_KZG_OK) goto out;
 
     /*
@@ -854,32 +1076,48 @@ C_KZG_RET verify_cell_kzg_proof_batch(
      * indices to those unique commitments. We do this before the array allocations section below
      * because we need to know how many commitment weights there will be.
      */
-    num_commitments = (size_t)num_cells;
-    memcpy(unique_commitments, commitments_bytes,(size_t) num_cells * sizeof(Bytes48));
-    deduplicate_commitments(unique_commitments, commitment_indices, &num_commitments);
+    batch->num_commitments = (size_t)num_cells;
+    for (size_t i = 0; i < num_cells; i++) {
+        size_t j = entries == NULL ? i : entries[i];
+        unique_commitments[i] = commitments_bytes[j];
+        batch->cell_indices[i] = cell_indices[j];
+    }
+    ret = deduplicate_commitments(
+        unique_commitments, batch->commitment_indices, &batch->num_commitments
+    );
+    if (ret != C_KZG_OK) goto out;
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
     // Array allocations
     ////////////////////////////////////////////////////////////////////////////////////////////////
 
-    ret = new_fr_array(&r_powers, (size_t)num_cells);
+    ret = c_kzg_calloc(
+        (void **)&batch->commitments_affine, batch->num_commitments, sizeof(blst_p1_affine)
+    );
     if (ret != C_KZG_OK) goto out;
-    ret = new_g1_array(&proofs_g1, (size_t)num_cells);
+    ret = new_fr_array(&batch->cells_fr, (size_t)num_cells * FIELD_ELEMENTS_PER_CELL);
+    if (ret != C_KZG_OK) goto out;
+    ret = c_kzg_calloc((void **)&batch->proofs_affine, (size_t)num_cells, sizeof(blst_p1_affine));
+    if (ret != C_KZG_OK) goto out;
+    ret = new_g1_array(&points_g1, (size_t)num_cells);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_fr_array(&batch->r_powers, (size_t)num_cells);
     if (ret != C_KZG_OK) goto out;
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    // Compute powers of r, and extract KZG proofs out of input bytes
+    // Compute powers of r
     ////////////////////////////////////////////////////////////////////////////////////////////////
 
     /* Compute the challenge */
-    ret = compute_verify_cell_kzg_proof_batch_challenge(
+    ret = compute_verify_cell_kzg_proof_batch_challenge_entries(
         &r,
         unique_commitments,
-        num_commitments,
-        commitment_indices,
+        batch->num_commitments,
+        batch->commitment_indices,
         cell_indices,
         cells,
         proofs_bytes,
+        entries,
         num_cells
     );
     if (ret != C_KZG_OK) goto out;
@@ -888,38 +1126,225 @@ C_KZG_RET verify_cell_kzg_proof_batch(
      * Derive random factors for the linear combination. The exponents start with 0. That is, they
      * are r^0, r^1, r^2, r^3, and so on.
      */
-    compute_powers(r_powers, &r, (size_t)num_cells);
+    compute_powers(batch->r_powers, &r, (size_t)num_cells);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Convert untrusted inputs to trusted inputs
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /*
+     * The proofs and commitments are only ever used as MSM bases, so convert them to affine
+     * representation once here rather than in every MSM over them.
+     */
 
     /* There should be a proof for each cell */
-    for (size_t i = 0; i < num_cells; i++) {
-        ret = bytes_to_kzg_proof(&proofs_g1[i], &proofs_bytes[i]);
+    if (proof_handles != NULL) {
+        for (size_t i = 0; i < num_cells; i++) {
+            size_t j = entries == NULL ? i : entries[i];
+            batch->proofs_affine[i] = proof_handles[j].point;
+        }
+    } else {
+        for (size_t i = 0; i < num_cells; i++) {
+            size_t j = entries == NULL ? i : entries[i];
+            ret = bytes_to_kzg_proof(&points_g1[i], &proofs_bytes[j]);
+            if (ret != C_KZG_OK) goto out;
+        }
+        ret = g1s_to_affine(batch->proofs_affine, points_g1, (size_t)num_cells);
         if (ret != C_KZG_OK) goto out;
     }
 
-    ////////////////////////////////////////////////////////////////////////////////////////////////
-    // Compute random linear combination of the proofs
-    ////////////////////////////////////////////////////////////////////////////////////////////////
+    if (commitment_handles != NULL) {
+        /* Equal commitments have equal handles, so any one of them will do */
+        for (size_t i = 0; i < num_cells; i++) {
+            size_t j = entries == NULL ? i : entries[i];
+            batch->commitments_affine[batch->commitment_indices[i]] = commitment_handles[j].point;
+        }
+    } else {
+        /* There are no more unique commitments than cells, so the buffer can be reused */
+        for (size_t i = 0; i < batch->num_commitments; i++) {
+            ret = bytes_to_kzg_commitment(&points_g1[i], &unique_commitments[i]);
+            if (ret != C_KZG_OK) goto out;
+        }
+        ret = g1s_to_affine(batch->commitments_affine, points_g1, batch->num_commitments);
+        if (ret != C_KZG_OK) goto out;
+    }
 
-    ret = g1_lincomb_fast(&proof_lincomb, proofs_g1, r_powers, (size_t)num_cells);
-    if (ret != C_KZG_OK) goto out;
+    for (size_t i = 0; i < num_cells; i++) {
+        const Cell *cell = &cells[entries == NULL ? i : entries[i]];
+        for (size_t j = 0; j < FIELD_ELEMENTS_PER_CELL; j++) {
+            size_t offset = j * BYTES_PER_FIELD_ELEMENT;
+            ret = bytes_to_bls_field(
+                &batch->cells_fr[i * FIELD_ELEMENTS_PER_CELL + j],
+                (const Bytes32 *)&cell->bytes[offset]
+            );
+            if (ret != C_KZG_OK) goto out;
+        }
+    }
+
+out:
+    c_kzg_free(unique_commitments);
+    c_kzg_free(points_g1);
+    return ret;
+}
+
+#ifdef _OPENMP
+/** The number of cell proof batches being verified on the worker threads. */
+static int num_forked_verifications = 0;
+#endif
+
+/**
+ * Decide whether verifying `n` cells should fork the OpenMP worker threads, and if so claim them.
+ *
+ * Only one batch at a time forks. Callers that already run on a worker thread, and batches
+ * verified concurrently from threads of the caller's own, such as a job queue, run sequentially
+ * instead, so that each of them does not start a team of `OMP_NUM_THREADS` threads of its own.
+ *
+ * @param[in]   n   The number of cells to verify
+ *
+ * @remark If this returns true, release the threads afterwards with release_worker_threads().
+ */
+static bool claim_worker_threads(size_t n) {
+#ifdef _OPENMP
+    int num_before;
+
+    if (n < PARALLEL_VERIFY_MIN_CELLS || omp_in_parallel()) return false;
+
+    OMP_PRAGMA(omp atomic capture)
+    num_before = num_forked_verifications++;
+    if (num_before == 0) return true;
+
+    OMP_PRAGMA(omp atomic update)
+    num_forked_verifications--;
+    return false;
+#else
+    (void)n;
+    return false;
+#endif
+}
+
+/**
+ * Release the OpenMP worker threads claimed by claim_worker_threads().
+ */
+static void release_worker_threads(void) {
+#ifdef _OPENMP
+    OMP_PRAGMA(omp atomic update)
+    num_forked_verifications--;
+#endif
+}
+
+/**
+ * Check the cells `[offset, offset + n)` of a decoded batch of cell proofs.
+ *
+ * @param[out]  ok          True if the proofs are valid
+ * @param[in]   batch       The decoded batch
+ * @param[in]   offset      The index of the first cell to check
+ * @param[in]   n           The number of cells to check
+ * @param[in]   may_fork    False to check the cells on this thread alone, even with OpenMP
+ * @param[in]   s           The trusted setup
+ *
+ * @remark This function only works for `n > 0`.
+ */
+static C_KZG_RET verify_cell_kzg_proof_batch_impl(
+    bool *ok,
+    const CellProofBatch *batch,
+    size_t offset,
+    size_t n,
+    bool may_fork,
+    const KZGSettings *s
+) {
+    C_KZG_RET ret;
+    C_KZG_RET proof_ret = C_KZG_OK, combined_ret = C_KZG_OK, interpolation_ret = C_KZG_OK;
+    g1_t interpolation_poly_commit;
+    g1_t final_g1_sum;
+    g1_t proof_lincomb;
+    g2_t power_of_s = s->g2_values_monomial[FIELD_ELEMENTS_PER_CELL];
+    const fr_t *r_powers = &batch->r_powers[offset];
+    const blst_p1_affine *proofs_affine = &batch->proofs_affine[offset];
+    const uint64_t *cell_indices = &batch->cell_indices[offset];
+    size_t num_commitments = batch->num_commitments;
+    bool fork = false;
+
+    /* Arrays */
+    blst_p1_affine *points = NULL;
+    fr_t *scalars = NULL;
+
+    assert(n > 0);
+    assert(offset + n <= batch->num_cells);
+
+    *ok = false;
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    // Compute sum of the commitments
+    // Array allocations
     ////////////////////////////////////////////////////////////////////////////////////////////////
 
-    ret = compute_weighted_sum_of_commitments(
-        &final_g1_sum, unique_commitments, commitment_indices, r_powers, num_commitments, num_cells
-    );
+    ret = c_kzg_calloc((void **)&points, num_commitments + n, sizeof(blst_p1_affine));
+    if (ret != C_KZG_OK) goto out;
+    ret = new_fr_array(&scalars, num_commitments + n);
     if (ret != C_KZG_OK) goto out;
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    // Commit to aggregated interpolation polynomial
+    // Combine the commitments and the proofs into a single MSM
     ////////////////////////////////////////////////////////////////////////////////////////////////
 
-    /* Aggregate cells from same columns, sum interpolation polynomials, and commit */
-    ret = compute_commitment_to_aggregated_interpolation_poly(
-        &interpolation_poly_commit, r_powers, cell_indices, cells, num_cells, s
+    /*
+     * The sum of the commitments weighted by the powers of r and the sum of the proofs weighted by
+     * the powers of r scaled by the coset factors are only ever added together. So rather than
+     * two MSMs, compute them as one over the commitments followed by the proofs.
+     */
+    memcpy(points, batch->commitments_affine, num_commitments * sizeof(blst_p1_affine));
+    memcpy(&points[num_commitments], proofs_affine, n * sizeof(blst_p1_affine));
+    compute_commitment_weights(
+        scalars, &batch->commitment_indices[offset], r_powers, num_commitments, n
     );
+    compute_weighted_powers_of_r(&scalars[num_commitments], r_powers, cell_indices, n, s);
+
+    /*
+     * The three stages below are independent of each other. In the parallel mode, the MSMs run as
+     * separate tasks while this thread interpolates the columns, which fans out further. They are
+     * all joined before the results are combined for the pairing check. Without the worker
+     * threads, the region runs on this thread alone and the tasks run one after another.
+     */
+    fork = may_fork && claim_worker_threads(n);
+    OMP_PRAGMA(omp parallel if(fork))
+    OMP_PRAGMA(omp single)
+    {
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        // Compute random linear combination of the proofs
+        ////////////////////////////////////////////////////////////////////////////////////////////
+
+        OMP_PRAGMA(omp task)
+        proof_ret = g1_lincomb_affine(&proof_lincomb, proofs_affine, r_powers, n);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        // Compute sum of the commitments and the proofs scaled by the coset factors
+        ////////////////////////////////////////////////////////////////////////////////////////////
+
+        OMP_PRAGMA(omp task)
+        combined_ret = g1_lincomb_affine(&final_g1_sum, points, scalars, num_commitments + n);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        // Commit to aggregated interpolation polynomial
+        ////////////////////////////////////////////////////////////////////////////////////////////
+
+        /* Aggregate cells from same columns, sum interpolation polynomials, and commit */
+        interpolation_ret = compute_commitment_to_aggregated_interpolation_poly(
+            &interpolation_poly_commit,
+            r_powers,
+            cell_indices,
+            &batch->cells_fr[offset * FIELD_ELEMENTS_PER_CELL],
+            n,
+            s
+        );
+
+        OMP_PRAGMA(omp taskwait)
+    }
+    if (fork) release_worker_threads();
+
+    ret = proof_ret;
+    if (ret != C_KZG_OK) goto out;
+    ret = combined_ret;
+    if (ret != C_KZG_OK) goto out;
+    ret = interpolation_ret;
     if (ret != C_KZG_OK) goto out;
 
     /* Subtract commitment from sum by adding the negated commitment */
@@ -927,26 +1352,1599 @@ C_KZG_RET verify_cell_kzg_proof_batch(
     blst_p1_add(&final_g1_sum, &final_g1_sum, &interpolation_poly_commit);
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    // Compute sum of the proofs scaled by the coset factors
+    // Do the final pairing check
     ////////////////////////////////////////////////////////////////////////////////////////////////
 
-    ret = computed_weighted_sum_of_proofs(
-        &weighted_sum_of_proofs, proofs_g1, r_powers, cell_indices, num_cells, s
+    *ok = pairings_verify(&final_g1_sum, blst_p2_generator(), &proof_lincomb, &power_of_s);
+
+out:
+    c_kzg_free(points);
+    c_kzg_free(scalars);
+    return ret;
+}
+
+/**
+ * Find the invalid proofs among the cells `[offset, offset + n)` by recursive bisection.
+ *
+ * When a range fails it is split in two, and if the left half passes the right half is known to be
+ * invalid without checking it. A single invalid proof is therefore found with O(log n) checks.
+ *
+ * @param[out]      invalid_indices_out The indices of the invalid proofs are appended here
+ * @param[in,out]   num_invalid_out     The number of indices written to `invalid_indices_out`
+ * @param[in]       batch               The decoded batch
+ * @param[in]       offset              The index of the first cell of the range
+ * @param[in]       n                   The number of cells in the range
+ * @param[in]       known_invalid       True if the range is already known to be invalid
+ * @param[in]       s                   The trusted setup
+ */
+static C_KZG_RET locate_invalid_cell_kzg_proofs(
+    uint64_t *invalid_indices_out,
+    uint64_t *num_invalid_out,
+    const CellProofBatch *batch,
+    size_t offset,
+    size_t n,
+    bool known_invalid,
+    const KZGSettings *s
+) {
+    C_KZG_RET ret;
+    bool ok;
+
+    if (!known_invalid) {
+        /* Only the whole batch is worth forking for, the ranges bisection checks are too small */
+        bool may_fork = n == batch->num_cells;
+        ret = verify_cell_kzg_proof_batch_impl(&ok, batch, offset, n, may_fork, s);
+        if (ret != C_KZG_OK) return ret;
+        if (ok) return C_KZG_OK;
+    }
+
+    /* We have found an invalid proof */
+    if (n == 1) {
+        invalid_indices_out[(*num_invalid_out)++] = offset;
+        return C_KZG_OK;
+    }
+
+    size_t half = n / 2;
+    uint64_t num_invalid_before = *num_invalid_out;
+    ret = locate_invalid_cell_kzg_proofs(
+        invalid_indices_out, num_invalid_out, batch, offset, half, false, s
+    );
+    if (ret != C_KZG_OK) return ret;
+
+    /* If the left half is valid, the right half must hold the invalid proofs */
+    bool right_known_invalid = *num_invalid_out == num_invalid_before;
+    return locate_invalid_cell_kzg_proofs(
+        invalid_indices_out, num_invalid_out, batch, offset + half, n - half, right_known_invalid, s
+    );
+}
+
+/**
+ * Helper function for verify_cell_kzg_proof_batch(): verify some of the proofs without consulting
+ * the verify cache.
+ *
+ * @param[out]  ok                  True if the proofs are valid
+ * @param[in]   commitments_bytes   The commitments for the cells
+ * @param[in]   cell_indices        The indices for the cells
+ * @param[in]   cells               The cells to check
+ * @param[in]   proofs_bytes        The proofs for the cells
+ * @param[in]   entries             The entries of the arrays to verify, or NULL for all
+ * @param[in]   num_cells           The number of cells to verify
+ * @param[in]   s                   The trusted setup
+ */
+static C_KZG_RET verify_cell_kzg_proof_batch_uncached(
+    bool *ok,
+    const Bytes48 *commitments_bytes,
+    const uint64_t *cell_indices,
+    const Cell *cells,
+    const Bytes48 *proofs_bytes,
+    const size_t *entries,
+    uint64_t num_cells,
+    const KZGSettings *s
+) {
+    C_KZG_RET ret;
+    CellProofBatch batch;
+
+    *ok = false;
+
+    /* Exit early if we are given zero cells */
+    if (num_cells == 0) {
+        *ok = true;
+        return C_KZG_OK;
+    }
+
+    ret = prepare_cell_kzg_proof_batch(
+        &batch, commitments_bytes, cell_indices, cells, proofs_bytes, entries, num_cells, NULL, NULL
     );
     if (ret != C_KZG_OK) goto out;
 
-    blst_p1_add(&final_g1_sum, &final_g1_sum, &weighted_sum_of_proofs);
+    ret = verify_cell_kzg_proof_batch_impl(ok, &batch, 0, (size_t)num_cells, true, s);
 
-    ////////////////////////////////////////////////////////////////////////////////////////////////
-    // Do the final pairing check
-    ////////////////////////////////////////////////////////////////////////////////////////////////
+out:
+    free_cell_kzg_proof_batch(&batch);
+    return ret;
+}
 
-    *ok = pairings_verify(&final_g1_sum, blst_p2_generator(), &proof_lincomb, &power_of_s);
+/**
+ * Given some cells, verify that their proofs are valid.
+ *
+ * @param[out]  ok                  True if the proofs are valid
+ * @param[in]   commitments_bytes   The commitments for the cells, length `num_cells`
+ * @param[in]   cell_indices        The indices for the cells, length `num_cells`
+ * @param[in]   cells               The cells to check, length `num_cells`
+ * @param[in]   proofs_bytes        The proofs for the cells, length `num_cells`
+ * @param[in]   num_cells           The number of cells provided
+ * @param[in]   s                   The trusted setup
+ *
+ * @remark If the settings have a verify cache, proofs that were accepted before are skipped, and
+ * the proofs accepted now are added to it.
+ */
+C_KZG_RET verify_cell_kzg_proof_batch(
+    bool *ok,
+    const Bytes48 *commitments_bytes,
+    const uint64_t *cell_indices,
+    const Cell *cells,
+    const Bytes48 *proofs_bytes,
+    uint64_t num_cells,
+    const KZGSettings *s
+) {
+    C_KZG_RET ret;
+    Bytes32 *keys = NULL;
+    bool *is_cached = NULL;
+    size_t *uncached_indices = NULL;
+    size_t num_uncached = 0;
+
+    if (s->verify_cache == NULL || num_cells == 0) {
+        return verify_cell_kzg_proof_batch_uncached(
+            ok, commitments_bytes, cell_indices, cells, proofs_bytes, NULL, num_cells, s
+        );
+    }
+
+    *ok = false;
+
+    ret = c_kzg_calloc((void **)&keys, (size_t)num_cells, sizeof(Bytes32));
+    if (ret != C_KZG_OK) goto out;
+    ret = new_bool_array(&is_cached, (size_t)num_cells);
+    if (ret != C_KZG_OK) goto out;
+
+    for (size_t i = 0; i < num_cells; i++) {
+        compute_verify_cache_key(
+            &keys[i],
+            VERIFY_CACHE_DOMAIN_CELL_KZG_PROOF,
+            &commitments_bytes[i],
+            cell_indices[i],
+            cells[i].bytes,
+            BYTES_PER_CELL,
+            &proofs_bytes[i]
+        );
+    }
+    verify_cache_contains_many(s->verify_cache, is_cached, keys, (size_t)num_cells);
+
+    for (size_t i = 0; i < num_cells; i++) {
+        if (!is_cached[i]) num_uncached++;
+    }
+
+    /* Exit early if every proof was accepted before */
+    if (num_uncached == 0) {
+        *ok = true;
+        goto out;
+    }
+
+    ret = c_kzg_calloc((void **)&uncached_indices, num_uncached, sizeof(size_t));
+    if (ret != C_KZG_OK) goto out;
+
+    /* Index the proofs that still need verifying, keeping their keys in step */
+    num_uncached = 0;
+    for (size_t i = 0; i < num_cells; i++) {
+        if (is_cached[i]) continue;
+        uncached_indices[num_uncached] = i;
+        keys[num_uncached] = keys[i];
+        num_uncached++;
+    }
+
+    ret = verify_cell_kzg_proof_batch_uncached(
+        ok,
+        commitments_bytes,
+        cell_indices,
+        cells,
+        proofs_bytes,
+        uncached_indices,
+        num_uncached,
+        s
+    );
+    if (ret != C_KZG_OK) goto out;
+
+    /* Only remember the proofs once they have all been accepted */
+    if (*ok) verify_cache_insert_many(s->verify_cache, keys, num_uncached);
 
 out:
-    c_kzg_free(unique_commitments);
-    c_kzg_free(commitment_indices);
-    c_kzg_free(r_powers);
-    c_kzg_free(proofs_g1);
+    c_kzg_free(keys);
+    c_kzg_free(is_cached);
+    c_kzg_free(uncached_indices);
+    return ret;
+}
+
+/**
+ * Given some cells, verify that their proofs are valid, and find the ones that are not.
+ *
+ * The whole batch is checked first. Only if that fails is it bisected to find the invalid cells,
+ * reusing the decoded inputs and the batch weights throughout.
+ *
+ * @param[out]  ok                  True if the proofs are valid
+ * @param[out]  invalid_indices_out The positions of the invalid cells in ascending order, length
+ *                                  `num_cells`
+ * @param[out]  num_invalid_out     The number of indices written to `invalid_indices_out`
+ * @param[in]   commitments_bytes   The commitments for the cells, length `num_cells`
+ * @param[in]   cell_indices        The indices for the cells, length `num_cells`
+ * @param[in]   cells               The cells to check, length `num_cells`
+ * @param[in]   proofs_bytes        The proofs for the cells, length `num_cells`
+ * @param[in]   num_cells           The number of cells provided
+ * @param[in]   s                   The trusted setup
+ *
+ * @remark The invalid indices are positions in the input arrays, not cell indices.
+ */
+C_KZG_RET verify_cell_kzg_proof_batch_locate(
+    bool *ok,
+    uint64_t *invalid_indices_out,
+    uint64_t *num_invalid_out,
+    const Bytes48 *commitments_bytes,
+    const uint64_t *cell_indices,
+    const Cell *cells,
+    const Bytes48 *proofs_bytes,
+    uint64_t num_cells,
+    const KZGSettings *s
+) {
+    C_KZG_RET ret;
+    CellProofBatch batch;
+
+    *ok = false;
+    *num_invalid_out = 0;
+
+    /* Exit early if we are given zero cells */
+    if (num_cells == 0) {
+        *ok = true;
+        return C_KZG_OK;
+    }
+
+    ret = prepare_cell_kzg_proof_batch(
+        &batch, commitments_bytes, cell_indices, cells, proofs_bytes, NULL, num_cells, NULL, NULL
+    );
+    if (ret != C_KZG_OK) goto out;
+
+    ret = locate_invalid_cell_kzg_proofs(
+        invalid_indices_out, num_invalid_out, &batch, 0, (size_t)num_cells, false, s
+    );
+    if (ret != C_KZG_OK) goto out;
+
+    *ok = *num_invalid_out == 0;
+
+out:
+    free_cell_kzg_proof_batch(&batch);
+    return ret;
+}
+
+/**
+ * Given some cells, verify that their proofs are valid, like verify_cell_kzg_proof_batch(), but
+ * with commitments and proofs that have already been validated.
+ *
+ * The handles are compressed again for the challenge, which is far cheaper than decompressing and
+ * checking the subgroup of every point.
+ *
+ * @param[out]  ok              True if the proofs are valid
+ * @param[in]   commitments     The commitments for the cells, length `num_cells`
+ * @param[in]   cell_indices    The indices for the cells, length `num_cells`
+ * @param[in]   cells           The cells to check, length `num_cells`
+ * @param[in]   proofs          The proofs for the cells, length `num_cells`
+ * @param[in]   num_cells       The number of cells provided
+ * @param[in]   s               The trusted setup
+ */
+C_KZG_RET verify_cell_kzg_proof_batch_with_handles(
+    bool *ok,
+    const KZGCommitmentHandle *commitments,
+    const uint64_t *cell_indices,
+    const Cell *cells,
+    const KZGProofHandle *proofs,
+    uint64_t num_cells,
+    const KZGSettings *s
+) {
+    C_KZG_RET ret;
+    CellProofBatch batch;
+    Bytes48 *commitments_bytes = NULL;
+    Bytes48 *proofs_bytes = NULL;
+
+    *ok = false;
+
+    /* Exit early if we are given zero cells */
+    if (num_cells == 0) {
+        *ok = true;
+        return C_KZG_OK;
+    }
+
+    /* Make the batch safe to free before it is prepared */
+    memset(&batch, 0, sizeof(batch));
+
+    ret = c_kzg_calloc((void **)&commitments_bytes, (size_t)num_cells, sizeof(Bytes48));
+    if (ret != C_KZG_OK) goto out;
+    ret = c_kzg_calloc((void **)&proofs_bytes, (size_t)num_cells, sizeof(Bytes48));
+    if (ret != C_KZG_OK) goto out;
+
+    for (size_t i = 0; i < num_cells; i++) {
+        blst_p1_affine_compress(commitments_bytes[i].bytes, &commitments[i].point);
+        blst_p1_affine_compress(proofs_bytes[i].bytes, &proofs[i].point);
+    }
+
+    ret = prepare_cell_kzg_proof_batch(
+        &batch,
+        commitments_bytes,
+        cell_indices,
+        cells,
+        proofs_bytes,
+        NULL,
+        num_cells,
+        commitments,
+        proofs
+    );
+    if (ret != C_KZG_OK) goto out;
+
+    ret = verify_cell_kzg_proof_batch_impl(ok, &batch, 0, (size_t)num_cells, true, s);
+
+out:
+    free_cell_kzg_proof_batch(&batch);
+    c_kzg_free(commitments_bytes);
+    c_kzg_free(proofs_bytes);
+    return ret;
+}
+
+/**
+ * Compute the challenge value used for verification of a data column's cell KZG proofs.
+ *
+ * This writes the same transcript that compute_verify_cell_kzg_proof_batch_challenge() would for
+ * the column, with every commitment treated as unique, but straight from the inputs rather than
+ * from separately built index arrays.
+ *
+ * @param[out]  challenge_out       The output challenge as a BLS field element
+ * @param[in]   column_index        The index of the column
+ * @param[in]   commitments_bytes   The commitments for the cells, length `num_cells`
+ * @param[in]   cells               The cells of the column, length `num_cells`
+ * @param[in]   proofs_bytes        The proofs for the cells, length `num_cells`
+ * @param[in]   num_cells           The number of cells
+ */
+static C_KZG_RET compute_verify_data_column_kzg_proofs_challenge(
+    fr_t *challenge_out,
+    uint64_t column_index,
+    const Bytes48 *commitments_bytes,
+    const Cell *cells,
+    const Bytes48 *proofs_bytes,
+    uint64_t num_cells
+) {
+    C_KZG_RET ret;
+    uint8_t *bytes = NULL;
+    Bytes32 r_bytes;
+
+    /* Calculate the size of the data we're going to hash */
+    size_t input_size = DOMAIN_STR_LENGTH                          /* The domain separator */
+                        + sizeof(uint64_t)                         /* FIELD_ELEMENTS_PER_BLOB */
+                        + sizeof(uint64_t)                         /* FIELD_ELEMENTS_PER_CELL */
+                        + sizeof(uint64_t)                         /* num_commitments */
+                        + sizeof(uint64_t)                         /* num_cells */
+                        + (size_t)(num_cells * BYTES_PER_COMMITMENT) /* commitment_bytes */
+                        + (size_t)(num_cells * sizeof(uint64_t))     /* commitment_indices */
+                        + (size_t)(num_cells * sizeof(uint64_t))     /* cell_indices */
+                        + (size_t)(num_cells * BYTES_PER_CELL)       /* cells */
+                        + (size_t)(num_cells * BYTES_PER_PROOF);     /* proofs_bytes */
+
+    /* Allocate space to copy this data into */
+    ret = c_kzg_malloc((void **)&bytes, input_size);
+    if (ret != C_KZG_OK) goto out;
+
+    /* Pointer tracking `bytes` for writing on top of it */
+    uint8_t *offset = bytes;
+
+    /* Ensure that the domain string is the correct length */
+    assert(strlen(RANDOM_CHALLENGE_DOMAIN_VERIFY_CELL_KZG_PROOF_BATCH) == DOMAIN_STR_LENGTH);
+
+    /* Copy domain separator */
+    memcpy(offset, RANDOM_CHALLENGE_DOMAIN_VERIFY_CELL_KZG_PROOF_BATCH, DOMAIN_STR_LENGTH);
+    offset += DOMAIN_STR_LENGTH;
+
+    /* Copy field elements per blob */
+    bytes_from_uint64(offset, FIELD_ELEMENTS_PER_BLOB);
+    offset += sizeof(uint64_t);
+
+    /* Copy field elements per cell */
+    bytes_from_uint64(offset, FIELD_ELEMENTS_PER_CELL);
+    offset += sizeof(uint64_t);
+
+    /* Copy number of commitments, there is one per cell */
+    bytes_from_uint64(offset, num_cells);
+    offset += sizeof(uint64_t);
+
+    /* Copy number of cells */
+    bytes_from_uint64(offset, num_cells);
+    offset += sizeof(uint64_t);
+
+    /* Copy all commitments in one go */
+    memcpy(offset, commitments_bytes, (size_t)num_cells * BYTES_PER_COMMITMENT);
+    offset += (size_t)num_cells * BYTES_PER_COMMITMENT;
+
+    for (size_t i = 0; i < num_cells; i++) {
+        /* Copy row id, each cell has its own commitment */
+        bytes_from_uint64(offset, i);
+        offset += sizeof(uint64_t);
+
+        /* Copy column id */
+        bytes_from_uint64(offset, column_index);
+        offset += sizeof(uint64_t);
+
+        /* Copy cell */
+        memcpy(offset, &cells[i], BYTES_PER_CELL);
+        offset += BYTES_PER_CELL;
+
+        /* Copy proof */
+        memcpy(offset, &proofs_bytes[i], BYTES_PER_PROOF);
+        offset += BYTES_PER_PROOF;
+    }
+
+    /* Make sure we wrote the entire buffer */
+    assert(offset == bytes + input_size);
+
+    /* Create the challenge hash */
+    blst_sha256(r_bytes.bytes, bytes, input_size);
+
+    /* Convert to BLS field element */
+    hash_to_bls_field(challenge_out, &r_bytes);
+
+out:
+    c_kzg_free(bytes);
+    return ret;
+}
+
+/**
+ * Given the cells of a data column, one per blob, verify that their proofs are valid.
+ *
+ * This gives the same result as verify_cell_kzg_proof_batch() with every cell index set to
+ * `column_index`, but takes advantage of the column's shape: the commitments are not deduplicated,
+ * the cells are aggregated into a single column which takes one interpolation, and because every
+ * proof shares the same coset factor the coset-weighted proof sum is a single scalar
+ * multiplication of the proof lincomb rather than a second MSM.
+ *
+ * @param[out]  ok                  True if the proofs are valid
+ * @param[in]   column_index        The cell index shared by every cell of the column
+ * @param[in]   commitments_bytes   The commitments for the cells, length `num_cells`
+ * @param[in]   cells               The cells to check, length `num_cells`
+ * @param[in]   proofs_bytes        The proofs for the cells, length `num_cells`
+ * @param[in]   num_cells           The number of cells provided
+ * @param[in]   s                   The trusted setup
+ *
+ * @remark The commitments are expected to be unique, as they are in a data column sidecar. The
+ * result is still correct if they are not, they are just not combined.
+ */
+C_KZG_RET verify_data_column_kzg_proofs(
+    bool *ok,
+    uint64_t column_index,
+    const Bytes48 *commitments_bytes,
+    const Cell *cells,
+    const Bytes48 *proofs_bytes,
+    uint64_t num_cells,
+    const KZGSettings *s
+) {
+    C_KZG_RET ret;
+    fr_t r, h_k_pow;
+    g1_t interpolation_poly_commit;
+    g1_t final_g1_sum;
+    g1_t proof_lincomb;
+    g1_t weighted_sum_of_proofs;
+    g2_t power_of_s = s->g2_values_monomial[FIELD_ELEMENTS_PER_CELL];
+    fr_t column[FIELD_ELEMENTS_PER_CELL];
+    fr_t interpolation_poly[FIELD_ELEMENTS_PER_CELL];
+
+    /* Arrays */
+    g1_t *commitments_g1 = NULL;
+    g1_t *proofs_g1 = NULL;
+    fr_t *r_powers = NULL;
+
+    *ok = false;
+
+    /* Exit early if we are given zero cells */
+    if (num_cells == 0) {
+        *ok = true;
+        return C_KZG_OK;
+    }
+
+    /* Make sure column index is valid */
+    if (column_index >= CELLS_PER_EXT_BLOB) return C_KZG_BADARGS;
+
+    ret = new_g1_array(&commitments_g1, (size_t)num_cells);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_g1_array(&proofs_g1, (size_t)num_cells);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_fr_array(&r_powers, (size_t)num_cells);
+    if (ret != C_KZG_OK) goto out;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Compute powers of r
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ret = compute_verify_data_column_kzg_proofs_challenge(
+        &r, column_index, commitments_bytes, cells, proofs_bytes, num_cells
+    );
+    if (ret != C_KZG_OK) goto out;
+
+    compute_powers(r_powers, &r, (size_t)num_cells);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Convert inputs, aggregating the cells into a single column as we go
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+
+    for (size_t j = 0; j < FIELD_ELEMENTS_PER_CELL; j++) {
+        column[j] = FR_ZERO;
+    }
+
+    for (size_t i = 0; i < num_cells; i++) {
+        ret = bytes_to_kzg_commitment(&commitments_g1[i], &commitments_bytes[i]);
+        if (ret != C_KZG_OK) goto out;
+        ret = bytes_to_kzg_proof(&proofs_g1[i], &proofs_bytes[i]);
+        if (ret != C_KZG_OK) goto out;
+
+        for (size_t j = 0; j < FIELD_ELEMENTS_PER_CELL; j++) {
+            fr_t field_element;
+            size_t offset = j * BYTES_PER_FIELD_ELEMENT;
+            ret = bytes_to_bls_field(&field_element, (const Bytes32 *)&cells[i].bytes[offset]);
+            if (ret != C_KZG_OK) goto out;
+
+            /* Scale the field element by the appropriate power of r and aggregate it */
+            blst_fr_mul(&field_element, &field_element, &r_powers[i]);
+            blst_fr_add(&column[j], &column[j], &field_element);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Compute random linear combinations of the proofs and the commitments
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ret = g1_lincomb_fast(&proof_lincomb, proofs_g1, r_powers, (size_t)num_cells);
+    if (ret != C_KZG_OK) goto out;
+
+    ret = g1_lincomb_fast(&final_g1_sum, commitments_g1, r_powers, (size_t)num_cells);
+    if (ret != C_KZG_OK) goto out;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Commit to the interpolation polynomial of the aggregated column
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ret = interpolate_cell_column(interpolation_poly, column, column_index, s);
+    if (ret != C_KZG_OK) goto out;
+
+    ret = commit_to_cell_poly(&interpolation_poly_commit, interpolation_poly, s);
+    if (ret != C_KZG_OK) goto out;
+
+    /* Subtract commitment from sum by adding the negated commitment */
+    blst_p1_cneg(&interpolation_poly_commit, true);
+    blst_p1_add(&final_g1_sum, &final_g1_sum, &interpolation_poly_commit);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Scale the proof lincomb by the coset factor, which is the same for every proof
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+
+    get_coset_shift_pow_for_cell(&h_k_pow, column_index, s);
+    g1_mul(&weighted_sum_of_proofs, &proof_lincomb, &h_k_pow);
+
+    blst_p1_add(&final_g1_sum, &final_g1_sum, &weighted_sum_of_proofs);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Do the final pairing check
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+
+    *ok = pairings_verify(&final_g1_sum, blst_p2_generator(), &proof_lincomb, &power_of_s);
+
+out:
+    c_kzg_free(commitments_g1);
+    c_kzg_free(proofs_g1);
+    c_kzg_free(r_powers);
+    return ret;
+}
+
+/**
+ * Compute the challenge value used for verification of all the cell KZG proofs of one blob.
+ *
+ * @param[out]  challenge_out       The output challenge as a BLS field element
+ * @param[in]   commitment_bytes    The commitment to the blob
+ * @param[in]   data                The blob or all of its cells
+ * @param[in]   data_len            The number of bytes in `data`
+ * @param[in]   proofs_bytes        The proofs for the cells, length `CELLS_PER_EXT_BLOB`
+ *
+ * @remark The data length is part of the transcript, so a blob and its cells never collide.
+ */
+static C_KZG_RET compute_verify_blob_cell_kzg_proofs_challenge(
+    fr_t *challenge_out,
+    const Bytes48 *commitment_bytes,
+    const uint8_t *data,
+    size_t data_len,
+    const Bytes48 *proofs_bytes
+) {
+    C_KZG_RET ret;
+    uint8_t *bytes = NULL;
+    Bytes32 r_bytes;
+
+    /* Calculate the size of the data we're going to hash */
+    size_t input_size = DOMAIN_STR_LENGTH                       /* The domain separator */
+                        + sizeof(uint64_t)                      /* FIELD_ELEMENTS_PER_BLOB */
+                        + sizeof(uint64_t)                      /* FIELD_ELEMENTS_PER_CELL */
+                        + BYTES_PER_COMMITMENT                  /* commitment_bytes */
+                        + sizeof(uint64_t)                      /* data_len */
+                        + data_len                              /* data */
+                        + CELLS_PER_EXT_BLOB * BYTES_PER_PROOF; /* proofs_bytes */
+
+    /* Allocate space to copy this data into */
+    ret = c_kzg_malloc((void **)&bytes, input_size);
+    if (ret != C_KZG_OK) goto out;
+
+    /* Pointer tracking `bytes` for writing on top of it */
+    uint8_t *offset = bytes;
+
+    /* Ensure that the domain string is the correct length */
+    assert(strlen(RANDOM_CHALLENGE_DOMAIN_VERIFY_BLOB_CELL_KZG_PROOFS) == DOMAIN_STR_LENGTH);
+
+    /* Copy domain separator */
+    memcpy(offset, RANDOM_CHALLENGE_DOMAIN_VERIFY_BLOB_CELL_KZG_PROOFS, DOMAIN_STR_LENGTH);
+    offset += DOMAIN_STR_LENGTH;
+
+    /* Copy field elements per blob */
+    bytes_from_uint64(offset, FIELD_ELEMENTS_PER_BLOB);
+    offset += sizeof(uint64_t);
+
+    /* Copy field elements per cell */
+    bytes_from_uint64(offset, FIELD_ELEMENTS_PER_CELL);
+    offset += sizeof(uint64_t);
+
+    /* Copy commitment */
+    memcpy(offset, commitment_bytes, BYTES_PER_COMMITMENT);
+    offset += BYTES_PER_COMMITMENT;
+
+    /* Copy the length of the data */
+    bytes_from_uint64(offset, data_len);
+    offset += sizeof(uint64_t);
+
+    /* Copy the blob or the cells */
+    memcpy(offset, data, data_len);
+    offset += data_len;
+
+    /* Copy all proofs in one go */
+    memcpy(offset, proofs_bytes, CELLS_PER_EXT_BLOB * BYTES_PER_PROOF);
+    offset += CELLS_PER_EXT_BLOB * BYTES_PER_PROOF;
+
+    /* Make sure we wrote the entire buffer */
+    assert(offset == bytes + input_size);
+
+    /* Create the challenge hash */
+    blst_sha256(r_bytes.bytes, bytes, input_size);
+
+    /* Convert to BLS field element */
+    hash_to_bls_field(challenge_out, &r_bytes);
+
+out:
+    c_kzg_free(bytes);
+    return ret;
+}
+
+/**
+ * Verify all `CELLS_PER_EXT_BLOB` cell proofs of a single blob against its commitment.
+ *
+ * This gives the same result as verify_cell_kzg_proof_batch() over every cell of the blob, but
+ * takes advantage of the full row. Let Q be the polynomial which takes the cell values on the
+ * whole extended domain, split into chunks `Q(X) = sum_t X^(64t) Q_t(X)`. The interpolation
+ * polynomial of cell k is Q reduced modulo `X^64 - h_k^64`, which is `sum_t (h_k^64)^t Q_t(X)`.
+ * Since the `h_k^64` are the 128th roots of unity, the random linear combination of all the
+ * interpolation polynomials is `sum_t w_t Q_t(X)` where `w` is a single 128-point FFT of the
+ * bit-reversed powers of r. So instead of one interpolation per cell, this takes one transform
+ * over the whole row. It is cheapest when given the blob, where Q is the blob polynomial itself.
+ *
+ * With a single commitment, the commitment sum is also a single scalar multiplication, which is
+ * folded into the MSM over the coset-weighted proofs.
+ *
+ * @param[out]  ok                  True if the proofs are valid
+ * @param[in]   blob                The blob, or NULL if `cells` is given
+ * @param[in]   cells               All `CELLS_PER_EXT_BLOB` cells, or NULL if `blob` is given
+ * @param[in]   commitment_bytes    The commitment to the blob
+ * @param[in]   proofs_bytes        The proofs for the cells, length `CELLS_PER_EXT_BLOB`
+ * @param[in]   s                   The trusted setup
+ *
+ * @remark Exactly one of `blob` and `cells` must be non-NULL.
+ */
+C_KZG_RET verify_blob_cell_kzg_proofs(
+    bool *ok,
+    const Blob *blob,
+    const Cell *cells,
+    const Bytes48 *commitment_bytes,
+    const Bytes48 *proofs_bytes,
+    const KZGSettings *s
+) {
+    C_KZG_RET ret;
+    fr_t r;
+    g1_t commitment;
+    g1_t proof_lincomb;
+    g1_t final_g1_sum;
+    g1_t interpolation_poly_commit;
+    g2_t power_of_s = s->g2_values_monomial[FIELD_ELEMENTS_PER_CELL];
+    size_t num_chunks;
+    fr_t r_powers[CELLS_PER_EXT_BLOB];
+    fr_t r_powers_brp[CELLS_PER_EXT_BLOB];
+    fr_t chunk_weights[CELLS_PER_EXT_BLOB];
+    fr_t aggregated_interpolation_poly[FIELD_ELEMENTS_PER_CELL];
+
+    /* Arrays */
+    fr_t *poly_lagrange = NULL;
+    fr_t *poly_monomial = NULL;
+    g1_t *proofs_g1 = NULL;
+    blst_p1_affine *points = NULL;
+    fr_t *scalars = NULL;
+
+    *ok = false;
+
+    /* We need exactly one of these */
+    if ((blob == NULL) == (cells == NULL)) return C_KZG_BADARGS;
+
+    ret = new_fr_array(&poly_lagrange, FIELD_ELEMENTS_PER_EXT_BLOB);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_fr_array(&poly_monomial, FIELD_ELEMENTS_PER_EXT_BLOB);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_g1_array(&proofs_g1, CELLS_PER_EXT_BLOB);
+    if (ret != C_KZG_OK) goto out;
+    ret = c_kzg_calloc((void **)&points, CELLS_PER_EXT_BLOB + 1, sizeof(blst_p1_affine));
+    if (ret != C_KZG_OK) goto out;
+    ret = new_fr_array(&scalars, CELLS_PER_EXT_BLOB + 1);
+    if (ret != C_KZG_OK) goto out;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Compute powers of r
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+
+    if (blob != NULL) {
+        ret = compute_verify_blob_cell_kzg_proofs_challenge(
+            &r, commitment_bytes, blob->bytes, BYTES_PER_BLOB, proofs_bytes
+        );
+    } else {
+        ret = compute_verify_blob_cell_kzg_proofs_challenge(
+            &r,
+            commitment_bytes,
+            cells[0].bytes,
+            CELLS_PER_EXT_BLOB * BYTES_PER_CELL,
+            proofs_bytes
+        );
+    }
+    if (ret != C_KZG_OK) goto out;
+
+    compute_powers(r_powers, &r, CELLS_PER_EXT_BLOB);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Convert untrusted inputs to trusted inputs
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ret = bytes_to_kzg_commitment(&commitment, commitment_bytes);
+    if (ret != C_KZG_OK) goto out;
+
+    for (size_t i = 0; i < CELLS_PER_EXT_BLOB; i++) {
+        ret = bytes_to_kzg_proof(&proofs_g1[i], &proofs_bytes[i]);
+        if (ret != C_KZG_OK) goto out;
+    }
+
+    /* The proofs are used in two MSMs, so convert them to affine representation once */
+    ret = g1s_to_affine(&points[1], proofs_g1, CELLS_PER_EXT_BLOB);
+    if (ret != C_KZG_OK) goto out;
+    blst_p1_to_affine(&points[0], &commitment);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Get the polynomial for the whole row in monomial form
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+
+    if (blob != NULL) {
+        /* The blob polynomial, only the first FIELD_ELEMENTS_PER_BLOB coefficients are set */
+        ret = blob_to_polynomial(poly_lagrange, blob);
+        if (ret != C_KZG_OK) goto out;
+        ret = poly_lagrange_to_monomial(poly_monomial, poly_lagrange, FIELD_ELEMENTS_PER_BLOB, s);
+        if (ret != C_KZG_OK) goto out;
+        num_chunks = CELLS_PER_BLOB;
+    } else {
+        /* The cells are the bit-reversed evaluations over the extended domain */
+        for (size_t i = 0; i < CELLS_PER_EXT_BLOB; i++) {
+            for (size_t j = 0; j < FIELD_ELEMENTS_PER_CELL; j++) {
+                size_t offset = j * BYTES_PER_FIELD_ELEMENT;
+                ret = bytes_to_bls_field(
+                    &poly_lagrange[i * FIELD_ELEMENTS_PER_CELL + j],
+                    (const Bytes32 *)&cells[i].bytes[offset]
+                );
+                if (ret != C_KZG_OK) goto out;
+            }
+        }
+        ret = bit_reversal_permutation(poly_lagrange, sizeof(fr_t), FIELD_ELEMENTS_PER_EXT_BLOB);
+        if (ret != C_KZG_OK) goto out;
+        ret = fr_ifft(poly_monomial, poly_lagrange, FIELD_ELEMENTS_PER_EXT_BLOB, s);
+        if (ret != C_KZG_OK) goto out;
+        num_chunks = CELLS_PER_EXT_BLOB;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Commit to the aggregated interpolation polynomial
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /*
+     * The chunk weights are w_t = sum_k r^k (h_k^64)^t. With h_k^64 = w^rbl(k), where w is the
+     * 128th root of unity, this is a forward FFT of the powers of r in bit-reversed order.
+     */
+    memcpy(r_powers_brp, r_powers, sizeof(r_powers));
+    ret = bit_reversal_permutation(r_powers_brp, sizeof(fr_t), CELLS_PER_EXT_BLOB);
+    if (ret != C_KZG_OK) goto out;
+    ret = fr_fft(chunk_weights, r_powers_brp, CELLS_PER_EXT_BLOB, s);
+    if (ret != C_KZG_OK) goto out;
+
+    /* Sum the weighted chunks of the row polynomial */
+    for (size_t j = 0; j < FIELD_ELEMENTS_PER_CELL; j++) {
+        aggregated_interpolation_poly[j] = FR_ZERO;
+    }
+    for (size_t t = 0; t < num_chunks; t++) {
+        for (size_t j = 0; j < FIELD_ELEMENTS_PER_CELL; j++) {
+            fr_t tmp;
+            blst_fr_mul(&tmp, &poly_monomial[t * FIELD_ELEMENTS_PER_CELL + j], &chunk_weights[t]);
+            blst_fr_add(&aggregated_interpolation_poly[j], &aggregated_interpolation_poly[j], &tmp);
+        }
+    }
+
+    ret = commit_to_cell_poly(&interpolation_poly_commit, aggregated_interpolation_poly, s);
+    if (ret != C_KZG_OK) goto out;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Compute random linear combinations of the commitment and the proofs
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ret = g1_lincomb_affine(&proof_lincomb, &points[1], r_powers, CELLS_PER_EXT_BLOB);
+    if (ret != C_KZG_OK) goto out;
+
+    /*
+     * The commitment is weighted by the sum of the powers of r, and the proof for cell k by r^k
+     * scaled by its coset factor h_k^n.
+     */
+    scalars[0] = FR_ZERO;
+    for (size_t i = 0; i < CELLS_PER_EXT_BLOB; i++) {
+        fr_t h_k_pow;
+        get_coset_shift_pow_for_cell(&h_k_pow, i, s);
+        blst_fr_mul(&scalars[i + 1], &r_powers[i], &h_k_pow);
+        blst_fr_add(&scalars[0], &scalars[0], &r_powers[i]);
+    }
+
+    ret = g1_lincomb_affine(&final_g1_sum, points, scalars, CELLS_PER_EXT_BLOB + 1);
+    if (ret != C_KZG_OK) goto out;
+
+    /* Subtract commitment from sum by adding the negated commitment */
+    blst_p1_cneg(&interpolation_poly_commit, true);
+    blst_p1_add(&final_g1_sum, &final_g1_sum, &interpolation_poly_commit);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Do the final pairing check
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+
+    *ok = pairings_verify(&final_g1_sum, blst_p2_generator(), &proof_lincomb, &power_of_s);
+
+out:
+    c_kzg_free(poly_lagrange);
+    c_kzg_free(poly_monomial);
+    c_kzg_free(proofs_g1);
+    c_kzg_free(points);
+    c_kzg_free(scalars);
+    return ret;
+}
+
+/**
+ * Verify a single cell proof.
+ *
+ * This checks `e(C - [I(s)], G2) == e(proof, [s^n - h_k^n])`, where `I` is the interpolation
+ * polynomial of the cell on its coset. It is the cheapest way to check a handful of cells, like a
+ * sampler does, since it skips the random linear combination and deduplication of the batch path.
+ * The commitment to `I` uses the fixed-base table in the settings. If precompute_cell_g2_lines()
+ * has been called, the G2 side of both Miller loops is precomputed as well.
+ *
+ * @param[out]  ok                  True if the proof is valid
+ * @param[in]   commitment_bytes    The commitment for the cell
+ * @param[in]   cell_index          The index of the cell
+ * @param[in]   cell                The cell to check
+ * @param[in]   proof_bytes         The proof for the cell
+ * @param[in]   s                   The trusted setup
+ */
+C_KZG_RET verify_cell_kzg_proof_single(
+    bool *ok,
+    const Bytes48 *commitment_bytes,
+    uint64_t cell_index,
+    const Cell *cell,
+    const Bytes48 *proof_bytes,
+    const KZGSettings *s
+) {
+    C_KZG_RET ret;
+    g1_t commitment, proof, interpolation_poly_commit;
+    fr_t column[FIELD_ELEMENTS_PER_CELL];
+    fr_t interpolation_poly[FIELD_ELEMENTS_PER_CELL];
+
+    *ok = false;
+
+    /* Make sure cell index is valid */
+    if (cell_index >= CELLS_PER_EXT_BLOB) return C_KZG_BADARGS;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Convert untrusted inputs to trusted inputs
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ret = bytes_to_kzg_commitment(&commitment, commitment_bytes);
+    if (ret != C_KZG_OK) return ret;
+    ret = bytes_to_kzg_proof(&proof, proof_bytes);
+    if (ret != C_KZG_OK) return ret;
+
+    for (size_t j = 0; j < FIELD_ELEMENTS_PER_CELL; j++) {
+        size_t offset = j * BYTES_PER_FIELD_ELEMENT;
+        ret = bytes_to_bls_field(&column[j], (const Bytes32 *)&cell->bytes[offset]);
+        if (ret != C_KZG_OK) return ret;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Subtract the commitment to the interpolation polynomial from the commitment
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ret = interpolate_cell_column(interpolation_poly, column, cell_index, s);
+    if (ret != C_KZG_OK) return ret;
+
+    ret = commit_to_cell_poly(&interpolation_poly_commit, interpolation_poly, s);
+    if (ret != C_KZG_OK) return ret;
+
+    g1_sub(&commitment, &commitment, &interpolation_poly_commit);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Do the pairing check
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+
+    if (s->cell_g2_lines != NULL) {
+        const blst_fp6 *cell_lines = &s->cell_g2_lines[cell_index * NUM_G2_LINES];
+        *ok = pairings_verify_lines(&commitment, s->g2_generator_lines, &proof, cell_lines);
+    } else {
+        /* Compute [s^n - h_k^n] by subtracting [h_k^n]G2 from [s^n] */
+        g2_t zero_poly_commit;
+        fr_t h_k_pow;
+        get_coset_shift_pow_for_cell(&h_k_pow, cell_index, s);
+        g2_mul(&zero_poly_commit, blst_p2_generator(), &h_k_pow);
+        blst_p2_cneg(&zero_poly_commit, true);
+        blst_p2_add_or_double(
+            &zero_poly_commit, &s->g2_values_monomial[FIELD_ELEMENTS_PER_CELL], &zero_poly_commit
+        );
+
+        *ok = pairings_verify(&commitment, blst_p2_generator(), &proof, &zero_poly_commit);
+    }
+
+    return C_KZG_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Cell Verification Accumulator
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Helper function for cell_verify_accumulator_add() and the verification coalescer: validate and
+ * decode the inputs of a single cell proof.
+ *
+ * @param[out]  commitment_out      The decoded commitment
+ * @param[out]  cell_fr_out         The field elements of the cell, length `FIELD_ELEMENTS_PER_CELL`
+ * @param[out]  proof_out           The decoded proof
+ * @param[in]   commitment_bytes    The commitment for the cell
+ * @param[in]   cell_index          The index of the cell
+ * @param[in]   cell                The cell
+ * @param[in]   proof_bytes         The proof for the cell
+ */
+C_KZG_RET prepare_cell_kzg_proof(
+    g1_t *commitment_out,
+    fr_t *cell_fr_out,
+    g1_t *proof_out,
+    const Bytes48 *commitment_bytes,
+    uint64_t cell_index,
+    const Cell *cell,
+    const Bytes48 *proof_bytes
+) {
+    C_KZG_RET ret;
+
+    /* Make sure cell index is valid */
+    if (cell_index >= CELLS_PER_EXT_BLOB) return C_KZG_BADARGS;
+
+    /* Convert untrusted inputs to trusted inputs */
+    ret = bytes_to_kzg_commitment(commitment_out, commitment_bytes);
+    if (ret != C_KZG_OK) return ret;
+    ret = bytes_to_kzg_proof(proof_out, proof_bytes);
+    if (ret != C_KZG_OK) return ret;
+    for (size_t j = 0; j < FIELD_ELEMENTS_PER_CELL; j++) {
+        size_t offset = j * BYTES_PER_FIELD_ELEMENT;
+        ret = bytes_to_bls_field(&cell_fr_out[j], (const Bytes32 *)&cell->bytes[offset]);
+        if (ret != C_KZG_OK) return ret;
+    }
+
+    return C_KZG_OK;
+}
+
+/**
+ * Empty a cell verification accumulator, keeping its seed and weight counter.
+ *
+ * @param[in,out]   acc The accumulator to reset
+ */
+static void cell_verify_accumulator_reset(CellVerifyAccumulator *acc) {
+    for (size_t i = 0; i < FIELD_ELEMENTS_PER_EXT_BLOB; i++) {
+        acc->aggregated_column_cells[i] = FR_ZERO;
+    }
+    for (size_t i = 0; i < CELLS_PER_EXT_BLOB; i++) {
+        acc->is_column_used[i] = false;
+    }
+    acc->num_cells = 0;
+    acc->num_pending = 0;
+    acc->commitment_and_proof_sum = G1_IDENTITY;
+    acc->proof_sum = G1_IDENTITY;
+}
+
+/**
+ * Initialize an empty cell verification accumulator.
+ *
+ * The random weights are derived from `seed` with SHA-256 in counter mode. There is no portable
+ * CSPRNG in C, so the caller provides the seed. It must be unpredictable to whoever supplies the
+ * cells, for example read from the operating system's CSPRNG, and kept secret.
+ *
+ * @param[out]  acc     The accumulator to initialize
+ * @param[in]   seed    A secret, uniformly random seed for the weights
+ *
+ * @remark Release the accumulator's memory later with cell_verify_accumulator_free().
+ */
+C_KZG_RET cell_verify_accumulator_init(CellVerifyAccumulator *acc, const Bytes32 *seed) {
+    C_KZG_RET ret;
+
+    acc->seed = *seed;
+    acc->num_weights = 0;
+    acc->aggregated_column_cells = NULL;
+    acc->is_column_used = NULL;
+    acc->pending_points = NULL;
+    acc->pending_scalars = NULL;
+
+    ret = new_fr_array(&acc->aggregated_column_cells, FIELD_ELEMENTS_PER_EXT_BLOB);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_bool_array(&acc->is_column_used, CELLS_PER_EXT_BLOB);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_g1_array(&acc->pending_points, 2 * CELL_VERIFY_ACCUMULATOR_CHUNK_SIZE);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_fr_array(&acc->pending_scalars, 2 * CELL_VERIFY_ACCUMULATOR_CHUNK_SIZE);
+    if (ret != C_KZG_OK) goto out;
+
+    cell_verify_accumulator_reset(acc);
+
+out:
+    if (ret != C_KZG_OK) cell_verify_accumulator_free(acc);
+    return ret;
+}
+
+/**
+ * Free the memory held by a cell verification accumulator. Any cells it holds are discarded.
+ *
+ * @param[in]   acc The accumulator to free
+ */
+void cell_verify_accumulator_free(CellVerifyAccumulator *acc) {
+    if (acc == NULL) return;
+    c_kzg_free(acc->aggregated_column_cells);
+    c_kzg_free(acc->is_column_used);
+    c_kzg_free(acc->pending_points);
+    c_kzg_free(acc->pending_scalars);
+    memset(acc->seed.bytes, 0, sizeof(acc->seed.bytes));
+}
+
+/**
+ * Derive the next random weight of a cell verification accumulator.
+ *
+ * @param[out]      weight_out  The weight
+ * @param[in,out]   acc         The accumulator
+ */
+static void cell_verify_accumulator_next_weight(fr_t *weight_out, CellVerifyAccumulator *acc) {
+    uint8_t bytes[sizeof(Bytes32) + sizeof(uint64_t)];
+    Bytes32 hash;
+
+    memcpy(bytes, acc->seed.bytes, sizeof(Bytes32));
+    bytes_from_uint64(&bytes[sizeof(Bytes32)], acc->num_weights++);
+    blst_sha256(hash.bytes, bytes, sizeof(bytes));
+    hash_to_bls_field(weight_out, &hash);
+}
+
+/**
+ * Add a chunk of weighted proofs and commitments to a pair of running sums.
+ *
+ * The points hold the proofs at `[0, CHUNK_SIZE)` and the commitments at
+ * `[CHUNK_SIZE, 2 * CHUNK_SIZE)`. The scalars at the same positions are the proof weights and the
+ * commitment weights, and the commitment weights also weight the proofs in `proof_sum`. The
+ * commitments are moved next to the proofs so that `combined_sum` takes one MSM.
+ *
+ * @param[in,out]   combined_sum    The running sum of the weighted commitments and proofs
+ * @param[in,out]   proof_sum       The running sum of the proofs, weighted like the commitments
+ * @param[in,out]   points          The pending points
+ * @param[in,out]   scalars         The pending scalars
+ * @param[in]       n               The number of pending proofs
+ *
+ * @remark The sums and the pending points are left unchanged if this returns an error.
+ */
+static C_KZG_RET flush_pending_proofs(
+    g1_t *combined_sum, g1_t *proof_sum, g1_t *points, fr_t *scalars, size_t n
+) {
+    C_KZG_RET ret;
+    g1_t proof_partial, combined_partial;
+
+    if (n == 0) return C_KZG_OK;
+
+    ret = g1_lincomb_fast(&proof_partial, points, &scalars[CELL_VERIFY_ACCUMULATOR_CHUNK_SIZE], n);
+    if (ret != C_KZG_OK) return ret;
+
+    if (n < CELL_VERIFY_ACCUMULATOR_CHUNK_SIZE) {
+        memmove(&points[n], &points[CELL_VERIFY_ACCUMULATOR_CHUNK_SIZE], n * sizeof(g1_t));
+        memmove(&scalars[n], &scalars[CELL_VERIFY_ACCUMULATOR_CHUNK_SIZE], n * sizeof(fr_t));
+    }
+
+    ret = g1_lincomb_fast(&combined_partial, points, scalars, 2 * n);
+    if (ret != C_KZG_OK) {
+        /* Put the commitments back, so the pending points are unchanged */
+        if (n < CELL_VERIFY_ACCUMULATOR_CHUNK_SIZE) {
+            memmove(&points[CELL_VERIFY_ACCUMULATOR_CHUNK_SIZE], &points[n], n * sizeof(g1_t));
+            memmove(&scalars[CELL_VERIFY_ACCUMULATOR_CHUNK_SIZE], &scalars[n], n * sizeof(fr_t));
+        }
+        return ret;
+    }
+
+    blst_p1_add_or_double(proof_sum, proof_sum, &proof_partial);
+    blst_p1_add_or_double(combined_sum, combined_sum, &combined_partial);
+
+    return C_KZG_OK;
+}
+
+/**
+ * Add the pending proofs and commitments of a cell verification accumulator to its running sums.
+ *
+ * The proofs are weighted by the cell weight times the coset shift factor `h_k^n`, and the
+ * commitments by the cell weight alone.
+ *
+ * @param[in,out]   acc The accumulator
+ *
+ * @remark The accumulator is left unchanged if this returns an error.
+ */
+static C_KZG_RET cell_verify_accumulator_flush(CellVerifyAccumulator *acc) {
+    C_KZG_RET ret = flush_pending_proofs(
+        &acc->commitment_and_proof_sum,
+        &acc->proof_sum,
+        acc->pending_points,
+        acc->pending_scalars,
+        acc->num_pending
+    );
+    if (ret == C_KZG_OK) acc->num_pending = 0;
+    return ret;
+}
+
+/**
+ * Add a cell proof already decoded by prepare_cell_kzg_proof() to an accumulator, deferring the
+ * pairing check to cell_verify_accumulator_finalize().
+ *
+ * The cell is weighted and added to its column straight away, and the proof and commitment are
+ * added to the running sums in chunks. The prepared inputs are left unchanged, so they can be
+ * absorbed again, with a fresh weight, by another accumulator.
+ *
+ * @param[in,out]   acc         The accumulator
+ * @param[in]       commitment  The decoded commitment for the cell
+ * @param[in]       cell_index  The index of the cell, which must be valid
+ * @param[in]       cell_fr     The field elements of the cell, length `FIELD_ELEMENTS_PER_CELL`
+ * @param[in]       proof       The decoded proof for the cell
+ * @param[in]       s           The trusted setup
+ *
+ * @remark The cells absorbed so far are left unchanged if this returns an error.
+ */
+C_KZG_RET cell_verify_accumulator_add_prepared(
+    CellVerifyAccumulator *acc,
+    const g1_t *commitment,
+    uint64_t cell_index,
+    const fr_t *cell_fr,
+    const g1_t *proof,
+    const KZGSettings *s
+) {
+    C_KZG_RET ret;
+    fr_t weight, h_k_pow, tmp;
+
+    /* Make room for this cell's proof and commitment */
+    if (acc->num_pending == CELL_VERIFY_ACCUMULATOR_CHUNK_SIZE) {
+        ret = cell_verify_accumulator_flush(acc);
+        if (ret != C_KZG_OK) return ret;
+    }
+
+    cell_verify_accumulator_next_weight(&weight, acc);
+
+    /* Scale the cell by its weight and aggregate it into its column */
+    for (size_t j = 0; j < FIELD_ELEMENTS_PER_CELL; j++) {
+        fr_t *column_cell = &acc->aggregated_column_cells[cell_index * FIELD_ELEMENTS_PER_CELL + j];
+        blst_fr_mul(&tmp, &cell_fr[j], &weight);
+        blst_fr_add(column_cell, column_cell, &tmp);
+    }
+    acc->is_column_used[cell_index] = true;
+
+    /* Queue the proof with the coset-weighted weight, and the commitment with the plain weight */
+    get_coset_shift_pow_for_cell(&h_k_pow, cell_index, s);
+    size_t i = acc->num_pending;
+    acc->pending_points[i] = *proof;
+    blst_fr_mul(&acc->pending_scalars[i], &weight, &h_k_pow);
+    acc->pending_points[CELL_VERIFY_ACCUMULATOR_CHUNK_SIZE + i] = *commitment;
+    acc->pending_scalars[CELL_VERIFY_ACCUMULATOR_CHUNK_SIZE + i] = weight;
+    acc->num_pending++;
+    acc->num_cells++;
+
+    return C_KZG_OK;
+}
+
+/**
+ * Add a cell and its proof to an accumulator, deferring the pairing check to
+ * cell_verify_accumulator_finalize().
+ *
+ * The inputs are validated immediately.
+ *
+ * @param[in,out]   acc                 The accumulator
+ * @param[in]       commitment_bytes    The commitment for the cell
+ * @param[in]       cell_index          The index of the cell
+ * @param[in]       cell                The cell
+ * @param[in]       proof_bytes         The proof for the cell
+ * @param[in]       s                   The trusted setup
+ *
+ * @remark The cells absorbed so far are left unchanged if this returns an error.
+ */
+C_KZG_RET cell_verify_accumulator_add(
+    CellVerifyAccumulator *acc,
+    const Bytes48 *commitment_bytes,
+    uint64_t cell_index,
+    const Cell *cell,
+    const Bytes48 *proof_bytes,
+    const KZGSettings *s
+) {
+    C_KZG_RET ret;
+    g1_t commitment, proof;
+    fr_t cell_fr[FIELD_ELEMENTS_PER_CELL];
+
+    ret = prepare_cell_kzg_proof(
+        &commitment, cell_fr, &proof, commitment_bytes, cell_index, cell, proof_bytes
+    );
+    if (ret != C_KZG_OK) return ret;
+
+    return cell_verify_accumulator_add_prepared(acc, &commitment, cell_index, cell_fr, &proof, s);
+}
+
+/**
+ * Reduce the cells absorbed by a non-empty accumulator to the left-hand G1 point of its pairing
+ * check. The check is then `e(final_g1_sum, [1]) == e(acc->proof_sum, [s^n])`.
+ *
+ * @param[out]      final_g1_sum_out    The G1 point to pair with the generator
+ * @param[in,out]   acc                 The accumulator
+ * @param[in]       s                   The trusted setup
+ */
+static C_KZG_RET cell_verify_accumulator_reduce(
+    g1_t *final_g1_sum_out, CellVerifyAccumulator *acc, const KZGSettings *s
+) {
+    C_KZG_RET ret;
+    g1_t interpolation_poly_commit;
+
+    ret = cell_verify_accumulator_flush(acc);
+    if (ret != C_KZG_OK) return ret;
+
+    /* Interpolate the aggregated columns, sum them, and commit */
+    ret = commit_to_aggregated_columns(
+        &interpolation_poly_commit, acc->aggregated_column_cells, acc->is_column_used, s
+    );
+    if (ret != C_KZG_OK) return ret;
+
+    /* Subtract commitment from sum */
+    g1_sub(final_g1_sum_out, &acc->commitment_and_proof_sum, &interpolation_poly_commit);
+
+    return C_KZG_OK;
+}
+
+/**
+ * Verify every cell proof absorbed by an accumulator with a single pairing check.
+ *
+ * @param[out]      ok  True if all the proofs are valid
+ * @param[in,out]   acc The accumulator
+ * @param[in]       s   The trusted setup
+ *
+ * @remark An accumulator with no cells is trivially valid.
+ * @remark The accumulator is emptied whether or not this succeeds, ready for the next cells.
+ * @remark This does not say which proofs are invalid. Use verify_cell_kzg_proof_batch_locate()
+ * on the original inputs for that.
+ */
+C_KZG_RET cell_verify_accumulator_finalize(
+    bool *ok, CellVerifyAccumulator *acc, const KZGSettings *s
+) {
+    C_KZG_RET ret;
+    g1_t final_g1_sum;
+    g2_t power_of_s = s->g2_values_monomial[FIELD_ELEMENTS_PER_CELL];
+
+    *ok = false;
+
+    if (acc->num_cells == 0) {
+        *ok = true;
+        return C_KZG_OK;
+    }
+
+    ret = cell_verify_accumulator_reduce(&final_g1_sum, acc, s);
+    if (ret != C_KZG_OK) goto out;
+
+    /* Do the final pairing check */
+    *ok = pairings_verify(&final_g1_sum, blst_p2_generator(), &acc->proof_sum, &power_of_s);
+
+out:
+    cell_verify_accumulator_reset(acc);
+    return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Unified Verification Accumulator
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Empty the blob side of a unified verification accumulator.
+ *
+ * @param[in,out]   acc The accumulator to reset
+ */
+static void unified_verify_accumulator_reset_blobs(UnifiedVerifyAccumulator *acc) {
+    acc->num_blobs = 0;
+    acc->blob_evaluation_sum = FR_ZERO;
+    acc->num_blob_pending = 0;
+    acc->blob_commitment_and_proof_sum = G1_IDENTITY;
+    acc->blob_proof_sum = G1_IDENTITY;
+}
+
+/**
+ * Initialize an empty unified verification accumulator.
+ *
+ * @param[out]  acc     The accumulator to initialize
+ * @param[in]   seed    A secret, uniformly random seed for the weights
+ *
+ * @remark The seed is used as in cell_verify_accumulator_init().
+ * @remark Release the accumulator's memory later with unified_verify_accumulator_free().
+ */
+C_KZG_RET unified_verify_accumulator_init(UnifiedVerifyAccumulator *acc, const Bytes32 *seed) {
+    C_KZG_RET ret;
+
+    acc->blob_pending_points = NULL;
+    acc->blob_pending_scalars = NULL;
+
+    ret = cell_verify_accumulator_init(&acc->cells, seed);
+    if (ret != C_KZG_OK) return ret;
+
+    ret = new_g1_array(&acc->blob_pending_points, 2 * CELL_VERIFY_ACCUMULATOR_CHUNK_SIZE);
+    if (ret != C_KZG_OK) goto out;
+    ret = new_fr_array(&acc->blob_pending_scalars, 2 * CELL_VERIFY_ACCUMULATOR_CHUNK_SIZE);
+    if (ret != C_KZG_OK) goto out;
+
+    unified_verify_accumulator_reset_blobs(acc);
+
+out:
+    if (ret != C_KZG_OK) unified_verify_accumulator_free(acc);
+    return ret;
+}
+
+/**
+ * Free the memory held by a unified verification accumulator. Any proofs it holds are discarded.
+ *
+ * @param[in]   acc The accumulator to free
+ */
+void unified_verify_accumulator_free(UnifiedVerifyAccumulator *acc) {
+    if (acc == NULL) return;
+    cell_verify_accumulator_free(&acc->cells);
+    c_kzg_free(acc->blob_pending_points);
+    c_kzg_free(acc->blob_pending_scalars);
+}
+
+/**
+ * Add the pending blob proofs and commitments of a unified verification accumulator to its
+ * running sums.
+ *
+ * @param[in,out]   acc The accumulator
+ *
+ * @remark The accumulator is left unchanged if this returns an error.
+ */
+static C_KZG_RET unified_verify_accumulator_flush_blobs(UnifiedVerifyAccumulator *acc) {
+    C_KZG_RET ret = flush_pending_proofs(
+        &acc->blob_commitment_and_proof_sum,
+        &acc->blob_proof_sum,
+        acc->blob_pending_points,
+        acc->blob_pending_scalars,
+        acc->num_blob_pending
+    );
+    if (ret == C_KZG_OK) acc->num_blob_pending = 0;
+    return ret;
+}
+
+/**
+ * Add a blob proof already reduced by prepare_blob_kzg_proof_batch() to a unified accumulator,
+ * deferring the pairing check to unified_verify_accumulator_finalize().
+ *
+ * @param[in,out]   acc         The accumulator
+ * @param[in]       commitment  The decoded commitment to the blob
+ * @param[in]       z           The evaluation challenge
+ * @param[in]       y           The blob's evaluation at `z`
+ * @param[in]       proof       The decoded blob proof
+ *
+ * @remark The proofs absorbed so far are left unchanged if this returns an error.
+ */
+C_KZG_RET unified_verify_accumulator_add_prepared_blob(
+    UnifiedVerifyAccumulator *acc,
+    const g1_t *commitment,
+    const fr_t *z,
+    const fr_t *y,
+    const g1_t *proof
+) {
+    C_KZG_RET ret;
+    fr_t weight, tmp;
+
+    /* Make room for this blob's proof and commitment */
+    if (acc->num_blob_pending == CELL_VERIFY_ACCUMULATOR_CHUNK_SIZE) {
+        ret = unified_verify_accumulator_flush_blobs(acc);
+        if (ret != C_KZG_OK) return ret;
+    }
+
+    cell_verify_accumulator_next_weight(&weight, &acc->cells);
+
+    /* The evaluations all multiply the generator, so only their weighted sum is needed */
+    blst_fr_mul(&tmp, y, &weight);
+    blst_fr_add(&acc->blob_evaluation_sum, &acc->blob_evaluation_sum, &tmp);
+
+    /* Queue the proof weighted by the challenge, and the commitment with the plain weight */
+    size_t i = acc->num_blob_pending;
+    acc->blob_pending_points[i] = *proof;
+    blst_fr_mul(&acc->blob_pending_scalars[i], &weight, z);
+    acc->blob_pending_points[CELL_VERIFY_ACCUMULATOR_CHUNK_SIZE + i] = *commitment;
+    acc->blob_pending_scalars[CELL_VERIFY_ACCUMULATOR_CHUNK_SIZE + i] = weight;
+    acc->num_blob_pending++;
+    acc->num_blobs++;
+
+    return C_KZG_OK;
+}
+
+/**
+ * Add a blob proof to a unified accumulator, deferring the pairing check to
+ * unified_verify_accumulator_finalize().
+ *
+ * The inputs are validated, and the evaluation challenge and the blob's evaluation at it are
+ * computed immediately, exactly as verify_blob_kzg_proof() does.
+ *
+ * @param[in,out]   acc                 The accumulator
+ * @param[in]       blob                The blob
+ * @param[in]       commitment_bytes    The commitment to the blob
+ * @param[in]       proof_bytes         The blob proof
+ * @param[in]       s                   The trusted setup
+ *
+ * @remark The proofs absorbed so far are left unchanged if this returns an error.
+ */
+C_KZG_RET unified_verify_accumulator_add_blob(
+    UnifiedVerifyAccumulator *acc,
+    const Blob *blob,
+    const Bytes48 *commitment_bytes,
+    const Bytes48 *proof_bytes,
+    const KZGSettings *s
+) {
+    C_KZG_RET ret;
+    g1_t commitment, proof;
+    fr_t z, y;
+
+    ret = prepare_blob_kzg_proof_batch(
+        &commitment, &z, &y, &proof, blob, commitment_bytes, proof_bytes, 1, s
+    );
+    if (ret != C_KZG_OK) return ret;
+
+    return unified_verify_accumulator_add_prepared_blob(acc, &commitment, &z, &y, &proof);
+}
+
+/**
+ * Add a cell proof to a unified accumulator, deferring the pairing check to
+ * unified_verify_accumulator_finalize().
+ *
+ * @param[in,out]   acc                 The accumulator
+ * @param[in]       commitment_bytes    The commitment for the cell
+ * @param[in]       cell_index          The index of the cell
+ * @param[in]       cell                The cell
+ * @param[in]       proof_bytes         The proof for the cell
+ * @param[in]       s                   The trusted setup
+ *
+ * @remark The proofs absorbed so far are left unchanged if this returns an error.
+ */
+C_KZG_RET unified_verify_accumulator_add_cell(
+    UnifiedVerifyAccumulator *acc,
+    const Bytes48 *commitment_bytes,
+    uint64_t cell_index,
+    const Cell *cell,
+    const Bytes48 *proof_bytes,
+    const KZGSettings *s
+) {
+    return cell_verify_accumulator_add(
+        &acc->cells, commitment_bytes, cell_index, cell, proof_bytes, s
+    );
+}
+
+/**
+ * Add a cell proof already decoded by prepare_cell_kzg_proof() to a unified accumulator, deferring
+ * the pairing check to unified_verify_accumulator_finalize().
+ *
+ * @param[in,out]   acc         The accumulator
+ * @param[in]       commitment  The decoded commitment for the cell
+ * @param[in]       cell_index  The index of the cell, which must be valid
+ * @param[in]       cell_fr     The field elements of the cell, length `FIELD_ELEMENTS_PER_CELL`
+ * @param[in]       proof       The decoded proof for the cell
+ * @param[in]       s           The trusted setup
+ *
+ * @remark The proofs absorbed so far are left unchanged if this returns an error.
+ */
+C_KZG_RET unified_verify_accumulator_add_prepared_cell(
+    UnifiedVerifyAccumulator *acc,
+    const g1_t *commitment,
+    uint64_t cell_index,
+    const fr_t *cell_fr,
+    const g1_t *proof,
+    const KZGSettings *s
+) {
+    return cell_verify_accumulator_add_prepared(
+        &acc->cells, commitment, cell_index, cell_fr, proof, s
+    );
+}
+
+/**
+ * Verify every blob proof and cell proof absorbed by a unified accumulator.
+ *
+ * The blob proofs check `e(C - [y] + [z]proof, [1]) == e(proof, [s])` and the cell proofs check
+ * `e(final_g1_sum, [1]) == e(proof_sum, [s^n])`. With the weighted sums on both sides, this is a
+ * single product of three pairings, one for each distinct G2 point, that must be one. The three
+ * Miller loops share a single final exponentiation.
+ *
+ * @param[out]      ok  True if all the proofs are valid
+ * @param[in,out]   acc The accumulator
+ * @param[in]       s   The trusted setup
+ *
+ * @remark An accumulator with no proofs is trivially valid.
+ * @remark The accumulator is emptied whether or not this succeeds, ready for the next proofs.
+ */
+C_KZG_RET unified_verify_accumulator_finalize(
+    bool *ok, UnifiedVerifyAccumulator *acc, const KZGSettings *s
+) {
+    C_KZG_RET ret;
+    g1_t g1s[3], evaluation_commit;
+    g2_t g2s[3];
+
+    *ok = false;
+
+    if (acc->num_blobs == 0 && acc->cells.num_cells == 0) {
+        *ok = true;
+        return C_KZG_OK;
+    }
+
+    /* Both left-hand sides pair with the generator, so they are added together */
+    g1s[0] = G1_IDENTITY;
+    g2s[0] = *blst_p2_generator();
+
+    if (acc->num_blobs > 0) {
+        ret = unified_verify_accumulator_flush_blobs(acc);
+        if (ret != C_KZG_OK) goto out;
+
+        g1_mul_fixed_base(&evaluation_commit, s->g1_generator_table, &acc->blob_evaluation_sum);
+        g1_sub(&g1s[0], &acc->blob_commitment_and_proof_sum, &evaluation_commit);
+    }
+
+    if (acc->cells.num_cells > 0) {
+        g1_t cell_g1_sum;
+        ret = cell_verify_accumulator_reduce(&cell_g1_sum, &acc->cells, s);
+        if (ret != C_KZG_OK) goto out;
+        blst_p1_add_or_double(&g1s[0], &g1s[0], &cell_g1_sum);
+    }
+
+    /* The right-hand sides are moved over by negating their proof sums */
+    g1s[1] = acc->blob_proof_sum;
+    blst_p1_cneg(&g1s[1], true);
+    g2s[1] = s->g2_values_monomial[1];
+    g1s[2] = acc->cells.proof_sum;
+    blst_p1_cneg(&g1s[2], true);
+    g2s[2] = s->g2_values_monomial[FIELD_ELEMENTS_PER_CELL];
+
+    *ok = pairings_product_is_one(g1s, g2s, 3);
+
+out:
+    cell_verify_accumulator_reset(&acc->cells);
+    unified_verify_accumulator_reset_blobs(acc);
     return ret;
 }
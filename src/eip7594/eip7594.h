@@ -24,6 +24,65 @@
 #include "eip7594/cell.h"
 #include "setup/settings.h"
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Types
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Absorbs cell proofs as they arrive, for example from gossip, so that they can all be verified
+ * with a single pairing. Rather than storing the cells, it keeps each column's weighted sum of
+ * cells and running sums of the weighted commitments and proofs.
+ *
+ * The random weights come from a secret seed chosen by the verifier instead of a hash of the
+ * inputs, since the inputs are not all known up front.
+ */
+typedef struct {
+    /** The secret seed the random weights are derived from. */
+    Bytes32 seed;
+    /** The number of weights derived so far. Never reset, so that no weight is used twice. */
+    uint64_t num_weights;
+    /** The number of cells absorbed since the last finalize. */
+    uint64_t num_cells;
+    /** The weighted sum of the cells in each column, length `FIELD_ELEMENTS_PER_EXT_BLOB`. */
+    fr_t *aggregated_column_cells;
+    /** Whether each column holds any cells, length `CELLS_PER_EXT_BLOB`. */
+    bool *is_column_used;
+    /** The proofs and then the commitments not yet added to the running sums. */
+    g1_t *pending_points;
+    /** The weights for `pending_points`. */
+    fr_t *pending_scalars;
+    /** The number of pending cells. */
+    size_t num_pending;
+    /** The running sum of the weighted commitments and the coset-weighted proofs. */
+    g1_t commitment_and_proof_sum;
+    /** The running sum of the weighted proofs. */
+    g1_t proof_sum;
+} CellVerifyAccumulator;
+
+/**
+ * Absorbs both EIP-4844 blob proofs and EIP-7594 cell proofs, for example all of those in a block,
+ * so that they can all be verified with one pairing product and a single final exponentiation.
+ * The blob proofs are reduced the same way as the cell proofs, with weights from the same seed.
+ */
+typedef struct {
+    /** The cell proofs, which also hold the seed and weight counter for the blob proofs. */
+    CellVerifyAccumulator cells;
+    /** The number of blob proofs absorbed since the last finalize. */
+    uint64_t num_blobs;
+    /** The weighted sum of the blob evaluations at their challenges. */
+    fr_t blob_evaluation_sum;
+    /** The blob proofs and then the blob commitments not yet added to the running sums. */
+    g1_t *blob_pending_points;
+    /** The weights for `blob_pending_points`. */
+    fr_t *blob_pending_scalars;
+    /** The number of pending blob proofs. */
+    size_t num_blob_pending;
+    /** The running sum of the weighted blob commitments and challenge-weighted blob proofs. */
+    g1_t blob_commitment_and_proof_sum;
+    /** The running sum of the weighted blob proofs. */
+    g1_t blob_proof_sum;
+} UnifiedVerifyAccumulator;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Public Functions
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -36,6 +95,10 @@ C_KZG_RET compute_cells_and_kzg_proofs(
     Cell *cells, KZGProof *proofs, const Blob *blob, const KZGSettings *s
 );
 
+C_KZG_RET compute_cells_and_kzg_proofs_batch(
+    Cell *cells, KZGProof *proofs, const Blob *blobs, uint64_t n, const KZGSettings *s
+);
+
 C_KZG_RET recover_cells_and_kzg_proofs(
     Cell *recovered_cells,
     KZGProof *recovered_proofs,
@@ -55,6 +118,124 @@ C_KZG_RET verify_cell_kzg_proof_batch(
     const KZGSettings *s
 );
 
+C_KZG_RET verify_cell_kzg_proof_batch_locate(
+    bool *ok,
+    uint64_t *invalid_indices_out,
+    uint64_t *num_invalid_out,
+    const Bytes48 *commitments_bytes,
+    const uint64_t *cell_indices,
+    const Cell *cells,
+    const Bytes48 *proofs_bytes,
+    uint64_t num_cells,
+    const KZGSettings *s
+);
+
+C_KZG_RET verify_data_column_kzg_proofs(
+    bool *ok,
+    uint64_t column_index,
+    const Bytes48 *commitments_bytes,
+    const Cell *cells,
+    const Bytes48 *proofs_bytes,
+    uint64_t num_cells,
+    const KZGSettings *s
+);
+
+C_KZG_RET verify_blob_cell_kzg_proofs(
+    bool *ok,
+    const Blob *blob,
+    const Cell *cells,
+    const Bytes48 *commitment_bytes,
+    const Bytes48 *proofs_bytes,
+    const KZGSettings *s
+);
+
+C_KZG_RET verify_cell_kzg_proof_single(
+    bool *ok,
+    const Bytes48 *commitment_bytes,
+    uint64_t cell_index,
+    const Cell *cell,
+    const Bytes48 *proof_bytes,
+    const KZGSettings *s
+);
+
+C_KZG_RET verify_cell_kzg_proof_batch_with_handles(
+    bool *ok,
+    const KZGCommitmentHandle *commitments,
+    const uint64_t *cell_indices,
+    const Cell *cells,
+    const KZGProofHandle *proofs,
+    uint64_t num_cells,
+    const KZGSettings *s
+);
+
+C_KZG_RET cell_verify_accumulator_init(CellVerifyAccumulator *acc, const Bytes32 *seed);
+
+void cell_verify_accumulator_free(CellVerifyAccumulator *acc);
+
+C_KZG_RET cell_verify_accumulator_add(
+    CellVerifyAccumulator *acc,
+    const Bytes48 *commitment_bytes,
+    uint64_t cell_index,
+    const Cell *cell,
+    const Bytes48 *proof_bytes,
+    const KZGSettings *s
+);
+
+C_KZG_RET cell_verify_accumulator_add_prepared(
+    CellVerifyAccumulator *acc,
+    const g1_t *commitment,
+    uint64_t cell_index,
+    const fr_t *cell_fr,
+    const g1_t *proof,
+    const KZGSettings *s
+);
+
+C_KZG_RET cell_verify_accumulator_finalize(
+    bool *ok, CellVerifyAccumulator *acc, const KZGSettings *s
+);
+
+C_KZG_RET unified_verify_accumulator_init(UnifiedVerifyAccumulator *acc, const Bytes32 *seed);
+
+void unified_verify_accumulator_free(UnifiedVerifyAccumulator *acc);
+
+C_KZG_RET unified_verify_accumulator_add_blob(
+    UnifiedVerifyAccumulator *acc,
+    const Blob *blob,
+    const Bytes48 *commitment_bytes,
+    const Bytes48 *proof_bytes,
+    const KZGSettings *s
+);
+
+C_KZG_RET unified_verify_accumulator_add_cell(
+    UnifiedVerifyAccumulator *acc,
+    const Bytes48 *commitment_bytes,
+    uint64_t cell_index,
+    const Cell *cell,
+    const Bytes48 *proof_bytes,
+    const KZGSettings *s
+);
+
+C_KZG_RET unified_verify_accumulator_add_prepared_blob(
+    UnifiedVerifyAccumulator *acc,
+    const g1_t *commitment,
+    const fr_t *z,
+    const fr_t *y,
+    const g1_t *proof
+);
+
+C_KZG_RET unified_verify_accumulator_add_prepared_cell(
+    UnifiedVerifyAccumulator *acc,
+    const g1_t *commitment,
+    uint64_t cell_index,
+    const fr_t *cell_fr,
+    const g1_t *proof,
+    const KZGSettings *s
+);
+
+C_KZG_RET unified_verify_accumulator_finalize(
+    bool *ok, UnifiedVerifyAccumulator *acc, const KZGSettings *s
+);
+
 /* Internal function exposed for testing purposes */
 C_KZG_RET compute_verify_cell_kzg_proof_batch_challenge(
     fr_t *challenge_out,
@@ -67,6 +248,17 @@ C_KZG_RET compute_verify_cell_kzg_proof_batch_challenge(
     uint64_t num_cells
 );
 
+/* Internal function shared with the verification coalescer */
+C_KZG_RET prepare_cell_kzg_proof(
+    g1_t *commitment_out,
+    fr_t *cell_fr_out,
+    g1_t *proof_out,
+    const Bytes48 *commitment_bytes,
+    uint64_t cell_index,
+    const Cell *cell,
+    const Bytes48 *proof_bytes
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "common/cache.h"
 #include "common/ec.h"
 #include "common/fr.h"
 
@@ -76,4 +77,45 @@ typedef struct {
     size_t wbits;
     /** The scratch size for the fixed-base MSM. */
     size_t scratch_size;
+    /**
+     * Precomputed multiples of the G1 generator for fixed-base multiplication.
+     * The array contains `FIXED_BASE_TABLE_SIZE` elements.
+     */
+    blst_p1_affine *g1_generator_table;
+    /**
+     * Powers of the inverse coset factors, used to shift cell interpolation polynomials.
+     *
+     * Entry `k * FIELD_ELEMENTS_PER_CELL + j` is `h_k^{-j}`, where `h_k` is the coset factor for
+     * the cell with index `k`.
+     * The array contains `CELLS_PER_EXT_BLOB * FIELD_ELEMENTS_PER_CELL` elements.
+     */
+    fr_t *cell_inv_coset_shift_powers;
+    /**
+     * The coset factors raised to the cell size, `h_k^{FIELD_ELEMENTS_PER_CELL}`, by cell index.
+     * The array contains `CELLS_PER_EXT_BLOB` elements.
+     */
+    fr_t *cell_coset_shift_pows;
+    /**
+     * The precomputed table for fixed-base MSM over the first `FIELD_ELEMENTS_PER_CELL` G1 points
+     * in monomial form, with window size `CELL_MONOMIAL_TABLE_WBITS`.
+     */
+    blst_p1_affine *g1_monomial_cell_table;
+    /**
+     * Prepared Miller loop lines for the G2 generator, or NULL if precompute_cell_g2_lines() has
+     * not been called.
+     * The array contains `NUM_G2_LINES` elements.
+     */
+    blst_fp6 *g2_generator_lines;
+    /**
+     * Prepared Miller loop lines for `[s^n - h_k^n]`, the G2 side of a single cell proof check,
+     * where `h_k` is the coset factor for the cell with index `k` and `n` is the cell size. Or NULL
+     * if precompute_cell_g2_lines() has not been called.
+     * The array contains `CELLS_PER_EXT_BLOB * NUM_G2_LINES` elements.
+     */
+    blst_fp6 *cell_g2_lines;
+    /**
+     * The keys of blob and cell proofs that have been verified, or NULL if enable_verify_cache()
+     * has not been called.
+     */
+    VerifyCache *verify_cache;
 } KZGSettings;
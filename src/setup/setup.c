@@ -174,6 +174,14 @@ void free_trusted_setup(KZGSettings *s) {
     }
     c_kzg_free(s->x_ext_fft_columns);
     c_kzg_free(s->tables);
+    c_kzg_free(s->g1_generator_table);
+    c_kzg_free(s->cell_inv_coset_shift_powers);
+    c_kzg_free(s->cell_coset_shift_pows);
+    c_kzg_free(s->g1_monomial_cell_table);
+    c_kzg_free(s->g2_generator_lines);
+    c_kzg_free(s->cell_g2_lines);
+    verify_cache_free(s->verify_cache);
+    c_kzg_free(s->verify_cache);
     s->wbits = 0;
     s->scratch_size = 0;
 }
@@ -318,6 +326,80 @@ out:
     return ret;
 }
 
+/**
+ * Initialize the table used for fixed-base multiplication of the G1 generator.
+ *
+ * @param[out]  s   Pointer to KZGSettings to initialize
+ */
+static C_KZG_RET init_g1_generator_table(KZGSettings *s) {
+    C_KZG_RET ret;
+
+    ret = c_kzg_calloc(
+        (void **)&s->g1_generator_table, FIXED_BASE_TABLE_SIZE, sizeof(blst_p1_affine)
+    );
+    if (ret != C_KZG_OK) return ret;
+
+    return g1_fixed_base_precompute(s->g1_generator_table, blst_p1_generator());
+}
+
+/**
+ * Initialize the tables used during cell proof verification: the powers of each cell's inverse
+ * coset factor, each coset factor raised to the cell size, and a fixed-base MSM table for the
+ * first `FIELD_ELEMENTS_PER_CELL` monomial G1 points.
+ *
+ * @param[out]  s   Pointer to KZGSettings to initialize
+ *
+ * @remark This requires the roots of unity and the monomial G1 points to be initialized.
+ */
+static C_KZG_RET init_cell_verification_tables(KZGSettings *s) {
+    C_KZG_RET ret;
+    blst_p1_affine *p_affine = NULL;
+
+    ret = new_fr_array(
+        &s->cell_inv_coset_shift_powers, CELLS_PER_EXT_BLOB * FIELD_ELEMENTS_PER_CELL
+    );
+    if (ret != C_KZG_OK) goto out;
+    ret = new_fr_array(&s->cell_coset_shift_pows, CELLS_PER_EXT_BLOB);
+    if (ret != C_KZG_OK) goto out;
+
+    for (size_t k = 0; k < CELLS_PER_EXT_BLOB; k++) {
+        /* The bit-reversed cell index points to the coset factor h_k in roots_of_unity */
+        size_t cell_idx_rbl = (size_t)reverse_bits_limited(CELLS_PER_EXT_BLOB, k);
+
+        /* The inverse of a root of unity is its reflected element, roots[-i] */
+        size_t inv_coset_factor_idx = FIELD_ELEMENTS_PER_EXT_BLOB - cell_idx_rbl;
+        compute_powers(
+            &s->cell_inv_coset_shift_powers[k * FIELD_ELEMENTS_PER_CELL],
+            &s->roots_of_unity[inv_coset_factor_idx],
+            FIELD_ELEMENTS_PER_CELL
+        );
+
+        /* Multiplying the index of h_k by n raises h_k to the n-th power */
+        s->cell_coset_shift_pows[k] = s->roots_of_unity[cell_idx_rbl * FIELD_ELEMENTS_PER_CELL];
+    }
+
+    /* Transform the points to affine representation */
+    ret = c_kzg_calloc((void **)&p_affine, FIELD_ELEMENTS_PER_CELL, sizeof(blst_p1_affine));
+    if (ret != C_KZG_OK) goto out;
+    const blst_p1 *p_arg[2] = {s->g1_values_monomial, NULL};
+    blst_p1s_to_affine(p_affine, p_arg, FIELD_ELEMENTS_PER_CELL);
+    const blst_p1_affine *points_arg[2] = {p_affine, NULL};
+
+    /* Allocate space for the table and compute it */
+    size_t table_size = blst_p1s_mult_wbits_precompute_sizeof(
+        CELL_MONOMIAL_TABLE_WBITS, FIELD_ELEMENTS_PER_CELL
+    );
+    ret = c_kzg_malloc((void **)&s->g1_monomial_cell_table, table_size);
+    if (ret != C_KZG_OK) goto out;
+    blst_p1s_mult_wbits_precompute(
+        s->g1_monomial_cell_table, CELL_MONOMIAL_TABLE_WBITS, points_arg, FIELD_ELEMENTS_PER_CELL
+    );
+
+out:
+    c_kzg_free(p_affine);
+    return ret;
+}
+
 /**
  * Basic sanity check that the trusted setup was loaded in Lagrange form.
  *
@@ -362,6 +444,13 @@ static void init_settings(KZGSettings *out) {
     out->tables = NULL;
     out->wbits = 0;
     out->scratch_size = 0;
+    out->g1_generator_table = NULL;
+    out->cell_inv_coset_shift_powers = NULL;
+    out->cell_coset_shift_pows = NULL;
+    out->g1_monomial_cell_table = NULL;
+    out->g2_generator_lines = NULL;
+    out->cell_g2_lines = NULL;
+    out->verify_cache = NULL;
 }
 // This variable is set to the last error that occurred in this file.
 volatile C_SETTING_ERR last_setting_error = C_SETTING_OK;
@@ -511,6 +600,20 @@ C_KZG_RET load_trusted_setup(
         goto out_error;
     }
 
+    /* Setup for fixed-base multiplication of the G1 generator */
+    ret = init_g1_generator_table(out);
+    if (ret != C_KZG_OK) {
+        last_setting_error = C_SETTING_BAD_G1_GENERATOR_TABLE;
+        goto out_error;
+    }
+
+    /* Setup for cell proof verification */
+    ret = init_cell_verification_tables(out);
+    if (ret != C_KZG_OK) {
+        last_setting_error = C_SETTING_BAD_CELL_VERIFICATION_TABLES;
+        goto out_error;
+    }
+
     goto out_success;
 
 out_error:
@@ -620,3 +723,93 @@ out:
     c_kzg_free(g2_monomial_bytes);
     return ret;
 }
+
+/**
+ * Precompute the prepared G2 lines used by verify_cell_kzg_proof_single().
+ *
+ * This is optional. Without the lines, single cell checks compute their G2 point and do the full
+ * Miller loops. With them, the G2 side of both Miller loops is skipped. The lines take about
+ * 2.5 MiB.
+ *
+ * @param[in,out]   s   The trusted setup, as loaded by load_trusted_setup()
+ *
+ * @remark This modifies the settings, so call it before sharing them with other threads.
+ * @remark Calling this again after it has succeeded does nothing.
+ */
+C_KZG_RET precompute_cell_g2_lines(KZGSettings *s) {
+    C_KZG_RET ret;
+    blst_fp6 *g2_generator_lines = NULL;
+    blst_fp6 *cell_g2_lines = NULL;
+    blst_p2_affine point_affine;
+    g2_t point;
+
+    /* The lines have already been computed */
+    if (s->cell_g2_lines != NULL) return C_KZG_OK;
+
+    ret = c_kzg_calloc((void **)&g2_generator_lines, NUM_G2_LINES, sizeof(blst_fp6));
+    if (ret != C_KZG_OK) goto out;
+    ret = c_kzg_calloc(
+        (void **)&cell_g2_lines, CELLS_PER_EXT_BLOB * NUM_G2_LINES, sizeof(blst_fp6)
+    );
+    if (ret != C_KZG_OK) goto out;
+
+    blst_p2_to_affine(&point_affine, blst_p2_generator());
+    blst_precompute_lines(g2_generator_lines, &point_affine);
+
+    for (size_t k = 0; k < CELLS_PER_EXT_BLOB; k++) {
+        /* Compute [s^n - h_k^n] by subtracting [h_k^n]G2 from [s^n] */
+        g2_mul(&point, blst_p2_generator(), &s->cell_coset_shift_pows[k]);
+        blst_p2_cneg(&point, true);
+        blst_p2_add_or_double(&point, &s->g2_values_monomial[FIELD_ELEMENTS_PER_CELL], &point);
+
+        blst_p2_to_affine(&point_affine, &point);
+        blst_precompute_lines(&cell_g2_lines[k * NUM_G2_LINES], &point_affine);
+    }
+
+    /* Only publish the lines once they are all computed */
+    s->g2_generator_lines = g2_generator_lines;
+    s->cell_g2_lines = cell_g2_lines;
+    g2_generator_lines = NULL;
+    cell_g2_lines = NULL;
+
+out:
+    c_kzg_free(g2_generator_lines);
+    c_kzg_free(cell_g2_lines);
+    return ret;
+}
+
+/**
+ * Attach a cache of verified proofs to the trusted setup.
+ *
+ * This is optional. With the cache, verify_blob_kzg_proof_batch() and verify_cell_kzg_proof_batch()
+ * remember the proofs that they have accepted, and skip any that they are given again before doing
+ * any curve work. This helps when the same sidecars arrive from several peers and are checked again
+ * at block import. The cache holds `capacity` entries of 32 bytes, and the oldest are replaced.
+ *
+ * @param[in,out]   s           The trusted setup, as loaded by load_trusted_setup()
+ * @param[in]       capacity    The number of verified proofs to remember
+ *
+ * @remark The capacity is rounded up to a power of two.
+ * @remark This modifies the settings, so call it before sharing them with other threads. After
+ * that, the cache may be used by many threads at once.
+ * @remark Calling this again after it has succeeded does nothing.
+ */
+C_KZG_RET enable_verify_cache(KZGSettings *s, size_t capacity) {
+    C_KZG_RET ret;
+    VerifyCache *cache = NULL;
+
+    /* The cache already exists */
+    if (s->verify_cache != NULL) return C_KZG_OK;
+
+    ret = c_kzg_malloc((void **)&cache, sizeof(VerifyCache));
+    if (ret != C_KZG_OK) goto out;
+    ret = verify_cache_init(cache, capacity);
+    if (ret != C_KZG_OK) goto out;
+
+    s->verify_cache = cache;
+    cache = NULL;
+
+out:
+    c_kzg_free(cache);
+    return ret;
+}
@@ -50,6 +50,8 @@ typedef enum {
     C_SETTING_BAD_COMPUTE_ROOTS, /**< Could not compute roots of unity. */
     C_SETTING_BAD_BIT_REVERSE, /**< Could not bit-reverse the g1 lagrange points. */
     C_SETTING_BAD_FK20_INIT, /**< Could not initialize the FK20 settings. */
+    C_SETTING_BAD_G1_GENERATOR_TABLE, /**< Could not precompute the G1 generator table. */
+    C_SETTING_BAD_CELL_VERIFICATION_TABLES, /**< Could not precompute the cell verify tables. */
 } C_SETTING_ERR;
 
 C_SETTING_ERR get_last_setting_error(void);
@@ -78,6 +80,10 @@ C_KZG_RET load_trusted_setup_file(KZGSettings *out, FILE *in, uint64_t precomput
 
 void free_trusted_setup(KZGSettings *s);
 
+C_KZG_RET precompute_cell_g2_lines(KZGSettings *s);
+
+C_KZG_RET enable_verify_cache(KZGSettings *s, size_t capacity);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,160 @@
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ckzg_coalescer.h"
+#include "test/tests.h"
+
+#define NUM_BLOBS 4
+#define NUM_THREADS 8
+#define NUM_ROUNDS 4
+#define CELLS_PER_CALL 3
+
+static KZGSettings s;
+static KZGCoalescer *coalescer;
+
+static Blob blobs[NUM_BLOBS];
+static KZGCommitment commitments[NUM_BLOBS];
+static KZGProof blob_proofs[NUM_BLOBS];
+static Cell cells[CELLS_PER_EXT_BLOB];
+static KZGProof cell_proofs[CELLS_PER_EXT_BLOB];
+static Bytes48 cell_commitments[CELLS_PER_EXT_BLOB];
+static uint64_t cell_indices[CELLS_PER_EXT_BLOB];
+
+// Each thread checks the same call through the coalescer and directly, and expects them to agree.
+static void *verify_concurrently(void *arg) {
+    size_t thread = (size_t)arg;
+    bool ok, expected_ok;
+    C_KZG_RET ret, expected_ret;
+
+    for (size_t round = 0; round < NUM_ROUNDS; round++) {
+        size_t i = (thread + round) % NUM_BLOBS;
+        if (thread % 2 == 0) {
+            // Every third call pairs the blob with another blob's proof
+            size_t j = (thread + round) % 3 == 0 ? (i + 1) % NUM_BLOBS : i;
+            const Bytes48 *proof = &blob_proofs[j];
+            ret = kzg_coalescer_verify_blob_kzg_proof(
+                &ok, &blobs[i], &commitments[i], proof, coalescer
+            );
+            expected_ret = verify_blob_kzg_proof(
+                &expected_ok, &blobs[i], &commitments[i], proof, &s
+            );
+        } else {
+            // Every third call has a cell index that does not match its cell
+            size_t first = (thread * NUM_ROUNDS + round) * CELLS_PER_CALL % CELLS_PER_EXT_BLOB;
+            uint64_t indices[CELLS_PER_CALL];
+            memcpy(indices, &cell_indices[first], sizeof(indices));
+            if ((thread + round) % 3 == 0) indices[1] = (indices[1] + 1) % CELLS_PER_EXT_BLOB;
+            // One call has an index that is out of range
+            if (thread == 1 && round == 0) indices[2] = CELLS_PER_EXT_BLOB;
+            ret = kzg_coalescer_verify_cell_kzg_proof_batch(
+                &ok,
+                &cell_commitments[first],
+                indices,
+                &cells[first],
+                &cell_proofs[first],
+                CELLS_PER_CALL,
+                coalescer
+            );
+            expected_ret = verify_cell_kzg_proof_batch(
+                &expected_ok,
+                &cell_commitments[first],
+                indices,
+                &cells[first],
+                &cell_proofs[first],
+                CELLS_PER_CALL,
+                &s
+            );
+        }
+        assert(ret == expected_ret);
+        if (ret == C_KZG_OK) assert(ok == expected_ok);
+    }
+    return NULL;
+}
+
+static void test_coalescer_matches_direct_calls(void) {
+    printf("Running test: coalesced calls match direct calls\n");
+
+    Bytes32 seed;
+    pthread_t threads[NUM_THREADS];
+    C_KZG_RET ret;
+
+    get_rand_bytes32(&seed);
+    ret = kzg_coalescer_new(&coalescer, &s, &seed, 16, 5000);
+    assert(ret == C_KZG_OK);
+
+    for (size_t i = 0; i < NUM_THREADS; i++) {
+        int err = pthread_create(&threads[i], NULL, verify_concurrently, (void *)i);
+        assert(err == 0);
+    }
+    for (size_t i = 0; i < NUM_THREADS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    kzg_coalescer_free(coalescer);
+}
+
+static void test_coalescer_single_call_waits_for_deadline(void) {
+    printf("Running test: a lone call is verified once the deadline passes\n");
+
+    Bytes32 seed;
+    bool ok = false;
+    C_KZG_RET ret;
+
+    get_rand_bytes32(&seed);
+    ret = kzg_coalescer_new(&coalescer, &s, &seed, 0, 1000);
+    assert(ret == C_KZG_BADARGS);
+    ret = kzg_coalescer_new(&coalescer, &s, &seed, 1000, 1000);
+    assert(ret == C_KZG_OK);
+
+    ret = kzg_coalescer_verify_blob_kzg_proof(
+        &ok, &blobs[0], &commitments[0], &blob_proofs[0], coalescer
+    );
+    assert(ret == C_KZG_OK && ok);
+    ret = kzg_coalescer_verify_blob_kzg_proof(
+        &ok, &blobs[0], &commitments[0], &blob_proofs[1], coalescer
+    );
+    assert(ret == C_KZG_OK && !ok);
+    ret = kzg_coalescer_verify_cell_kzg_proof_batch(&ok, NULL, NULL, NULL, NULL, 0, coalescer);
+    assert(ret == C_KZG_OK && ok);
+
+    kzg_coalescer_free(coalescer);
+}
+
+int main(void) {
+    printf("=== C-KZG-4844 Verification Coalescer Test Suite ===\n\n");
+
+    FILE *fp = fopen("./trusted_setup.txt", "r");
+    if (fp == NULL) {
+        fprintf(stderr, "Error: Could not open trusted_setup.txt\n");
+        return 1;
+    }
+    C_KZG_RET ret = load_trusted_setup_file(&s, fp, 0);
+    fclose(fp);
+    if (ret != C_KZG_OK) {
+        fprintf(stderr, "Error: Failed to load trusted setup (error code: %d)\n", ret);
+        return 1;
+    }
+
+    for (size_t i = 0; i < NUM_BLOBS; i++) {
+        get_rand_blob(&blobs[i]);
+        ret = blob_to_kzg_commitment(&commitments[i], &blobs[i], &s);
+        assert(ret == C_KZG_OK);
+        ret = compute_blob_kzg_proof(&blob_proofs[i], &blobs[i], &commitments[i], &s);
+        assert(ret == C_KZG_OK);
+    }
+    ret = compute_cells_and_kzg_proofs(cells, cell_proofs, &blobs[0], &s);
+    assert(ret == C_KZG_OK);
+    for (size_t i = 0; i < CELLS_PER_EXT_BLOB; i++) {
+        cell_commitments[i] = commitments[0];
+        cell_indices[i] = i;
+    }
+
+    test_coalescer_matches_direct_calls();
+    test_coalescer_single_call_waits_for_deadline();
+
+    free_trusted_setup(&s);
+    printf("\n=== All tests passed ===\n");
+    return 0;
+}
@@ -0,0 +1,180 @@
+/*
+ * Tests for the C++ wrapper in ckzg.hpp.
+ *
+ * Run from src/ with `make test-cpp`.
+ */
+
+#include "ckzg.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+static constexpr size_t NUM_BLOBS = 4;
+
+/* A blob of random field elements, each with a zero top byte so it is canonical */
+static void get_rand_blob(Blob &blob, std::mt19937_64 &rng) {
+    for (size_t i = 0; i < BYTES_PER_BLOB; i++) {
+        blob.bytes[i] = i % BYTES_PER_FIELD_ELEMENT == 0 ? 0 : static_cast<uint8_t>(rng());
+    }
+}
+
+static bool equal(const Bytes48 &a, const Bytes48 &b) {
+    return std::memcmp(a.bytes, b.bytes, sizeof(a.bytes)) == 0;
+}
+
+static bool equal(const Cell &a, const Cell &b) {
+    return std::memcmp(a.bytes, b.bytes, sizeof(a.bytes)) == 0;
+}
+
+static void test_settings_load_file__fails_missing_file(void) {
+    printf("Running test: loading a missing trusted setup fails\n");
+    ckzg::Result<ckzg::Settings> s = ckzg::Settings::load_file("./does_not_exist.txt");
+    assert(!s.has_value());
+    assert(s.error() == ckzg::Error::BadArgs);
+}
+
+static void test_as__checks_size(void) {
+    printf("Running test: viewing bytes as blobs checks the size\n");
+    std::vector<uint8_t> bytes(2 * BYTES_PER_BLOB);
+    auto blobs = ckzg::as<Blob>(bytes);
+    assert(blobs.has_value() && blobs->size() == 2);
+    assert(reinterpret_cast<const uint8_t *>(blobs->data()) == bytes.data());
+    auto partial = ckzg::as<Blob>(std::span<const uint8_t>(bytes).first(BYTES_PER_BLOB + 1));
+    assert(!partial.has_value() && partial.error() == ckzg::Error::BadArgs);
+}
+
+template <class E>
+static void check_batches(
+    const char *name, E &&exec, std::span<const Blob> blobs, const ckzg::Settings &s
+) {
+    printf("Running test: batches match single calls with %s\n", name);
+    size_t num_cells = blobs.size() * CELLS_PER_EXT_BLOB;
+
+    std::vector<KZGCommitment> commitments(blobs.size());
+    ckzg::Status status = ckzg::commit_all(exec, commitments, blobs, s);
+    assert(status.has_value());
+    for (size_t i = 0; i < blobs.size(); i++) {
+        auto commitment = ckzg::blob_to_kzg_commitment(blobs[i], s);
+        assert(commitment.has_value() && equal(*commitment, commitments[i]));
+    }
+
+    std::vector<Cell> cells(num_cells), cells_only(num_cells);
+    std::vector<KZGProof> proofs(num_cells);
+    status = ckzg::compute_cells_all(exec, std::span(cells), std::span(proofs), blobs, s);
+    assert(status.has_value());
+    status = ckzg::compute_cells_all(exec, std::span(cells_only), {}, blobs, s);
+    assert(status.has_value());
+    for (size_t i = 0; i < blobs.size(); i++) {
+        std::vector<Cell> blob_cells(CELLS_PER_EXT_BLOB);
+        std::vector<KZGProof> blob_proofs(CELLS_PER_EXT_BLOB);
+        status = ckzg::compute_cells_and_kzg_proofs(
+            std::span<Cell, CELLS_PER_EXT_BLOB>(blob_cells),
+            std::span<KZGProof, CELLS_PER_EXT_BLOB>(blob_proofs),
+            blobs[i],
+            s
+        );
+        assert(status.has_value());
+        for (size_t j = 0; j < CELLS_PER_EXT_BLOB; j++) {
+            assert(equal(blob_cells[j], cells[i * CELLS_PER_EXT_BLOB + j]));
+            assert(equal(blob_cells[j], cells_only[i * CELLS_PER_EXT_BLOB + j]));
+            assert(equal(blob_proofs[j], proofs[i * CELLS_PER_EXT_BLOB + j]));
+        }
+    }
+
+    /* Corrupt one proof of the last column, which only that column should catch */
+    std::swap(proofs[CELLS_PER_EXT_BLOB - 1], proofs[CELLS_PER_EXT_BLOB - 2]);
+
+    std::array<uint64_t, 3> indices = {0, 1, CELLS_PER_EXT_BLOB - 1};
+    std::unique_ptr<bool[]> ok(new bool[indices.size()]);
+    std::span<bool> ok_span(ok.get(), indices.size());
+    status = ckzg::verify_columns(exec, ok_span, indices, commitments, cells, proofs, s);
+    assert(status.has_value());
+    assert(ok[0] && ok[1] && !ok[2]);
+
+    /* The same columns, gathered by the caller as they would arrive in sidecars */
+    std::vector<std::vector<Cell>> column_cells(indices.size());
+    std::vector<std::vector<KZGProof>> column_proofs(indices.size());
+    std::vector<ckzg::Column> columns;
+    for (size_t c = 0; c < indices.size(); c++) {
+        for (size_t row = 0; row < blobs.size(); row++) {
+            column_cells[c].push_back(cells[row * CELLS_PER_EXT_BLOB + indices[c]]);
+            column_proofs[c].push_back(proofs[row * CELLS_PER_EXT_BLOB + indices[c]]);
+        }
+        columns.push_back({indices[c], commitments, column_cells[c], column_proofs[c]});
+    }
+    std::fill(ok.get(), ok.get() + indices.size(), false);
+    status = ckzg::verify_columns(exec, ok_span, std::span<const ckzg::Column>(columns), s);
+    assert(status.has_value());
+    assert(ok[0] && ok[1] && !ok[2]);
+
+    /* Mismatched lengths are rejected before any work is done */
+    status = ckzg::commit_all(exec, std::span(commitments).first(1), blobs, s);
+    assert(!status.has_value() && status.error() == ckzg::Error::BadArgs);
+    status = ckzg::verify_columns(exec, ok_span.first(1), indices, commitments, cells, proofs, s);
+    assert(!status.has_value() && status.error() == ckzg::Error::BadArgs);
+}
+
+static void test_recover_cells_and_kzg_proofs(std::span<const Blob> blobs, const ckzg::Settings &s) {
+    printf("Running test: recovering cells from half of them\n");
+    std::vector<Cell> cells(CELLS_PER_EXT_BLOB), recovered_cells(CELLS_PER_EXT_BLOB);
+    std::vector<KZGProof> proofs(CELLS_PER_EXT_BLOB), recovered_proofs(CELLS_PER_EXT_BLOB);
+    ckzg::Status status = ckzg::compute_cells_and_kzg_proofs(
+        std::span<Cell, CELLS_PER_EXT_BLOB>(cells),
+        std::span<KZGProof, CELLS_PER_EXT_BLOB>(proofs),
+        blobs[0],
+        s
+    );
+    assert(status.has_value());
+
+    std::vector<uint64_t> indices;
+    std::vector<Cell> half;
+    for (uint64_t i = 0; i < CELLS_PER_EXT_BLOB; i += 2) {
+        indices.push_back(i);
+        half.push_back(cells[i]);
+    }
+    status = ckzg::recover_cells_and_kzg_proofs(
+        std::span<Cell, CELLS_PER_EXT_BLOB>(recovered_cells),
+        std::span<KZGProof, CELLS_PER_EXT_BLOB>(recovered_proofs),
+        indices,
+        half,
+        s
+    );
+    assert(status.has_value());
+    for (size_t i = 0; i < CELLS_PER_EXT_BLOB; i++) {
+        assert(equal(cells[i], recovered_cells[i]));
+        assert(equal(proofs[i], recovered_proofs[i]));
+    }
+}
+
+int main(void) {
+    printf("=== C-KZG-4844 C++ Test Suite ===\n\n");
+
+    ckzg::Result<ckzg::Settings> s = ckzg::Settings::load_file("./trusted_setup.txt");
+    if (!s) {
+        fprintf(stderr, "Error: Failed to load trusted_setup.txt (%s)\n", to_string(s.error()));
+        return 1;
+    }
+
+    std::mt19937_64 rng(42);
+    std::vector<Blob> blobs(NUM_BLOBS);
+    for (Blob &blob : blobs) {
+        get_rand_blob(blob, rng);
+    }
+
+    test_settings_load_file__fails_missing_file();
+    test_as__checks_size();
+    check_batches("InlineExecutor", ckzg::InlineExecutor{}, blobs, *s);
+    check_batches("ThreadExecutor", ckzg::ThreadExecutor{3}, blobs, *s);
+#ifdef __cpp_lib_execution
+    check_batches("std::execution::par", std::execution::par, blobs, *s);
+#endif
+    test_recover_cells_and_kzg_proofs(blobs, *s);
+
+    printf("\n=== All tests passed ===\n");
+    return 0;
+}
@@ -0,0 +1,316 @@
+#include <assert.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "ckzg_queue.h"
+#include "test/tests.h"
+
+#define NUM_BLOBS 4
+
+static KZGSettings s;
+
+// Reap completions until `count` have arrived, recording each one by its user data.
+static void reap(KZGQueue *q, KZGCompletion *by_user_data, size_t count) {
+    KZGCompletion completions[8];
+    size_t seen = 0;
+    while (seen < count) {
+        size_t n = kzg_queue_wait(q, completions, 8);
+        assert(n > 0);
+        for (size_t i = 0; i < n; i++) {
+            by_user_data[completions[i].user_data] = completions[i];
+        }
+        seen += n;
+    }
+}
+
+static void test_queue_jobs_match_blocking_calls(void) {
+    printf("Running test: queued jobs match the blocking calls\n");
+
+    Blob *blobs = calloc(NUM_BLOBS, sizeof(Blob));
+    Cell *cells = calloc(CELLS_PER_EXT_BLOB * 2, sizeof(Cell));
+    KZGProof *proofs = calloc(CELLS_PER_EXT_BLOB * 2, sizeof(KZGProof));
+    assert(blobs != NULL && cells != NULL && proofs != NULL);
+    KZGCommitment commitments[NUM_BLOBS];
+    KZGProof blob_proofs[NUM_BLOBS];
+    KZGCompletion completions[8];
+    bool blobs_ok = false, cells_ok = false;
+    C_KZG_RET ret;
+
+    for (size_t i = 0; i < NUM_BLOBS; i++) {
+        get_rand_blob(&blobs[i]);
+    }
+
+    KZGQueue *q = NULL;
+    ret = kzg_queue_new(&q, &s, 3, 8, false, NULL, NULL);
+    assert(ret == C_KZG_OK);
+    int fd = kzg_queue_fd(q);
+    assert(fd >= 0);
+
+    // Commit to every blob and compute the cells of the first, all at once
+    for (size_t i = 0; i < NUM_BLOBS; i++) {
+        ret = kzg_queue_submit_blob_to_kzg_commitment(q, i, &commitments[i], &blobs[i]);
+        assert(ret == C_KZG_OK);
+    }
+    ret = kzg_queue_submit_compute_cells_and_kzg_proofs(q, NUM_BLOBS, cells, proofs, &blobs[0]);
+    assert(ret == C_KZG_OK);
+
+    // The descriptor becomes readable once there is something to reap
+    struct pollfd pfd = {fd, POLLIN, 0};
+    int num_ready = poll(&pfd, 1, 60000);
+    assert(num_ready == 1);
+    KZGCompletion results[NUM_BLOBS + 1];
+    size_t n = kzg_queue_poll(q, completions, 8);
+    assert(n > 0);
+    for (size_t i = 0; i < n; i++) {
+        results[completions[i].user_data] = completions[i];
+    }
+    reap(q, results, NUM_BLOBS + 1 - n);
+    for (size_t i = 0; i < NUM_BLOBS + 1; i++) {
+        assert(results[i].ret == C_KZG_OK);
+    }
+    assert(results[NUM_BLOBS].type == KZG_JOB_COMPUTE_CELLS_AND_KZG_PROOFS);
+    n = kzg_queue_poll(q, completions, 8);
+    assert(n == 0);
+    n = kzg_queue_wait(q, completions, 8);
+    assert(n == 0);
+
+    for (size_t i = 0; i < NUM_BLOBS; i++) {
+        KZGCommitment expected;
+        ret = blob_to_kzg_commitment(&expected, &blobs[i], &s);
+        assert(ret == C_KZG_OK);
+        assert(memcmp(&commitments[i], &expected, sizeof(expected)) == 0);
+        ret = compute_blob_kzg_proof(&blob_proofs[i], &blobs[i], &commitments[i], &s);
+        assert(ret == C_KZG_OK);
+    }
+    ret = compute_cells_and_kzg_proofs(
+        &cells[CELLS_PER_EXT_BLOB], &proofs[CELLS_PER_EXT_BLOB], &blobs[0], &s
+    );
+    assert(ret == C_KZG_OK);
+    assert(memcmp(cells, &cells[CELLS_PER_EXT_BLOB], CELLS_PER_EXT_BLOB * sizeof(Cell)) == 0);
+    assert(memcmp(proofs, &proofs[CELLS_PER_EXT_BLOB], CELLS_PER_EXT_BLOB * sizeof(KZGProof)) == 0);
+
+    // Verify both kinds of batch, and recover the first blob's cells from half of them
+    Bytes48 cell_commitments[CELLS_PER_EXT_BLOB];
+    uint64_t cell_indices[CELLS_PER_EXT_BLOB];
+    for (size_t i = 0; i < CELLS_PER_EXT_BLOB; i++) {
+        cell_commitments[i] = commitments[0];
+        cell_indices[i] = i;
+    }
+    ret = kzg_queue_submit_verify_blob_kzg_proof_batch(
+        q, 0, &blobs_ok, blobs, commitments, blob_proofs, NUM_BLOBS
+    );
+    assert(ret == C_KZG_OK);
+    ret = kzg_queue_submit_verify_cell_kzg_proof_batch(
+        q, 1, &cells_ok, cell_commitments, cell_indices, cells, proofs, CELLS_PER_EXT_BLOB
+    );
+    assert(ret == C_KZG_OK);
+    ret = kzg_queue_submit_recover_cells_and_kzg_proofs(
+        q,
+        2,
+        &cells[CELLS_PER_EXT_BLOB],
+        &proofs[CELLS_PER_EXT_BLOB],
+        cell_indices,
+        cells,
+        CELLS_PER_EXT_BLOB / 2
+    );
+    assert(ret == C_KZG_OK);
+
+    reap(q, completions, 3);
+    assert(completions[0].type == KZG_JOB_VERIFY_BLOB_KZG_PROOF_BATCH);
+    assert(completions[1].type == KZG_JOB_VERIFY_CELL_KZG_PROOF_BATCH);
+    assert(completions[2].type == KZG_JOB_RECOVER_CELLS_AND_KZG_PROOFS);
+    for (size_t i = 0; i < 3; i++) {
+        assert(completions[i].ret == C_KZG_OK);
+    }
+    assert(blobs_ok && cells_ok);
+    assert(memcmp(cells, &cells[CELLS_PER_EXT_BLOB], CELLS_PER_EXT_BLOB * sizeof(Cell)) == 0);
+    assert(memcmp(proofs, &proofs[CELLS_PER_EXT_BLOB], CELLS_PER_EXT_BLOB * sizeof(KZGProof)) == 0);
+
+    // Errors come back in the completion
+    uint64_t bad_index = CELLS_PER_EXT_BLOB;
+    ret = kzg_queue_submit_verify_cell_kzg_proof_batch(
+        q, 3, &cells_ok, cell_commitments, &bad_index, cells, proofs, 1
+    );
+    assert(ret == C_KZG_OK);
+    n = kzg_queue_wait(q, completions, 8);
+    assert(n == 1);
+    assert(completions[0].user_data == 3 && completions[0].ret == C_KZG_BADARGS);
+
+    kzg_queue_free(q);
+    free(blobs);
+    free(cells);
+    free(proofs);
+}
+
+static void test_queue_rejects_jobs_over_capacity(void) {
+    printf("Running test: submissions over capacity are rejected\n");
+
+    Blob *blob = calloc(1, sizeof(Blob));
+    assert(blob != NULL);
+    KZGCommitment commitments[3];
+    KZGCompletion completions[3];
+    C_KZG_RET ret;
+
+    KZGQueue *q = NULL;
+    ret = kzg_queue_new(&q, &s, 1, 2, false, NULL, NULL);
+    assert(ret == C_KZG_OK);
+    for (size_t i = 0; i < 2; i++) {
+        ret = kzg_queue_submit_blob_to_kzg_commitment(q, i, &commitments[i], blob);
+        assert(ret == C_KZG_OK);
+    }
+    ret = kzg_queue_submit_blob_to_kzg_commitment(q, 2, &commitments[2], blob);
+    assert(ret == C_KZG_ERROR);
+
+    // Completions hold their slot until they are reaped
+    reap(q, completions, 2);
+    ret = kzg_queue_submit_blob_to_kzg_commitment(q, 2, &commitments[2], blob);
+    assert(ret == C_KZG_OK);
+
+    kzg_queue_free(q);
+    free(blob);
+}
+
+typedef struct {
+    pthread_mutex_t lock;
+    size_t num_completions;
+    size_t num_errors;
+} CallbackCounts;
+
+static void count_completion(void *ctx, const KZGCompletion *completion) {
+    CallbackCounts *counts = ctx;
+    pthread_mutex_lock(&counts->lock);
+    counts->num_completions++;
+    if (completion->ret != C_KZG_OK) counts->num_errors++;
+    pthread_mutex_unlock(&counts->lock);
+}
+
+static void test_queue_callback_sees_every_job(void) {
+    printf("Running test: the callback sees every job\n");
+
+    Blob *blobs = calloc(NUM_BLOBS, sizeof(Blob));
+    assert(blobs != NULL);
+    KZGCommitment commitments[NUM_BLOBS];
+    CallbackCounts counts = {PTHREAD_MUTEX_INITIALIZER, 0, 0};
+    C_KZG_RET ret;
+
+    for (size_t i = 0; i < NUM_BLOBS; i++) {
+        get_rand_blob(&blobs[i]);
+    }
+    // A non-canonical field element
+    memset(blobs[NUM_BLOBS - 1].bytes, 0xff, BYTES_PER_FIELD_ELEMENT);
+
+    KZGQueue *q = NULL;
+    ret = kzg_queue_new(&q, &s, 2, NUM_BLOBS, false, count_completion, &counts);
+    assert(ret == C_KZG_OK);
+    int fd = kzg_queue_fd(q);
+    assert(fd == -1);
+    for (size_t i = 0; i < NUM_BLOBS; i++) {
+        ret = kzg_queue_submit_blob_to_kzg_commitment(q, i, &commitments[i], &blobs[i]);
+        assert(ret == C_KZG_OK);
+    }
+
+    // Waiting on a callback queue returns once everything in flight has been delivered
+    size_t n = kzg_queue_wait(q, NULL, 0);
+    assert(n == 0);
+    assert(counts.num_completions == NUM_BLOBS);
+    assert(counts.num_errors == 1);
+
+    // Freeing the queue runs the jobs still in it first
+    for (size_t i = 0; i < NUM_BLOBS; i++) {
+        ret = kzg_queue_submit_blob_to_kzg_commitment(q, i, &commitments[i], &blobs[i]);
+        assert(ret == C_KZG_OK);
+    }
+    kzg_queue_free(q);
+    assert(counts.num_completions == 2 * NUM_BLOBS);
+
+    free(blobs);
+}
+
+static void test_queue_poll_leaves_descriptor_readable(void) {
+    printf("Running test: completions left behind by a poll keep the descriptor readable\n");
+
+    Blob *blob = calloc(1, sizeof(Blob));
+    assert(blob != NULL);
+    KZGCommitment commitments[NUM_BLOBS];
+    KZGCompletion completion;
+    C_KZG_RET ret;
+
+    KZGQueue *q = NULL;
+    ret = kzg_queue_new(&q, &s, 2, NUM_BLOBS, false, NULL, NULL);
+    assert(ret == C_KZG_OK);
+    for (size_t i = 0; i < NUM_BLOBS; i++) {
+        ret = kzg_queue_submit_blob_to_kzg_commitment(q, i, &commitments[i], blob);
+        assert(ret == C_KZG_OK);
+    }
+
+    // Give the jobs time to pile up, then reap them one at a time, as an event loop would
+    struct pollfd pfd = {kzg_queue_fd(q), POLLIN, 0};
+    int num_ready = poll(&pfd, 1, 60000);
+    assert(num_ready == 1);
+    usleep(100000);
+    for (size_t i = 0; i < NUM_BLOBS; i++) {
+        num_ready = poll(&pfd, 1, 60000);
+        assert(num_ready == 1);
+        size_t n = kzg_queue_poll(q, &completion, 1);
+        assert(n == 1);
+        assert(completion.ret == C_KZG_OK);
+    }
+
+    kzg_queue_free(q);
+    free(blob);
+}
+
+static void test_queue_blocks_when_full(void) {
+    printf("Running test: a queue which blocks when full waits for a free slot\n");
+
+    Blob *blob = calloc(1, sizeof(Blob));
+    assert(blob != NULL);
+    KZGCommitment commitments[NUM_BLOBS];
+    CallbackCounts counts = {PTHREAD_MUTEX_INITIALIZER, 0, 0};
+    C_KZG_RET ret;
+
+    // With a single slot, every submission after the first has to wait for the one before
+    KZGQueue *q = NULL;
+    ret = kzg_queue_new(&q, &s, 1, 1, true, count_completion, &counts);
+    assert(ret == C_KZG_OK);
+    for (size_t i = 0; i < NUM_BLOBS; i++) {
+        ret = kzg_queue_submit_blob_to_kzg_commitment(q, i, &commitments[i], blob);
+        assert(ret == C_KZG_OK);
+    }
+    size_t n = kzg_queue_wait(q, NULL, 0);
+    assert(n == 0);
+    assert(counts.num_completions == NUM_BLOBS);
+    assert(counts.num_errors == 0);
+
+    kzg_queue_free(q);
+    free(blob);
+}
+
+int main(void) {
+    printf("=== C-KZG-4844 Job Queue Test Suite ===\n\n");
+
+    FILE *fp = fopen("./trusted_setup.txt", "r");
+    if (fp == NULL) {
+        fprintf(stderr, "Error: Could not open trusted_setup.txt\n");
+        return 1;
+    }
+    C_KZG_RET ret = load_trusted_setup_file(&s, fp, 0);
+    fclose(fp);
+    if (ret != C_KZG_OK) {
+        fprintf(stderr, "Error: Failed to load trusted setup (error code: %d)\n", ret);
+        return 1;
+    }
+
+    test_queue_jobs_match_blocking_calls();
+    test_queue_rejects_jobs_over_capacity();
+    test_queue_callback_sees_every_job();
+    test_queue_poll_leaves_descriptor_readable();
+    test_queue_blocks_when_full();
+
+    free_trusted_setup(&s);
+    printf("\n=== All tests passed ===\n");
+    return 0;
+}
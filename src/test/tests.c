@@ -33,6 +33,24 @@ static void get_rand_g1_bytes(Bytes48 *out) {
     ASSERT_EQUALS(ret, C_KZG_OK);
 }
 
+static void get_rand_point_eval_claim(Bytes48 *commitment, Bytes32 *z, Bytes32 *y, Bytes48 *proof) {
+    C_KZG_RET ret;
+    Blob blob;
+
+    get_rand_blob(&blob);
+    get_rand_field_element(z);
+    ret = blob_to_kzg_commitment(commitment, &blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = compute_kzg_proof(proof, y, &blob, z, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+}
+
+static void get_rand_cell(Cell *out) {
+    for (size_t i = 0; i < FIELD_ELEMENTS_PER_CELL; i++) {
+        get_rand_field_element((Bytes32 *)&out->bytes[i * BYTES_PER_FIELD_ELEMENT]);
+    }
+}
+
 static void get_rand_fr(fr_t *out) {
     Bytes32 tmp_bytes;
 
@@ -342,6 +360,48 @@ static void test_g1_mul__test_different_bit_lengths(void) {
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tests for g1_mul_fixed_base
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void test_g1_mul_fixed_base__test_consistent(void) {
+    fr_t f;
+    g1_t r, check;
+
+    for (size_t i = 0; i < 16; i++) {
+        get_rand_fr(&f);
+
+        g1_mul(&check, blst_p1_generator(), &f);
+        g1_mul_fixed_base(&r, s.g1_generator_table, &f);
+
+        ASSERT("points are equal", blst_p1_is_equal(&check, &r));
+    }
+}
+
+static void test_g1_mul_fixed_base__test_scalar_is_zero(void) {
+    fr_t f;
+    g1_t r;
+
+    fr_from_uint64(&f, 0);
+
+    g1_mul_fixed_base(&r, s.g1_generator_table, &f);
+
+    ASSERT("result is neutral element", blst_p1_is_inf(&r));
+}
+
+static void test_g1_mul_fixed_base__test_max_scalar(void) {
+    fr_t f;
+    g1_t r, check;
+
+    /* The largest field element uses the most significant window */
+    blst_fr_sub(&f, &FR_ZERO, &FR_ONE);
+
+    g1_mul(&check, blst_p1_generator(), &f);
+    g1_mul_fixed_base(&r, s.g1_generator_table, &f);
+
+    ASSERT("points are equal", blst_p1_is_equal(&check, &r));
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Tests for pairings_verify
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -379,6 +439,38 @@ static void test_pairings_verify__bad_pairing(void) {
     ASSERT("pairings fail", !pairings_verify(&g1, &s1g2, &sg1, &g2));
 }
 
+static void test_pairings_product_is_one__three_pairings(void) {
+    fr_t f, g;
+    g1_t g1s[3];
+    g2_t g2s[3];
+    g1_t g1;
+    g2_t g2, h2;
+
+    get_rand_fr(&f);
+    get_rand_fr(&g);
+
+    get_rand_g1(&g1);
+    get_rand_g2(&g2);
+    get_rand_g2(&h2);
+
+    /* e([f]g1, g2) * e([g]g1, h2) * e(-g1, [f]g2 + [g]h2) == 1 */
+    g1_mul(&g1s[0], &g1, &f);
+    g2s[0] = g2;
+    g1_mul(&g1s[1], &g1, &g);
+    g2s[1] = h2;
+    g1s[2] = g1;
+    blst_p1_cneg(&g1s[2], true);
+    g2_mul(&g2s[2], &g2, &f);
+    g2_mul(&h2, &h2, &g);
+    blst_p2_add_or_double(&g2s[2], &g2s[2], &h2);
+    ASSERT("pairings verify", pairings_product_is_one(g1s, g2s, 3));
+
+    /* The point at infinity contributes nothing */
+    g1s[1] = G1_IDENTITY;
+    ASSERT("pairings fail", !pairings_product_is_one(g1s, g2s, 3));
+    ASSERT("no pairings verify", pairings_product_is_one(g1s, g2s, 0));
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Tests for blob_to_kzg_commitment
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -504,6 +596,31 @@ static void test_blob_to_kzg_commitment__succeeds_expected_commitment(void) {
     ASSERT_EQUALS(diff, 0);
 }
 
+static void test_blob_to_kzg_commitments__matches_single_calls(void) {
+    C_KZG_RET ret;
+    Blob blobs[3];
+    KZGCommitment commitments[3], expected;
+    int diff;
+
+    for (size_t i = 0; i < 3; i++) {
+        get_rand_blob(&blobs[i]);
+    }
+
+    ret = blob_to_kzg_commitments(commitments, blobs, 3, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    for (size_t i = 0; i < 3; i++) {
+        ret = blob_to_kzg_commitment(&expected, &blobs[i], &s);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+        diff = memcmp(commitments[i].bytes, expected.bytes, BYTES_PER_COMMITMENT);
+        ASSERT_EQUALS(diff, 0);
+    }
+
+    /* A non-canonical field element in the last blob */
+    memset(blobs[2].bytes, 0xff, BYTES_PER_FIELD_ELEMENT);
+    ret = blob_to_kzg_commitments(commitments, blobs, 3, &s);
+    ASSERT_EQUALS(ret, C_KZG_BADARGS);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Tests for validate_kzg_g1
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -920,6 +1037,33 @@ static void test_g1_lincomb__verify_consistent(void) {
     ASSERT("pippenger matches naive MSM", blst_p1_is_equal(&out, &check));
 }
 
+static void test_g1_lincomb_affine__verify_consistent(void) {
+    C_KZG_RET ret;
+    g1_t points[128], out, check;
+    blst_p1_affine points_affine[128];
+    fr_t scalars[128];
+
+    for (size_t i = 0; i < 128; i++) {
+        get_rand_fr(&scalars[i]);
+        get_rand_g1(&points[i]);
+    }
+
+    /* Include some infinity points, these must survive the conversion to affine */
+    points[0] = G1_IDENTITY;
+    points[77] = G1_IDENTITY;
+
+    g1_lincomb_naive(&check, points, scalars, 128);
+
+    ret = g1s_to_affine(points_affine, points, 128);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT("infinity stays infinity", blst_p1_affine_is_inf(&points_affine[77]));
+
+    ret = g1_lincomb_affine(&out, points_affine, scalars, 128);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    ASSERT("affine pippenger matches naive MSM", blst_p1_is_equal(&out, &check));
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Tests for evaluate_polynomial_in_evaluation_form
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1588,6 +1732,233 @@ static void test_verify_kzg_proof_batch__fails_invalid_blob(void) {
     ASSERT_EQUALS(ret, C_KZG_BADARGS);
 }
 
+static void test_verify_kzg_proof_batch__succeeds_unrelated_openings(void) {
+    C_KZG_RET ret;
+    const size_t n = 8;
+    Bytes48 commitments[n], proofs[n];
+    Bytes32 zs[n], ys[n];
+    Blob blob;
+    bool ok;
+
+    /* Open a different polynomial at a different point for each item */
+    for (size_t i = 0; i < n; i++) {
+        get_rand_blob(&blob);
+        get_rand_field_element(&zs[i]);
+        ret = blob_to_kzg_commitment(&commitments[i], &blob, &s);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+        ret = compute_kzg_proof(&proofs[i], &ys[i], &blob, &zs[i], &s);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+    }
+
+    /* Verify batched openings for 0,1,2..8 items */
+    for (size_t count = 0; count <= n; count++) {
+        ret = verify_kzg_proof_batch(&ok, commitments, zs, ys, proofs, count, &s);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+        ASSERT_EQUALS(ok, true);
+    }
+}
+
+static void test_verify_kzg_proof_batch__fails_with_incorrect_value(void) {
+    C_KZG_RET ret;
+    const size_t n = 4;
+    Bytes48 commitments[n], proofs[n];
+    Bytes32 zs[n], ys[n];
+    Blob blob;
+    bool ok;
+
+    /* Open the same polynomial at different points */
+    get_rand_blob(&blob);
+    ret = blob_to_kzg_commitment(&commitments[0], &blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    for (size_t i = 0; i < n; i++) {
+        commitments[i] = commitments[0];
+        get_rand_field_element(&zs[i]);
+        ret = compute_kzg_proof(&proofs[i], &ys[i], &blob, &zs[i], &s);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+    }
+
+    /* Swap two of the claimed values */
+    Bytes32 tmp = ys[1];
+    ys[1] = ys[2];
+    ys[2] = tmp;
+
+    ret = verify_kzg_proof_batch(&ok, commitments, zs, ys, proofs, n, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, false);
+}
+
+static void test_verify_kzg_proof_batch__fails_z_not_field_element(void) {
+    C_KZG_RET ret;
+    const size_t n = 2;
+    Bytes48 commitments[n], proofs[n];
+    Bytes32 zs[n], ys[n];
+    bool ok;
+
+    for (size_t i = 0; i < n; i++) {
+        get_rand_g1_bytes(&commitments[i]);
+        get_rand_field_element(&zs[i]);
+        get_rand_field_element(&ys[i]);
+        get_rand_g1_bytes(&proofs[i]);
+    }
+
+    /* Overwrite the second point with the modulus */
+    bytes32_from_hex(&zs[1], "73eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff00000001");
+
+    ret = verify_kzg_proof_batch(&ok, commitments, zs, ys, proofs, n, &s);
+    ASSERT_EQUALS(ret, C_KZG_BADARGS);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tests for kzg_point_eval_accumulator
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void test_kzg_point_eval_accumulator__succeeds_round_trip(void) {
+    C_KZG_RET ret;
+    const size_t n = 20;
+    Bytes48 commitment, proof;
+    Bytes32 z, y;
+    KZGPointEvalAccumulator acc;
+    bool ok, item_ok[n];
+
+    kzg_point_eval_accumulator_init(&acc);
+
+    /* Add enough claims to make the accumulator grow */
+    for (size_t i = 0; i < n; i++) {
+        get_rand_point_eval_claim(&commitment, &z, &y, &proof);
+        ret = kzg_point_eval_accumulator_add(&acc, &commitment, &z, &y, &proof);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+    }
+    ASSERT_EQUALS(acc.length, n);
+
+    ret = kzg_point_eval_accumulator_finalize(&ok, item_ok, &acc, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, true);
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_EQUALS(item_ok[i], true);
+    }
+
+    /* The accumulator is empty afterwards, which also verifies */
+    ASSERT_EQUALS(acc.length, 0);
+    ret = kzg_point_eval_accumulator_finalize(&ok, NULL, &acc, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, true);
+
+    kzg_point_eval_accumulator_free(&acc);
+}
+
+static void test_kzg_point_eval_accumulator__fails_with_incorrect_value(void) {
+    C_KZG_RET ret;
+    const size_t n = 4;
+    Bytes48 commitment, proof;
+    Bytes32 z, y;
+    KZGPointEvalAccumulator acc;
+    bool ok, item_ok[n];
+
+    kzg_point_eval_accumulator_init(&acc);
+
+    for (size_t i = 0; i < n; i++) {
+        get_rand_point_eval_claim(&commitment, &z, &y, &proof);
+        /* Claim the wrong evaluation result for the third item */
+        if (i == 2) get_rand_field_element(&y);
+        ret = kzg_point_eval_accumulator_add(&acc, &commitment, &z, &y, &proof);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+    }
+
+    /* The fallback pins down the invalid claim */
+    ret = kzg_point_eval_accumulator_finalize(&ok, item_ok, &acc, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, false);
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_EQUALS(item_ok[i], i != 2);
+    }
+
+    kzg_point_eval_accumulator_free(&acc);
+}
+
+static void test_kzg_point_eval_accumulator__fails_z_not_field_element(void) {
+    C_KZG_RET ret;
+    Bytes48 commitment, proof;
+    Bytes32 z, y;
+    KZGPointEvalAccumulator acc;
+
+    kzg_point_eval_accumulator_init(&acc);
+
+    get_rand_point_eval_claim(&commitment, &z, &y, &proof);
+    bytes32_from_hex(&z, "73eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff00000001");
+
+    /* Malformed inputs are rejected straight away and not accumulated */
+    ret = kzg_point_eval_accumulator_add(&acc, &commitment, &z, &y, &proof);
+    ASSERT_EQUALS(ret, C_KZG_BADARGS);
+    ASSERT_EQUALS(acc.length, 0);
+
+    kzg_point_eval_accumulator_free(&acc);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tests for verify_blob_kzg_proof_batch_locate
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void test_verify_blob_kzg_proof_batch_locate__succeeds_round_trip(void) {
+    C_KZG_RET ret;
+    const size_t n = 4;
+    Bytes48 proofs[n];
+    KZGCommitment commitments[n];
+    Blob blobs[n];
+    uint64_t invalid_indices[n];
+    uint64_t num_invalid;
+    bool ok;
+
+    for (size_t i = 0; i < n; i++) {
+        get_rand_blob(&blobs[i]);
+        ret = blob_to_kzg_commitment(&commitments[i], &blobs[i], &s);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+        ret = compute_blob_kzg_proof(&proofs[i], &blobs[i], &commitments[i], &s);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+    }
+
+    /* This should still work with zero blobs */
+    for (size_t count = 0; count <= n; count++) {
+        ret = verify_blob_kzg_proof_batch_locate(
+            &ok, invalid_indices, &num_invalid, blobs, commitments, proofs, count, &s
+        );
+        ASSERT_EQUALS(ret, C_KZG_OK);
+        ASSERT_EQUALS(ok, true);
+        ASSERT_EQUALS(num_invalid, 0);
+    }
+}
+
+static void test_verify_blob_kzg_proof_batch_locate__finds_incorrect_proofs(void) {
+    C_KZG_RET ret;
+    const size_t n = 7;
+    Bytes48 proofs[n];
+    KZGCommitment commitments[n];
+    Blob blobs[n];
+    uint64_t invalid_indices[n];
+    uint64_t num_invalid;
+    bool ok;
+
+    for (size_t i = 0; i < n; i++) {
+        get_rand_blob(&blobs[i]);
+        ret = blob_to_kzg_commitment(&commitments[i], &blobs[i], &s);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+        ret = compute_blob_kzg_proof(&proofs[i], &blobs[i], &commitments[i], &s);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+    }
+
+    /* Overwrite two proofs with incorrect ones */
+    proofs[2] = proofs[0];
+    proofs[6] = proofs[0];
+
+    ret = verify_blob_kzg_proof_batch_locate(
+        &ok, invalid_indices, &num_invalid, blobs, commitments, proofs, n, &s
+    );
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, false);
+    ASSERT_EQUALS(num_invalid, 2);
+    ASSERT_EQUALS(invalid_indices[0], 2);
+    ASSERT_EQUALS(invalid_indices[1], 6);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Tests for expand_root_of_unity
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1819,13 +2190,39 @@ static void test_deduplicate_commitments__one_commitment(void) {
     ASSERT_EQUALS(indices[0], 0);
 }
 
+static void test_deduplicate_commitments__many_duplicates(void) {
+    C_KZG_RET ret;
+    const size_t n = 1000;
+    const size_t num_unique = 37;
+    Bytes48 commitments[n];
+    uint64_t indices[n];
+    size_t count = n;
+
+    for (size_t i = 0; i < n; i++) {
+        memset(&commitments[i], (int)(i % num_unique), sizeof(Bytes48));
+    }
+
+    ret = deduplicate_commitments(commitments, indices, &count);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    /* Unique commitments are in order of first occurrence */
+    ASSERT_EQUALS(count, num_unique);
+    for (size_t i = 0; i < num_unique; i++) {
+        ASSERT_EQUALS(commitments[i].bytes[0], i);
+    }
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_EQUALS(indices[i], i % num_unique);
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Tests for coset shift factors
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 static void test_shift_factors__succeeds(void) {
-    fr_t expected_inv_coset_factor, computed_inv_coset_factor, h_k;
+    fr_t inv_h_k, expected_inv_coset_factor_pow, h_k;
     fr_t expected_coset_factor_pow, computed_coset_factor_pow;
+    const fr_t *computed_inv_coset_factor_powers;
     static uint64_t n = FIELD_ELEMENTS_PER_CELL;
 
     /* Loop over all cells */
@@ -1839,17 +2236,20 @@ static void test_shift_factors__succeeds(void) {
         /* Get h_k for this cell */
         h_k = s.roots_of_unity[cell_idx_rbl];
 
-        /* First we test get_inv_coset_shift_for_cell() */
+        /* First we test get_inv_coset_shift_powers_for_cell() */
 
         /* Compute the expected inverse coset factor */
-        blst_fr_eucl_inverse(&expected_inv_coset_factor, &h_k);
+        blst_fr_eucl_inverse(&inv_h_k, &h_k);
 
         /* Call the function we are testing */
-        get_inv_coset_shift_for_cell(&computed_inv_coset_factor, cell_index, &s);
+        computed_inv_coset_factor_powers = get_inv_coset_shift_powers_for_cell(cell_index, &s);
 
-        /* Compare the expected and computed inverse coset factors */
-        bool ok = fr_equal(&expected_inv_coset_factor, &computed_inv_coset_factor);
-        ASSERT_EQUALS(ok, true);
+        /* Compare the expected and computed powers of the inverse coset factor */
+        for (uint64_t j = 0; j < n; j++) {
+            fr_pow(&expected_inv_coset_factor_pow, &inv_h_k, j);
+            const fr_t *computed = &computed_inv_coset_factor_powers[j];
+            ASSERT_EQUALS(fr_equal(&expected_inv_coset_factor_pow, computed), true);
+        }
 
         /* Now we test get_coset_shift_pow_for_cell() */
 
@@ -1860,191 +2260,1285 @@ static void test_shift_factors__succeeds(void) {
         get_coset_shift_pow_for_cell(&computed_coset_factor_pow, cell_index, &s);
 
         /* Compare the expected and computed inverse coset factors */
-        ok = fr_equal(&expected_coset_factor_pow, &computed_coset_factor_pow);
+        bool ok = fr_equal(&expected_coset_factor_pow, &computed_coset_factor_pow);
         ASSERT_EQUALS(ok, true);
     }
 }
 
-////////////////////////////////////////////////////////////////////////////////////////////////////
-// Tests for recover_cells_and_kzg_proofs
-////////////////////////////////////////////////////////////////////////////////////////////////////
+static void test_shift_cell_poly__matches_shift_poly(void) {
+    fr_t poly[FIELD_ELEMENTS_PER_CELL], expected[FIELD_ELEMENTS_PER_CELL];
+    fr_t inv_h_k;
+    uint64_t cell_index;
 
-static void test_recover_cells_and_kzg_proofs__succeeds_random_blob(void) {
-    C_KZG_RET ret;
-    Blob blob;
-    const size_t num_partial_cells = CELLS_PER_EXT_BLOB / 2;
-    uint64_t cell_indices[CELLS_PER_EXT_BLOB];
-    Cell cells[CELLS_PER_EXT_BLOB];
-    Cell partial_cells[num_partial_cells];
-    Cell recovered_cells[CELLS_PER_EXT_BLOB];
-    KZGProof proofs[CELLS_PER_EXT_BLOB];
-    KZGProof recovered_proofs[CELLS_PER_EXT_BLOB];
-    int diff;
+    get_rand_uint64(&cell_index);
+    cell_index %= CELLS_PER_EXT_BLOB;
 
-    /* Get a random blob */
-    get_rand_blob(&blob);
+    for (size_t i = 0; i < FIELD_ELEMENTS_PER_CELL; i++) {
+        get_rand_fr(&poly[i]);
+        expected[i] = poly[i];
+    }
 
-    /* Get the cells and proofs */
-    ret = compute_cells_and_kzg_proofs(cells, proofs, &blob, &s);
-    ASSERT_EQUALS(ret, C_KZG_OK);
+    /* Shift the expected poly the old way, with h_k^{-1} */
+    uint64_t cell_idx_rbl = reverse_bits_limited(CELLS_PER_EXT_BLOB, cell_index);
+    blst_fr_eucl_inverse(&inv_h_k, &s.roots_of_unity[cell_idx_rbl]);
+    shift_poly(expected, FIELD_ELEMENTS_PER_CELL, &inv_h_k);
 
-    /* Erase half of the cells */
-    for (size_t i = 0; i < num_partial_cells; i++) {
-        cell_indices[i] = i * 2;
-        memcpy(&partial_cells[i], &cells[cell_indices[i]], sizeof(Cell));
+    shift_cell_poly(poly, cell_index, &s);
+
+    for (size_t i = 0; i < FIELD_ELEMENTS_PER_CELL; i++) {
+        ASSERT("shifted coefficients match", fr_equal(&poly[i], &expected[i]));
     }
+}
 
-    /* Reconstruct with half of the cells */
-    ret = recover_cells_and_kzg_proofs(
-        recovered_cells, recovered_proofs, cell_indices, partial_cells, num_partial_cells, &s
+static void test_commit_to_cell_poly__matches_lincomb(void) {
+    C_KZG_RET ret;
+    fr_t poly[FIELD_ELEMENTS_PER_CELL];
+    g1_t out, check;
+
+    for (size_t i = 0; i < FIELD_ELEMENTS_PER_CELL; i++) {
+        get_rand_fr(&poly[i]);
+    }
+
+    g1_lincomb_naive(&check, s.g1_values_monomial, poly, FIELD_ELEMENTS_PER_CELL);
+
+    ret = commit_to_cell_poly(&out, poly, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    ASSERT("fixed-base MSM matches naive MSM", blst_p1_is_equal(&out, &check));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tests for compute_cells_and_kzg_proofs_batch
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void test_compute_cells_and_kzg_proofs_batch__matches_single_calls(void) {
+    C_KZG_RET ret;
+    Blob blobs[2];
+    Cell *cells = NULL, *cells_only = NULL, *expected_cells = NULL;
+    KZGProof *proofs = NULL, *expected_proofs = NULL;
+    int diff;
+
+    ret = c_kzg_calloc((void **)&cells, 2 * CELLS_PER_EXT_BLOB, sizeof(Cell));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = c_kzg_calloc((void **)&cells_only, 2 * CELLS_PER_EXT_BLOB, sizeof(Cell));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = c_kzg_calloc((void **)&expected_cells, CELLS_PER_EXT_BLOB, sizeof(Cell));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = c_kzg_calloc((void **)&proofs, 2 * CELLS_PER_EXT_BLOB, sizeof(KZGProof));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = c_kzg_calloc((void **)&expected_proofs, CELLS_PER_EXT_BLOB, sizeof(KZGProof));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    for (size_t i = 0; i < 2; i++) {
+        get_rand_blob(&blobs[i]);
+    }
+
+    ret = compute_cells_and_kzg_proofs_batch(cells, proofs, blobs, 2, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = compute_cells_and_kzg_proofs_batch(cells_only, NULL, blobs, 2, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    /* The outputs of each blob are laid out one after the other */
+    for (size_t i = 0; i < 2; i++) {
+        ret = compute_cells_and_kzg_proofs(expected_cells, expected_proofs, &blobs[i], &s);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+        diff = memcmp(
+            &cells[i * CELLS_PER_EXT_BLOB], expected_cells, CELLS_PER_EXT_BLOB * sizeof(Cell)
+        );
+        ASSERT_EQUALS(diff, 0);
+        diff = memcmp(
+            &cells_only[i * CELLS_PER_EXT_BLOB], expected_cells, CELLS_PER_EXT_BLOB * sizeof(Cell)
+        );
+        ASSERT_EQUALS(diff, 0);
+        diff = memcmp(
+            &proofs[i * CELLS_PER_EXT_BLOB],
+            expected_proofs,
+            CELLS_PER_EXT_BLOB * sizeof(KZGProof)
+        );
+        ASSERT_EQUALS(diff, 0);
+    }
+
+    c_kzg_free(cells);
+    c_kzg_free(cells_only);
+    c_kzg_free(expected_cells);
+    c_kzg_free(proofs);
+    c_kzg_free(expected_proofs);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tests for recover_cells_and_kzg_proofs
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void test_recover_cells_and_kzg_proofs__succeeds_random_blob(void) {
+    C_KZG_RET ret;
+    Blob blob;
+    const size_t num_partial_cells = CELLS_PER_EXT_BLOB / 2;
+    uint64_t cell_indices[CELLS_PER_EXT_BLOB];
+    Cell cells[CELLS_PER_EXT_BLOB];
+    Cell partial_cells[num_partial_cells];
+    Cell recovered_cells[CELLS_PER_EXT_BLOB];
+    KZGProof proofs[CELLS_PER_EXT_BLOB];
+    KZGProof recovered_proofs[CELLS_PER_EXT_BLOB];
+    int diff;
+
+    /* Get a random blob */
+    get_rand_blob(&blob);
+
+    /* Get the cells and proofs */
+    ret = compute_cells_and_kzg_proofs(cells, proofs, &blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    /* Erase half of the cells */
+    for (size_t i = 0; i < num_partial_cells; i++) {
+        cell_indices[i] = i * 2;
+        memcpy(&partial_cells[i], &cells[cell_indices[i]], sizeof(Cell));
+    }
+
+    /* Reconstruct with half of the cells */
+    ret = recover_cells_and_kzg_proofs(
+        recovered_cells, recovered_proofs, cell_indices, partial_cells, num_partial_cells, &s
+    );
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    /* Check that all of the cells match */
+    for (size_t i = 0; i < CELLS_PER_EXT_BLOB; i++) {
+        diff = memcmp(&cells[i], &recovered_cells[i], sizeof(Cell));
+        ASSERT_EQUALS(diff, 0);
+        diff = memcmp(&proofs[i], &recovered_proofs[i], sizeof(KZGProof));
+        ASSERT_EQUALS(diff, 0);
+    }
+}
+
+static void test_compute_vanishing_polynomial_from_roots(void) {
+    /*
+     * Test case: (x - 2)(x - 3)
+     *
+     * Expected result: x^2 - 5x + 6
+     */
+
+    /* Initialize array with the roots 2 and 3 */
+    fr_t roots[2];
+    fr_from_uint64(&roots[0], 2);
+    fr_from_uint64(&roots[1], 3);
+    size_t roots_len = 2;
+
+    fr_t poly[3];
+    size_t poly_len = 3;
+
+    compute_vanishing_polynomial_from_roots(poly, &poly_len, roots, roots_len);
+
+    fr_t expected[3];
+
+    fr_from_uint64(&expected[0], 6);
+
+    /* Negate 5 */
+    fr_from_uint64(&expected[1], 5);
+    blst_fr_cneg(&expected[1], &expected[1], true);
+
+    expected[2] = FR_ONE;
+
+    ASSERT("polynomial length is 3", poly_len == 3);
+    ASSERT("coefficient 0 are equal", fr_equal(&poly[0], &expected[0]));
+    ASSERT("coefficient 1 are equal", fr_equal(&poly[1], &expected[1]));
+    ASSERT("coefficient 2 are equal", fr_equal(&poly[2], &expected[2]));
+}
+
+static void test_vanishing_polynomial_for_missing_cells(void) {
+    C_KZG_RET ret;
+
+    fr_t vanishing_poly[FIELD_ELEMENTS_PER_EXT_BLOB];
+    fr_t fft_result[FIELD_ELEMENTS_PER_EXT_BLOB];
+
+    /* Test case: the 0th and 1st cell are missing */
+    uint64_t missing_cell_indices[] = {0, 1};
+    size_t len_missing_cells = 2;
+
+    ret = vanishing_polynomial_for_missing_cells(
+        vanishing_poly, missing_cell_indices, len_missing_cells, &s
+    );
+
+    /* Check return status */
+    ASSERT("compute vanishing poly from cells", ret == C_KZG_OK);
+
+    /* Compute FFT of vanishing_poly */
+    fr_fft(fft_result, vanishing_poly, FIELD_ELEMENTS_PER_EXT_BLOB, &s);
+
+    /*
+     * Check FFT results
+     *
+     * Let explain how we are picking the roots of unity:
+     * Focussing just on the missing cell index 0.
+     *
+     * We expect that the following roots will evaluate to zero on the vanishing polynomial we
+     * computed:
+     *
+     * s->roots_of_unity[0]
+     * s->roots_of_unity[128]
+     * s->roots_of_unity[256]
+     * ...
+     * s->roots_of_unity[8064]
+     *
+     * For every cell index, we should have `FIELD_ELEMENTS_PER_CELL` number of these roots. ie each
+     * cell index corresponds to 64 roots taken from `roots_of_unity` in the vanishing
+     * polynomial.
+     *
+     * In general, the formula is roots_of_unity[cell_index + CELLS_PER_EXT_BLOB * k] where
+     * `k` goes from 0 to FIELD_ELEMENTS_PER_CELL-1.
+     *
+     * For cell index 1, we would therefore expect the polynomial to vanish at points:
+     *
+     * s->roots_of_unity[1]
+     * s->roots_of_unity[129]
+     * s->roots_of_unity[257]
+     * ...
+     * s->roots_of_unity[8065]
+     *
+     * Sanity check:
+     * The largest cell index we can have is 127 since there are 128 cells.
+     *
+     * The last element for that cell index would have array index `127 + 128*63 = 8191`. This is
+     * correct since `roots_of_unity` has 8192 elements.
+     */
+    for (size_t i = 0; i < FIELD_ELEMENTS_PER_EXT_BLOB; i++) {
+        if (i % CELLS_PER_EXT_BLOB == 1 || i % CELLS_PER_EXT_BLOB == 0) {
+            /* Every CELLS_PER_EXT_BLOB-th evaluation should be zero */
+            ASSERT("evaluation is zero", fr_is_zero(&fft_result[i]));
+        } else {
+            ASSERT("evaluation is not zero", !fr_is_zero(&fft_result[i]));
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tests for verify_cell_kzg_proof_batch
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void test_verify_cell_kzg_proof_batch__succeeds_random_blob(void) {
+    C_KZG_RET ret;
+    bool ok;
+    Blob blob;
+    KZGCommitment commitment;
+    Bytes48 commitments[CELLS_PER_EXT_BLOB];
+    uint64_t cell_indices[CELLS_PER_EXT_BLOB];
+    Cell cells[CELLS_PER_EXT_BLOB];
+    KZGProof proofs[CELLS_PER_EXT_BLOB];
+
+    /* Get a random blob */
+    get_rand_blob(&blob);
+
+    /* Get the commitment to the blob */
+    ret = blob_to_kzg_commitment(&commitment, &blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    /* Compute cells and proofs */
+    ret = compute_cells_and_kzg_proofs(cells, proofs, &blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    /* Initialize list of commitments & cell indices */
+    for (size_t i = 0; i < CELLS_PER_EXT_BLOB; i++) {
+        memcpy(commitments[i].bytes, &commitment, BYTES_PER_COMMITMENT);
+        cell_indices[i] = i;
+    }
+
+    /* Verify all the proofs */
+    ret = verify_cell_kzg_proof_batch(
+        &ok, commitments, cell_indices, cells, proofs, CELLS_PER_EXT_BLOB, &s
+    );
+    ASSERT_EQUALS(ret, C_KZG_OK);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tests for verify_cell_kzg_proof_batch_locate
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void test_verify_cell_kzg_proof_batch_locate__finds_incorrect_proofs(void) {
+    C_KZG_RET ret;
+    bool ok;
+    Blob blob;
+    KZGCommitment commitment;
+    Bytes48 commitments[CELLS_PER_EXT_BLOB];
+    uint64_t cell_indices[CELLS_PER_EXT_BLOB];
+    Cell cells[CELLS_PER_EXT_BLOB];
+    KZGProof proofs[CELLS_PER_EXT_BLOB];
+    uint64_t invalid_indices[CELLS_PER_EXT_BLOB];
+    uint64_t num_invalid;
+
+    /* Get a random blob */
+    get_rand_blob(&blob);
+
+    /* Get the commitment to the blob */
+    ret = blob_to_kzg_commitment(&commitment, &blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    /* Compute cells and proofs */
+    ret = compute_cells_and_kzg_proofs(cells, proofs, &blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    /* Initialize list of commitments & cell indices */
+    for (size_t i = 0; i < CELLS_PER_EXT_BLOB; i++) {
+        memcpy(commitments[i].bytes, &commitment, BYTES_PER_COMMITMENT);
+        cell_indices[i] = i;
+    }
+
+    /* All the proofs are valid */
+    ret = verify_cell_kzg_proof_batch_locate(
+        &ok, invalid_indices, &num_invalid, commitments, cell_indices, cells, proofs, 16, &s
+    );
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, true);
+    ASSERT_EQUALS(num_invalid, 0);
+
+    /* Overwrite two proofs with the proofs of other cells */
+    proofs[3] = proofs[4];
+    proofs[100] = proofs[101];
+
+    ret = verify_cell_kzg_proof_batch_locate(
+        &ok,
+        invalid_indices,
+        &num_invalid,
+        commitments,
+        cell_indices,
+        cells,
+        proofs,
+        CELLS_PER_EXT_BLOB,
+        &s
+    );
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, false);
+    ASSERT_EQUALS(num_invalid, 2);
+    ASSERT_EQUALS(invalid_indices[0], 3);
+    ASSERT_EQUALS(invalid_indices[1], 100);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tests for verify_data_column_kzg_proofs
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void get_rand_data_column(
+    Bytes48 *commitments, Cell *column, Bytes48 *proofs, uint64_t column_index, size_t num_blobs
+) {
+    C_KZG_RET ret;
+    Blob blob;
+    Cell *cells = NULL;
+    KZGProof *cell_proofs = NULL;
+
+    /* Allocate cells because they are big */
+    ret = c_kzg_calloc((void **)&cells, CELLS_PER_EXT_BLOB, sizeof(Cell));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = c_kzg_calloc((void **)&cell_proofs, CELLS_PER_EXT_BLOB, sizeof(KZGProof));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    for (size_t i = 0; i < num_blobs; i++) {
+        get_rand_blob(&blob);
+        ret = blob_to_kzg_commitment(&commitments[i], &blob, &s);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+        ret = compute_cells_and_kzg_proofs(cells, cell_proofs, &blob, &s);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+        column[i] = cells[column_index];
+        proofs[i] = cell_proofs[column_index];
+    }
+
+    c_kzg_free(cells);
+    c_kzg_free(cell_proofs);
+}
+
+static void test_verify_data_column_kzg_proofs__succeeds_random_blobs(void) {
+    C_KZG_RET ret;
+    const size_t n = 3;
+    const uint64_t column_index = 37;
+    Bytes48 commitments[n], proofs[n];
+    uint64_t cell_indices[n];
+    Cell column[n];
+    bool ok;
+
+    get_rand_data_column(commitments, column, proofs, column_index, n);
+
+    /* This should still work with zero cells */
+    for (size_t count = 0; count <= n; count++) {
+        ret = verify_data_column_kzg_proofs(
+            &ok, column_index, commitments, column, proofs, count, &s
+        );
+        ASSERT_EQUALS(ret, C_KZG_OK);
+        ASSERT_EQUALS(ok, true);
+    }
+
+    /* The generic batch verifier agrees */
+    for (size_t i = 0; i < n; i++) {
+        cell_indices[i] = column_index;
+    }
+    ret = verify_cell_kzg_proof_batch(&ok, commitments, cell_indices, column, proofs, n, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, true);
+}
+
+static void test_verify_data_column_kzg_proofs__challenge_matches_batch(void) {
+    C_KZG_RET ret;
+    const size_t n = 4;
+    const uint64_t column_index = 5;
+    Bytes48 commitments[n], proofs[n];
+    uint64_t commitment_indices[n], cell_indices[n];
+    Cell column[n];
+    fr_t column_challenge, batch_challenge;
+
+    for (size_t i = 0; i < n; i++) {
+        get_rand_g1_bytes(&commitments[i]);
+        get_rand_g1_bytes(&proofs[i]);
+        get_rand_cell(&column[i]);
+        commitment_indices[i] = i;
+        cell_indices[i] = column_index;
+    }
+
+    ret = compute_verify_data_column_kzg_proofs_challenge(
+        &column_challenge, column_index, commitments, column, proofs, n
+    );
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = compute_verify_cell_kzg_proof_batch_challenge(
+        &batch_challenge, commitments, n, commitment_indices, cell_indices, column, proofs, n
+    );
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT("challenges match", fr_equal(&column_challenge, &batch_challenge));
+}
+
+static void test_verify_data_column_kzg_proofs__fails_with_incorrect_proof(void) {
+    C_KZG_RET ret;
+    const size_t n = 2;
+    const uint64_t column_index = 127;
+    Bytes48 commitments[n], proofs[n];
+    Cell column[n];
+    bool ok;
+
+    get_rand_data_column(commitments, column, proofs, column_index, n);
+
+    /* Overwrite second proof with an incorrect one */
+    proofs[1] = proofs[0];
+
+    ret = verify_data_column_kzg_proofs(&ok, column_index, commitments, column, proofs, n, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, false);
+}
+
+static void test_verify_data_column_kzg_proofs__fails_column_index_out_of_range(void) {
+    C_KZG_RET ret;
+    Bytes48 commitment, proof;
+    Cell cell;
+    bool ok;
+
+    get_rand_g1_bytes(&commitment);
+    get_rand_g1_bytes(&proof);
+    get_rand_cell(&cell);
+
+    ret = verify_data_column_kzg_proofs(
+        &ok, CELLS_PER_EXT_BLOB, &commitment, &cell, &proof, 1, &s
+    );
+    ASSERT_EQUALS(ret, C_KZG_BADARGS);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tests for verify_blob_cell_kzg_proofs
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void test_verify_blob_cell_kzg_proofs__succeeds_random_blob(void) {
+    C_KZG_RET ret;
+    Blob blob;
+    Bytes48 commitment;
+    Cell *cells = NULL;
+    KZGProof *proofs = NULL;
+    bool ok;
+
+    ret = c_kzg_calloc((void **)&cells, CELLS_PER_EXT_BLOB, sizeof(Cell));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = c_kzg_calloc((void **)&proofs, CELLS_PER_EXT_BLOB, sizeof(KZGProof));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    get_rand_blob(&blob);
+    ret = blob_to_kzg_commitment(&commitment, &blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = compute_cells_and_kzg_proofs(cells, proofs, &blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    /* From the blob */
+    ret = verify_blob_cell_kzg_proofs(&ok, &blob, NULL, &commitment, proofs, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, true);
+
+    /* From the cells */
+    ret = verify_blob_cell_kzg_proofs(&ok, NULL, cells, &commitment, proofs, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, true);
+
+    c_kzg_free(cells);
+    c_kzg_free(proofs);
+}
+
+static void test_verify_blob_cell_kzg_proofs__fails_with_incorrect_data(void) {
+    C_KZG_RET ret;
+    Blob blob, other_blob;
+    Bytes48 commitment, other_commitment, proof;
+    Cell *cells = NULL;
+    KZGProof *proofs = NULL;
+    bool ok;
+
+    ret = c_kzg_calloc((void **)&cells, CELLS_PER_EXT_BLOB, sizeof(Cell));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = c_kzg_calloc((void **)&proofs, CELLS_PER_EXT_BLOB, sizeof(KZGProof));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    get_rand_blob(&blob);
+    ret = blob_to_kzg_commitment(&commitment, &blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = compute_cells_and_kzg_proofs(cells, proofs, &blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    /* The wrong commitment */
+    get_rand_blob(&other_blob);
+    ret = blob_to_kzg_commitment(&other_commitment, &other_blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = verify_blob_cell_kzg_proofs(&ok, &blob, NULL, &other_commitment, proofs, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, false);
+
+    /* The wrong blob */
+    ret = verify_blob_cell_kzg_proofs(&ok, &other_blob, NULL, &commitment, proofs, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, false);
+
+    /* A modified cell in the last half of the row */
+    get_rand_field_element((Bytes32 *)&cells[100].bytes[0]);
+    ret = verify_blob_cell_kzg_proofs(&ok, NULL, cells, &commitment, proofs, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, false);
+
+    /* Swapped proofs */
+    ret = compute_cells_and_kzg_proofs(cells, NULL, &blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    proof = proofs[3];
+    proofs[3] = proofs[4];
+    proofs[4] = proof;
+    ret = verify_blob_cell_kzg_proofs(&ok, NULL, cells, &commitment, proofs, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, false);
+
+    c_kzg_free(cells);
+    c_kzg_free(proofs);
+}
+
+static void test_verify_blob_cell_kzg_proofs__fails_blob_and_cells(void) {
+    C_KZG_RET ret;
+    Blob blob;
+    Bytes48 commitment;
+    Cell *cells = NULL;
+    KZGProof *proofs = NULL;
+    bool ok;
+
+    ret = c_kzg_calloc((void **)&cells, CELLS_PER_EXT_BLOB, sizeof(Cell));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = c_kzg_calloc((void **)&proofs, CELLS_PER_EXT_BLOB, sizeof(KZGProof));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    get_rand_blob(&blob);
+    ret = blob_to_kzg_commitment(&commitment, &blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = compute_cells_and_kzg_proofs(cells, proofs, &blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    /* Exactly one of blob and cells must be given */
+    ret = verify_blob_cell_kzg_proofs(&ok, &blob, cells, &commitment, proofs, &s);
+    ASSERT_EQUALS(ret, C_KZG_BADARGS);
+    ret = verify_blob_cell_kzg_proofs(&ok, NULL, NULL, &commitment, proofs, &s);
+    ASSERT_EQUALS(ret, C_KZG_BADARGS);
+
+    c_kzg_free(cells);
+    c_kzg_free(proofs);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tests for verify_cell_kzg_proof_single
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void test_verify_cell_kzg_proof_single__succeeds_with_and_without_lines(void) {
+    C_KZG_RET ret;
+    Blob blob;
+    Bytes48 commitment;
+    Cell *cells = NULL;
+    KZGProof *proofs = NULL;
+    uint64_t sampled[] = {0, 1, 63, 64, 127};
+    bool ok;
+
+    ret = c_kzg_calloc((void **)&cells, CELLS_PER_EXT_BLOB, sizeof(Cell));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = c_kzg_calloc((void **)&proofs, CELLS_PER_EXT_BLOB, sizeof(KZGProof));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    get_rand_blob(&blob);
+    ret = blob_to_kzg_commitment(&commitment, &blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = compute_cells_and_kzg_proofs(cells, proofs, &blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    /* The settings start out without the prepared lines */
+    if (s.cell_g2_lines == NULL) {
+        for (size_t i = 0; i < sizeof(sampled) / sizeof(sampled[0]); i++) {
+            uint64_t k = sampled[i];
+            ret = verify_cell_kzg_proof_single(&ok, &commitment, k, &cells[k], &proofs[k], &s);
+            ASSERT_EQUALS(ret, C_KZG_OK);
+            ASSERT_EQUALS(ok, true);
+        }
+    }
+
+    ret = precompute_cell_g2_lines(&s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT("lines are set", s.cell_g2_lines != NULL);
+
+    /* Doing it again is a no-op */
+    ret = precompute_cell_g2_lines(&s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    for (size_t i = 0; i < sizeof(sampled) / sizeof(sampled[0]); i++) {
+        uint64_t k = sampled[i];
+        ret = verify_cell_kzg_proof_single(&ok, &commitment, k, &cells[k], &proofs[k], &s);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+        ASSERT_EQUALS(ok, true);
+    }
+
+    c_kzg_free(cells);
+    c_kzg_free(proofs);
+}
+
+static void test_verify_cell_kzg_proof_single__fails_with_incorrect_inputs(void) {
+    C_KZG_RET ret;
+    Blob blob;
+    Bytes48 commitment;
+    Cell *cells = NULL;
+    KZGProof *proofs = NULL;
+    bool ok;
+
+    ret = c_kzg_calloc((void **)&cells, CELLS_PER_EXT_BLOB, sizeof(Cell));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = c_kzg_calloc((void **)&proofs, CELLS_PER_EXT_BLOB, sizeof(KZGProof));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    get_rand_blob(&blob);
+    ret = blob_to_kzg_commitment(&commitment, &blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = compute_cells_and_kzg_proofs(cells, proofs, &blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    /* The wrong cell index */
+    ret = verify_cell_kzg_proof_single(&ok, &commitment, 11, &cells[10], &proofs[10], &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, false);
+
+    /* The wrong proof */
+    ret = verify_cell_kzg_proof_single(&ok, &commitment, 10, &cells[10], &proofs[11], &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, false);
+
+    /* A modified cell */
+    get_rand_field_element((Bytes32 *)&cells[10].bytes[0]);
+    ret = verify_cell_kzg_proof_single(&ok, &commitment, 10, &cells[10], &proofs[10], &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, false);
+
+    /* The cell index is out of range */
+    ret = verify_cell_kzg_proof_single(
+        &ok, &commitment, CELLS_PER_EXT_BLOB, &cells[10], &proofs[10], &s
+    );
+    ASSERT_EQUALS(ret, C_KZG_BADARGS);
+
+    c_kzg_free(cells);
+    c_kzg_free(proofs);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tests for CellVerifyAccumulator
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void test_cell_verify_accumulator__succeeds_and_is_reusable(void) {
+    C_KZG_RET ret;
+    Blob blobs[2];
+    Bytes48 commitments[2];
+    Bytes32 seed;
+    Cell *cells = NULL;
+    KZGProof *proofs = NULL;
+    CellVerifyAccumulator acc;
+    bool ok;
+
+    ret = c_kzg_calloc((void **)&cells, 2 * CELLS_PER_EXT_BLOB, sizeof(Cell));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = c_kzg_calloc((void **)&proofs, 2 * CELLS_PER_EXT_BLOB, sizeof(KZGProof));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    for (size_t i = 0; i < 2; i++) {
+        get_rand_blob(&blobs[i]);
+        ret = blob_to_kzg_commitment(&commitments[i], &blobs[i], &s);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+        ret = compute_cells_and_kzg_proofs(
+            &cells[i * CELLS_PER_EXT_BLOB], &proofs[i * CELLS_PER_EXT_BLOB], &blobs[i], &s
+        );
+        ASSERT_EQUALS(ret, C_KZG_OK);
+    }
+
+    get_rand_bytes32(&seed);
+    ret = cell_verify_accumulator_init(&acc, &seed);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    /* Nothing absorbed is trivially valid */
+    ret = cell_verify_accumulator_finalize(&ok, &acc, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, true);
+
+    /* More than one chunk, with columns shared by both blobs */
+    for (size_t round = 0; round < 2; round++) {
+        for (size_t k = 0; k < 70; k++) {
+            size_t blob_index = k % 2;
+            size_t cell_index = (k * 7 + round) % CELLS_PER_EXT_BLOB;
+            size_t i = blob_index * CELLS_PER_EXT_BLOB + cell_index;
+            ret = cell_verify_accumulator_add(
+                &acc, &commitments[blob_index], cell_index, &cells[i], &proofs[i], &s
+            );
+            ASSERT_EQUALS(ret, C_KZG_OK);
+        }
+        ret = cell_verify_accumulator_finalize(&ok, &acc, &s);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+        ASSERT_EQUALS(ok, true);
+    }
+
+    cell_verify_accumulator_free(&acc);
+    c_kzg_free(cells);
+    c_kzg_free(proofs);
+}
+
+static void test_cell_verify_accumulator__fails_with_incorrect_proof(void) {
+    C_KZG_RET ret;
+    Blob blob;
+    Bytes48 commitment;
+    Bytes32 seed;
+    Cell *cells = NULL;
+    KZGProof *proofs = NULL;
+    CellVerifyAccumulator acc;
+    bool ok;
+
+    ret = c_kzg_calloc((void **)&cells, CELLS_PER_EXT_BLOB, sizeof(Cell));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = c_kzg_calloc((void **)&proofs, CELLS_PER_EXT_BLOB, sizeof(KZGProof));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    get_rand_blob(&blob);
+    ret = blob_to_kzg_commitment(&commitment, &blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = compute_cells_and_kzg_proofs(cells, proofs, &blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    get_rand_bytes32(&seed);
+    ret = cell_verify_accumulator_init(&acc, &seed);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    /* One wrong proof among many */
+    for (size_t k = 0; k < 80; k++) {
+        size_t proof_index = k == 42 ? 43 : k;
+        ret = cell_verify_accumulator_add(
+            &acc, &commitment, k, &cells[k], &proofs[proof_index], &s
+        );
+        ASSERT_EQUALS(ret, C_KZG_OK);
+    }
+    ret = cell_verify_accumulator_finalize(&ok, &acc, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, false);
+
+    /* The accumulator is emptied after a failure */
+    ret = cell_verify_accumulator_add(&acc, &commitment, 5, &cells[5], &proofs[5], &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = cell_verify_accumulator_finalize(&ok, &acc, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, true);
+
+    cell_verify_accumulator_free(&acc);
+    c_kzg_free(cells);
+    c_kzg_free(proofs);
+}
+
+static void test_cell_verify_accumulator__bad_input_leaves_state_unchanged(void) {
+    C_KZG_RET ret;
+    Blob blob;
+    Bytes48 commitment, bad_proof;
+    Bytes32 seed;
+    Cell *cells = NULL;
+    KZGProof *proofs = NULL;
+    CellVerifyAccumulator acc;
+    bool ok;
+
+    ret = c_kzg_calloc((void **)&cells, CELLS_PER_EXT_BLOB, sizeof(Cell));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = c_kzg_calloc((void **)&proofs, CELLS_PER_EXT_BLOB, sizeof(KZGProof));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    get_rand_blob(&blob);
+    ret = blob_to_kzg_commitment(&commitment, &blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = compute_cells_and_kzg_proofs(cells, proofs, &blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    get_rand_bytes32(&seed);
+    ret = cell_verify_accumulator_init(&acc, &seed);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    for (size_t k = 0; k < 3; k++) {
+        ret = cell_verify_accumulator_add(&acc, &commitment, k, &cells[k], &proofs[k], &s);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+    }
+
+    /* The cell index is out of range */
+    ret = cell_verify_accumulator_add(
+        &acc, &commitment, CELLS_PER_EXT_BLOB, &cells[3], &proofs[3], &s
+    );
+    ASSERT_EQUALS(ret, C_KZG_BADARGS);
+
+    /* The proof is not a valid point */
+    bad_proof = proofs[3];
+    bad_proof.bytes[0] ^= 0x01;
+    ret = cell_verify_accumulator_add(&acc, &commitment, 3, &cells[3], &bad_proof, &s);
+    ASSERT_EQUALS(ret, C_KZG_BADARGS);
+
+    ASSERT_EQUALS(acc.num_cells, 3);
+    ret = cell_verify_accumulator_finalize(&ok, &acc, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, true);
+
+    cell_verify_accumulator_free(&acc);
+    c_kzg_free(cells);
+    c_kzg_free(proofs);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tests for UnifiedVerifyAccumulator
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void test_unified_verify_accumulator__succeeds_and_is_reusable(void) {
+    C_KZG_RET ret;
+    Blob blobs[3];
+    Bytes48 commitments[3], blob_proofs[3];
+    Bytes32 seed;
+    Cell *cells = NULL;
+    KZGProof *proofs = NULL;
+    UnifiedVerifyAccumulator acc;
+    bool ok;
+
+    ret = c_kzg_calloc((void **)&cells, CELLS_PER_EXT_BLOB, sizeof(Cell));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = c_kzg_calloc((void **)&proofs, CELLS_PER_EXT_BLOB, sizeof(KZGProof));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    for (size_t i = 0; i < 3; i++) {
+        get_rand_blob(&blobs[i]);
+        ret = blob_to_kzg_commitment(&commitments[i], &blobs[i], &s);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+        ret = compute_blob_kzg_proof(&blob_proofs[i], &blobs[i], &commitments[i], &s);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+    }
+    ret = compute_cells_and_kzg_proofs(cells, proofs, &blobs[0], &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    get_rand_bytes32(&seed);
+    ret = unified_verify_accumulator_init(&acc, &seed);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    /* Nothing absorbed is trivially valid */
+    ret = unified_verify_accumulator_finalize(&ok, &acc, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, true);
+
+    /* Blob proofs and cell proofs together */
+    for (size_t i = 0; i < 3; i++) {
+        ret = unified_verify_accumulator_add_blob(
+            &acc, &blobs[i], &commitments[i], &blob_proofs[i], &s
+        );
+        ASSERT_EQUALS(ret, C_KZG_OK);
+    }
+    for (size_t k = 0; k < 70; k++) {
+        ret = unified_verify_accumulator_add_cell(
+            &acc, &commitments[0], k, &cells[k], &proofs[k], &s
+        );
+        ASSERT_EQUALS(ret, C_KZG_OK);
+    }
+    ret = unified_verify_accumulator_finalize(&ok, &acc, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, true);
+
+    /* Only blob proofs */
+    ret = unified_verify_accumulator_add_blob(
+        &acc, &blobs[1], &commitments[1], &blob_proofs[1], &s
+    );
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = unified_verify_accumulator_finalize(&ok, &acc, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, true);
+
+    /* Only cell proofs */
+    ret = unified_verify_accumulator_add_cell(&acc, &commitments[0], 9, &cells[9], &proofs[9], &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = unified_verify_accumulator_finalize(&ok, &acc, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, true);
+
+    unified_verify_accumulator_free(&acc);
+    c_kzg_free(cells);
+    c_kzg_free(proofs);
+}
+
+static void test_unified_verify_accumulator__fails_with_incorrect_proof(void) {
+    C_KZG_RET ret;
+    Blob blobs[2];
+    Bytes48 commitments[2], blob_proofs[2];
+    Bytes32 seed;
+    Cell *cells = NULL;
+    KZGProof *proofs = NULL;
+    UnifiedVerifyAccumulator acc;
+    bool ok;
+
+    ret = c_kzg_calloc((void **)&cells, CELLS_PER_EXT_BLOB, sizeof(Cell));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = c_kzg_calloc((void **)&proofs, CELLS_PER_EXT_BLOB, sizeof(KZGProof));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    for (size_t i = 0; i < 2; i++) {
+        get_rand_blob(&blobs[i]);
+        ret = blob_to_kzg_commitment(&commitments[i], &blobs[i], &s);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+        ret = compute_blob_kzg_proof(&blob_proofs[i], &blobs[i], &commitments[i], &s);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+    }
+    ret = compute_cells_and_kzg_proofs(cells, proofs, &blobs[0], &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    get_rand_bytes32(&seed);
+    ret = unified_verify_accumulator_init(&acc, &seed);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    /* A swapped blob proof, with valid cell proofs */
+    ret = unified_verify_accumulator_add_blob(
+        &acc, &blobs[0], &commitments[0], &blob_proofs[1], &s
+    );
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = unified_verify_accumulator_add_cell(&acc, &commitments[0], 3, &cells[3], &proofs[3], &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = unified_verify_accumulator_finalize(&ok, &acc, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, false);
+
+    /* A swapped cell proof, with valid blob proofs */
+    ret = unified_verify_accumulator_add_blob(
+        &acc, &blobs[0], &commitments[0], &blob_proofs[0], &s
+    );
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = unified_verify_accumulator_add_cell(&acc, &commitments[0], 3, &cells[3], &proofs[4], &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = unified_verify_accumulator_finalize(&ok, &acc, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, false);
+
+    /* The blob holds a field element that is not canonical */
+    memset(blobs[1].bytes, 0xff, BYTES_PER_FIELD_ELEMENT);
+    ret = unified_verify_accumulator_add_blob(
+        &acc, &blobs[1], &commitments[1], &blob_proofs[1], &s
     );
+    ASSERT_EQUALS(ret, C_KZG_BADARGS);
+    ret = unified_verify_accumulator_finalize(&ok, &acc, &s);
     ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, true);
 
-    /* Check that all of the cells match */
-    for (size_t i = 0; i < CELLS_PER_EXT_BLOB; i++) {
-        diff = memcmp(&cells[i], &recovered_cells[i], sizeof(Cell));
-        ASSERT_EQUALS(diff, 0);
-        diff = memcmp(&proofs[i], &recovered_proofs[i], sizeof(KZGProof));
-        ASSERT_EQUALS(diff, 0);
-    }
+    unified_verify_accumulator_free(&acc);
+    c_kzg_free(cells);
+    c_kzg_free(proofs);
 }
 
-static void test_compute_vanishing_polynomial_from_roots(void) {
-    /*
-     * Test case: (x - 2)(x - 3)
-     *
-     * Expected result: x^2 - 5x + 6
-     */
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tests for KZGCommitmentHandle and KZGProofHandle
+////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    /* Initialize array with the roots 2 and 3 */
-    fr_t roots[2];
-    fr_from_uint64(&roots[0], 2);
-    fr_from_uint64(&roots[1], 3);
-    size_t roots_len = 2;
+static void test_kzg_handle_from_bytes__validates_point(void) {
+    C_KZG_RET ret;
+    Bytes48 g1_bytes, round_trip;
+    KZGCommitmentHandle commitment;
+    KZGProofHandle proof;
 
-    fr_t poly[3];
-    size_t poly_len = 3;
+    get_rand_g1_bytes(&g1_bytes);
+    ret = kzg_commitment_handle_from_bytes(&commitment, &g1_bytes);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    blst_p1_affine_compress(round_trip.bytes, &commitment.point);
+    ASSERT_EQUALS(memcmp(round_trip.bytes, g1_bytes.bytes, sizeof(Bytes48)), 0);
 
-    compute_vanishing_polynomial_from_roots(poly, &poly_len, roots, roots_len);
+    /* The point at infinity is accepted */
+    memset(g1_bytes.bytes, 0, sizeof(Bytes48));
+    g1_bytes.bytes[0] = 0xc0;
+    ret = kzg_proof_handle_from_bytes(&proof, &g1_bytes);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT("is infinity", blst_p1_affine_is_inf(&proof.point));
 
-    fr_t expected[3];
+    /* A point that is not in G1 is rejected */
+    bytes48_from_hex(
+        &g1_bytes,
+        "8123456789abcdef0123456789abcdef0123456789abcdef"
+        "0123456789abcdef0123456789abcdef0123456789abcdef"
+    );
+    ret = kzg_commitment_handle_from_bytes(&commitment, &g1_bytes);
+    ASSERT_EQUALS(ret, C_KZG_BADARGS);
+    ret = kzg_proof_handle_from_bytes(&proof, &g1_bytes);
+    ASSERT_EQUALS(ret, C_KZG_BADARGS);
+}
 
-    fr_from_uint64(&expected[0], 6);
+static void test_verify_blob_kzg_proof_batch_with_handles__matches_bytes(void) {
+    C_KZG_RET ret;
+    Blob blobs[3];
+    Bytes48 commitments_bytes[3], proofs_bytes[3];
+    KZGCommitmentHandle commitments[3];
+    KZGProofHandle proofs[3], proof;
+    Bytes32 z, y;
+    bool ok;
 
-    /* Negate 5 */
-    fr_from_uint64(&expected[1], 5);
-    blst_fr_cneg(&expected[1], &expected[1], true);
+    for (size_t i = 0; i < 3; i++) {
+        get_rand_blob(&blobs[i]);
+        ret = blob_to_kzg_commitment(&commitments_bytes[i], &blobs[i], &s);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+        ret = compute_blob_kzg_proof(&proofs_bytes[i], &blobs[i], &commitments_bytes[i], &s);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+        ret = kzg_commitment_handle_from_bytes(&commitments[i], &commitments_bytes[i]);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+        ret = kzg_proof_handle_from_bytes(&proofs[i], &proofs_bytes[i]);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+    }
 
-    expected[2] = FR_ONE;
+    ret = verify_blob_kzg_proof_with_handles(&ok, &blobs[0], &commitments[0], &proofs[0], &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, true);
+    ret = verify_blob_kzg_proof_batch_with_handles(&ok, blobs, commitments, proofs, 3, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, true);
 
-    ASSERT("polynomial length is 3", poly_len == 3);
-    ASSERT("coefficient 0 are equal", fr_equal(&poly[0], &expected[0]));
-    ASSERT("coefficient 1 are equal", fr_equal(&poly[1], &expected[1]));
-    ASSERT("coefficient 2 are equal", fr_equal(&poly[2], &expected[2]));
+    /* A point evaluation proof */
+    get_rand_field_element(&z);
+    ret = compute_kzg_proof(&proofs_bytes[0], &y, &blobs[0], &z, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = kzg_proof_handle_from_bytes(&proof, &proofs_bytes[0]);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = verify_kzg_proof_with_handles(&ok, &commitments[0], &z, &y, &proof, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, true);
+    ret = verify_kzg_proof_with_handles(&ok, &commitments[1], &z, &y, &proof, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, false);
+
+    /* Swapped proofs */
+    proof = proofs[1];
+    proofs[1] = proofs[2];
+    proofs[2] = proof;
+    ret = verify_blob_kzg_proof_batch_with_handles(&ok, blobs, commitments, proofs, 3, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, false);
+    ret = verify_blob_kzg_proof_with_handles(&ok, &blobs[1], &commitments[1], &proofs[1], &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, false);
 }
 
-static void test_vanishing_polynomial_for_missing_cells(void) {
+static void test_verify_cell_kzg_proof_batch_with_handles__matches_bytes(void) {
     C_KZG_RET ret;
+    Blob blob;
+    Bytes48 commitment_bytes;
+    KZGCommitmentHandle commitment_handle;
+    Cell *cells = NULL;
+    KZGProof *proofs = NULL;
+    KZGCommitmentHandle *commitments = NULL;
+    KZGProofHandle *proof_handles = NULL;
+    uint64_t *cell_indices = NULL;
+    bool ok;
 
-    fr_t vanishing_poly[FIELD_ELEMENTS_PER_EXT_BLOB];
-    fr_t fft_result[FIELD_ELEMENTS_PER_EXT_BLOB];
+    ret = c_kzg_calloc((void **)&cells, CELLS_PER_EXT_BLOB, sizeof(Cell));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = c_kzg_calloc((void **)&proofs, CELLS_PER_EXT_BLOB, sizeof(KZGProof));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = c_kzg_calloc((void **)&commitments, CELLS_PER_EXT_BLOB, sizeof(KZGCommitmentHandle));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = c_kzg_calloc((void **)&proof_handles, CELLS_PER_EXT_BLOB, sizeof(KZGProofHandle));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = c_kzg_calloc((void **)&cell_indices, CELLS_PER_EXT_BLOB, sizeof(uint64_t));
+    ASSERT_EQUALS(ret, C_KZG_OK);
 
-    /* Test case: the 0th and 1st cell are missing */
-    uint64_t missing_cell_indices[] = {0, 1};
-    size_t len_missing_cells = 2;
+    get_rand_blob(&blob);
+    ret = blob_to_kzg_commitment(&commitment_bytes, &blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = compute_cells_and_kzg_proofs(cells, proofs, &blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
 
-    ret = vanishing_polynomial_for_missing_cells(
-        vanishing_poly, missing_cell_indices, len_missing_cells, &s
+    /* The commitment is validated once and shared by every cell */
+    ret = kzg_commitment_handle_from_bytes(&commitment_handle, &commitment_bytes);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    for (size_t i = 0; i < CELLS_PER_EXT_BLOB; i++) {
+        commitments[i] = commitment_handle;
+        cell_indices[i] = i;
+        ret = kzg_proof_handle_from_bytes(&proof_handles[i], &proofs[i]);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+    }
+
+    ret = verify_cell_kzg_proof_batch_with_handles(
+        &ok, commitments, cell_indices, cells, proof_handles, CELLS_PER_EXT_BLOB, &s
     );
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, true);
 
-    /* Check return status */
-    ASSERT("compute vanishing poly from cells", ret == C_KZG_OK);
+    /* The wrong proof */
+    proof_handles[7] = proof_handles[8];
+    ret = verify_cell_kzg_proof_batch_with_handles(
+        &ok, commitments, cell_indices, cells, proof_handles, CELLS_PER_EXT_BLOB, &s
+    );
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, false);
 
-    /* Compute FFT of vanishing_poly */
-    fr_fft(fft_result, vanishing_poly, FIELD_ELEMENTS_PER_EXT_BLOB, &s);
+    /* The cell index is out of range */
+    cell_indices[0] = CELLS_PER_EXT_BLOB;
+    ret = verify_cell_kzg_proof_batch_with_handles(
+        &ok, commitments, cell_indices, cells, proof_handles, CELLS_PER_EXT_BLOB, &s
+    );
+    ASSERT_EQUALS(ret, C_KZG_BADARGS);
 
-    /*
-     * Check FFT results
-     *
-     * Let explain how we are picking the roots of unity:
-     * Focussing just on the missing cell index 0.
-     *
-     * We expect that the following roots will evaluate to zero on the vanishing polynomial we
-     * computed:
-     *
-     * s->roots_of_unity[0]
-     * s->roots_of_unity[128]
-     * s->roots_of_unity[256]
-     * ...
-     * s->roots_of_unity[8064]
-     *
-     * For every cell index, we should have `FIELD_ELEMENTS_PER_CELL` number of these roots. ie each
-     * cell index corresponds to 64 roots taken from `roots_of_unity` in the vanishing
-     * polynomial.
-     *
-     * In general, the formula is roots_of_unity[cell_index + CELLS_PER_EXT_BLOB * k] where
-     * `k` goes from 0 to FIELD_ELEMENTS_PER_CELL-1.
-     *
-     * For cell index 1, we would therefore expect the polynomial to vanish at points:
-     *
-     * s->roots_of_unity[1]
-     * s->roots_of_unity[129]
-     * s->roots_of_unity[257]
-     * ...
-     * s->roots_of_unity[8065]
-     *
-     * Sanity check:
-     * The largest cell index we can have is 127 since there are 128 cells.
-     *
-     * The last element for that cell index would have array index `127 + 128*63 = 8191`. This is
-     * correct since `roots_of_unity` has 8192 elements.
-     */
-    for (size_t i = 0; i < FIELD_ELEMENTS_PER_EXT_BLOB; i++) {
-        if (i % CELLS_PER_EXT_BLOB == 1 || i % CELLS_PER_EXT_BLOB == 0) {
-            /* Every CELLS_PER_EXT_BLOB-th evaluation should be zero */
-            ASSERT("evaluation is zero", fr_is_zero(&fft_result[i]));
-        } else {
-            ASSERT("evaluation is not zero", !fr_is_zero(&fft_result[i]));
-        }
-    }
+    c_kzg_free(cells);
+    c_kzg_free(proofs);
+    c_kzg_free(commitments);
+    c_kzg_free(proof_handles);
+    c_kzg_free(cell_indices);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-// Tests for verify_cell_kzg_proof_batch
+// Tests for VerifyCache
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-static void test_verify_cell_kzg_proof_batch__succeeds_random_blob(void) {
+static void test_verify_cache__insert_and_evict(void) {
+    C_KZG_RET ret;
+    VerifyCache cache;
+    Bytes32 keys[3 * VERIFY_CACHE_WAYS];
+    bool hits[3 * VERIFY_CACHE_WAYS];
+    size_t num_hits = 0;
+
+    ret = verify_cache_init(&cache, 0);
+    ASSERT_EQUALS(ret, C_KZG_BADARGS);
+
+    ret = verify_cache_init(&cache, 2 * VERIFY_CACHE_WAYS);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(cache.num_sets, 2);
+
+    for (size_t i = 0; i < 3 * VERIFY_CACHE_WAYS; i++) {
+        get_rand_bytes32(&keys[i]);
+    }
+    verify_cache_contains_many(&cache, hits, keys, 3 * VERIFY_CACHE_WAYS);
+    for (size_t i = 0; i < 3 * VERIFY_CACHE_WAYS; i++) {
+        ASSERT_EQUALS(hits[i], false);
+    }
+
+    /* The last key inserted is always held */
+    verify_cache_insert_many(&cache, keys, 3 * VERIFY_CACHE_WAYS);
+    verify_cache_contains_many(&cache, hits, keys, 3 * VERIFY_CACHE_WAYS);
+    ASSERT_EQUALS(hits[3 * VERIFY_CACHE_WAYS - 1], true);
+
+    /* But no more keys than the capacity are */
+    for (size_t i = 0; i < 3 * VERIFY_CACHE_WAYS; i++) {
+        if (hits[i]) num_hits++;
+    }
+    ASSERT("bounded", num_hits <= 2 * VERIFY_CACHE_WAYS);
+
+    verify_cache_free(&cache);
+}
+
+static void test_verify_cache__skips_verified_proofs(void) {
     C_KZG_RET ret;
+    KZGSettings cached_s = s;
+    Blob blobs[2];
+    Bytes48 commitments[2], proofs[2];
+    Bytes32 key;
+    Cell *cells = NULL;
+    KZGProof *cell_proofs = NULL;
+    Bytes48 cell_commitments[3];
+    uint64_t cell_indices[3] = {0, 5, 100};
+    Cell sampled_cells[3];
+    Bytes48 sampled_proofs[3];
     bool ok;
-    Blob blob;
-    KZGCommitment commitment;
-    Bytes48 commitments[CELLS_PER_EXT_BLOB];
-    uint64_t cell_indices[CELLS_PER_EXT_BLOB];
-    Cell cells[CELLS_PER_EXT_BLOB];
-    KZGProof proofs[CELLS_PER_EXT_BLOB];
 
-    /* Get a random blob */
-    get_rand_blob(&blob);
+    ret = c_kzg_calloc((void **)&cells, CELLS_PER_EXT_BLOB, sizeof(Cell));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = c_kzg_calloc((void **)&cell_proofs, CELLS_PER_EXT_BLOB, sizeof(KZGProof));
+    ASSERT_EQUALS(ret, C_KZG_OK);
 
-    /* Get the commitment to the blob */
-    ret = blob_to_kzg_commitment(&commitment, &blob, &s);
+    /* Use a copy of the settings, so that the other tests do not see the cache */
+    cached_s.verify_cache = NULL;
+    ret = enable_verify_cache(&cached_s, 64);
     ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT("cache is set", cached_s.verify_cache != NULL);
 
-    /* Compute cells and proofs */
-    ret = compute_cells_and_kzg_proofs(cells, proofs, &blob, &s);
+    for (size_t i = 0; i < 2; i++) {
+        get_rand_blob(&blobs[i]);
+        ret = blob_to_kzg_commitment(&commitments[i], &blobs[i], &s);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+        ret = compute_blob_kzg_proof(&proofs[i], &blobs[i], &commitments[i], &s);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+    }
+
+    /* Verifying twice gives the same answer */
+    for (size_t round = 0; round < 2; round++) {
+        ret = verify_blob_kzg_proof_batch(&ok, blobs, commitments, proofs, 2, &cached_s);
+        ASSERT_EQUALS(ret, C_KZG_OK);
+        ASSERT_EQUALS(ok, true);
+    }
+
+    /* An accepted proof is remembered */
+    compute_verify_cache_key(
+        &key,
+        VERIFY_CACHE_DOMAIN_BLOB_KZG_PROOF,
+        &commitments[0],
+        0,
+        blobs[0].bytes,
+        BYTES_PER_BLOB,
+        &proofs[0]
+    );
+    verify_cache_contains_many(cached_s.verify_cache, &ok, &key, 1);
+    ASSERT_EQUALS(ok, true);
+
+    /* A rejected proof is not */
+    proofs[0] = proofs[1];
+    ret = verify_blob_kzg_proof_batch(&ok, blobs, commitments, proofs, 2, &cached_s);
     ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, false);
+    ret = verify_blob_kzg_proof_batch(&ok, blobs, commitments, proofs, 2, &cached_s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, false);
 
-    /* Initialize list of commitments & cell indices */
-    for (size_t i = 0; i < CELLS_PER_EXT_BLOB; i++) {
-        memcpy(commitments[i].bytes, &commitment, BYTES_PER_COMMITMENT);
-        cell_indices[i] = i;
+    /* Cell proofs, including a repeated one */
+    ret = compute_cells_and_kzg_proofs(cells, cell_proofs, &blobs[0], &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    for (size_t i = 0; i < 3; i++) {
+        cell_commitments[i] = commitments[0];
+        sampled_cells[i] = cells[cell_indices[i]];
+        sampled_proofs[i] = cell_proofs[cell_indices[i]];
     }
+    ret = verify_cell_kzg_proof_batch(
+        &ok, cell_commitments, cell_indices, sampled_cells, sampled_proofs, 2, &cached_s
+    );
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, true);
+    ret = verify_cell_kzg_proof_batch(
+        &ok, cell_commitments, cell_indices, sampled_cells, sampled_proofs, 3, &cached_s
+    );
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, true);
 
-    /* Verify all the proofs */
+    /* A wrong cell proof is still caught next to cached ones */
+    sampled_proofs[2] = cell_proofs[101];
     ret = verify_cell_kzg_proof_batch(
-        &ok, commitments, cell_indices, cells, proofs, CELLS_PER_EXT_BLOB, &s
+        &ok, cell_commitments, cell_indices, sampled_cells, sampled_proofs, 3, &cached_s
     );
     ASSERT_EQUALS(ret, C_KZG_OK);
+    ASSERT_EQUALS(ok, false);
+
+    verify_cache_free(cached_s.verify_cache);
+    c_kzg_free(cached_s.verify_cache);
+    c_kzg_free(cells);
+    c_kzg_free(cell_proofs);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2225,6 +3719,79 @@ static void profile_verify_cell_kzg_proof_batch(void) {
     }
     ProfilerStop();
 }
+
+static void profile_verify_blob_cell_kzg_proofs(void) {
+    C_KZG_RET ret;
+    bool ok;
+    Blob blob;
+    KZGCommitment commitment;
+    Cell cells[CELLS_PER_EXT_BLOB];
+    KZGProof proofs[CELLS_PER_EXT_BLOB];
+
+    /* Get a random blob */
+    get_rand_blob(&blob);
+
+    /* Get the commitment to the blob */
+    ret = blob_to_kzg_commitment(&commitment, &blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    /* Compute cells and proofs */
+    ret = compute_cells_and_kzg_proofs(cells, proofs, &blob, &s);
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    ProfilerStart("verify_blob_cell_kzg_proofs.prof");
+    for (size_t i = 0; i < 100; i++) {
+        verify_blob_cell_kzg_proofs(&ok, NULL, cells, &commitment, proofs, &s);
+    }
+    ProfilerStop();
+}
+
+static void profile_deduplicate_commitments(void) {
+    /* Every size deduplicates the same total number of commitments, so profiles are comparable */
+    const size_t sizes[] = {1024, 8192, 65536};
+    const size_t total = 1 << 20;
+    Bytes48 *originals = NULL;
+    Bytes48 *commitments = NULL;
+    uint64_t *indices = NULL;
+    char filename[64];
+    C_KZG_RET ret;
+
+    ret = c_kzg_calloc((void **)&originals, 65536, sizeof(Bytes48));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = c_kzg_calloc((void **)&commitments, 65536, sizeof(Bytes48));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+    ret = c_kzg_calloc((void **)&indices, 65536, sizeof(uint64_t));
+    ASSERT_EQUALS(ret, C_KZG_OK);
+
+    /* Like several columns from the same blobs, each commitment appears once per column */
+    for (size_t i = 0; i < 65536; i++) {
+        if (i % 8 == 0) {
+            Bytes32 b;
+            get_rand_bytes32(&b);
+            memcpy(&originals[i].bytes[0], b.bytes, 32);
+            get_rand_bytes32(&b);
+            memcpy(&originals[i].bytes[32], b.bytes, 16);
+        } else {
+            originals[i] = originals[i - i % 8];
+        }
+    }
+
+    for (size_t j = 0; j < sizeof(sizes) / sizeof(sizes[0]); j++) {
+        size_t n = sizes[j];
+        snprintf(filename, sizeof(filename), "deduplicate_commitments_%zu.prof", n);
+        ProfilerStart(filename);
+        for (size_t i = 0; i < total / n; i++) {
+            size_t count = n;
+            memcpy(commitments, originals, n * sizeof(Bytes48));
+            deduplicate_commitments(commitments, indices, &count);
+        }
+        ProfilerStop();
+    }
+
+    c_kzg_free(originals);
+    c_kzg_free(commitments);
+    c_kzg_free(indices);
+}
 #endif /* PROFILE */
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2270,13 +3837,18 @@ int main(void) {
     RUN(test_g1_mul__test_consistent);
     RUN(test_g1_mul__test_scalar_is_zero);
     RUN(test_g1_mul__test_different_bit_lengths);
+    RUN(test_g1_mul_fixed_base__test_consistent);
+    RUN(test_g1_mul_fixed_base__test_scalar_is_zero);
+    RUN(test_g1_mul_fixed_base__test_max_scalar);
     RUN(test_pairings_verify__good_pairing);
     RUN(test_pairings_verify__bad_pairing);
+    RUN(test_pairings_product_is_one__three_pairings);
     RUN(test_blob_to_kzg_commitment__succeeds_x_less_than_modulus);
     RUN(test_blob_to_kzg_commitment__fails_x_equal_to_modulus);
     RUN(test_blob_to_kzg_commitment__fails_x_greater_than_modulus);
     RUN(test_blob_to_kzg_commitment__succeeds_point_at_infinity);
     RUN(test_blob_to_kzg_commitment__succeeds_expected_commitment);
+    RUN(test_blob_to_kzg_commitments__matches_single_calls);
     RUN(test_validate_kzg_g1__succeeds_round_trip);
     RUN(test_validate_kzg_g1__succeeds_correct_point);
     RUN(test_validate_kzg_g1__fails_not_in_g1);
@@ -2304,6 +3876,7 @@ int main(void) {
     RUN(test_bit_reversal_permutation__n_is_one);
     RUN(test_compute_powers__succeeds_expected_powers);
     RUN(test_g1_lincomb__verify_consistent);
+    RUN(test_g1_lincomb_affine__verify_consistent);
     RUN(test_evaluate_polynomial_in_evaluation_form__constant_polynomial);
     RUN(test_evaluate_polynomial_in_evaluation_form__constant_polynomial_in_range);
     RUN(test_evaluate_polynomial_in_evaluation_form__random_polynomial);
@@ -2329,6 +3902,14 @@ int main(void) {
     RUN(test_verify_kzg_proof_batch__fails_proof_not_in_g1);
     RUN(test_verify_kzg_proof_batch__fails_commitment_not_in_g1);
     RUN(test_verify_kzg_proof_batch__fails_invalid_blob);
+    RUN(test_verify_kzg_proof_batch__succeeds_unrelated_openings);
+    RUN(test_verify_kzg_proof_batch__fails_with_incorrect_value);
+    RUN(test_verify_kzg_proof_batch__fails_z_not_field_element);
+    RUN(test_kzg_point_eval_accumulator__succeeds_round_trip);
+    RUN(test_kzg_point_eval_accumulator__fails_with_incorrect_value);
+    RUN(test_kzg_point_eval_accumulator__fails_z_not_field_element);
+    RUN(test_verify_blob_kzg_proof_batch_locate__succeeds_round_trip);
+    RUN(test_verify_blob_kzg_proof_batch_locate__finds_incorrect_proofs);
     RUN(test_expand_root_of_unity__global_matches_expected);
     RUN(test_expand_root_of_unity__succeeds_with_root);
     RUN(test_expand_root_of_unity__fails_not_root_of_unity);
@@ -2340,11 +3921,35 @@ int main(void) {
     RUN(test_deduplicate_commitments__all_duplicates);
     RUN(test_deduplicate_commitments__no_commitments);
     RUN(test_deduplicate_commitments__one_commitment);
+    RUN(test_deduplicate_commitments__many_duplicates);
+    RUN(test_compute_cells_and_kzg_proofs_batch__matches_single_calls);
     RUN(test_recover_cells_and_kzg_proofs__succeeds_random_blob);
     RUN(test_shift_factors__succeeds);
+    RUN(test_shift_cell_poly__matches_shift_poly);
+    RUN(test_commit_to_cell_poly__matches_lincomb);
     RUN(test_compute_vanishing_polynomial_from_roots);
     RUN(test_vanishing_polynomial_for_missing_cells);
     RUN(test_verify_cell_kzg_proof_batch__succeeds_random_blob);
+    RUN(test_verify_cell_kzg_proof_batch_locate__finds_incorrect_proofs);
+    RUN(test_verify_data_column_kzg_proofs__succeeds_random_blobs);
+    RUN(test_verify_data_column_kzg_proofs__challenge_matches_batch);
+    RUN(test_verify_data_column_kzg_proofs__fails_with_incorrect_proof);
+    RUN(test_verify_data_column_kzg_proofs__fails_column_index_out_of_range);
+    RUN(test_verify_blob_cell_kzg_proofs__succeeds_random_blob);
+    RUN(test_verify_blob_cell_kzg_proofs__fails_with_incorrect_data);
+    RUN(test_verify_blob_cell_kzg_proofs__fails_blob_and_cells);
+    RUN(test_verify_cell_kzg_proof_single__succeeds_with_and_without_lines);
+    RUN(test_verify_cell_kzg_proof_single__fails_with_incorrect_inputs);
+    RUN(test_cell_verify_accumulator__succeeds_and_is_reusable);
+    RUN(test_cell_verify_accumulator__fails_with_incorrect_proof);
+    RUN(test_cell_verify_accumulator__bad_input_leaves_state_unchanged);
+    RUN(test_unified_verify_accumulator__succeeds_and_is_reusable);
+    RUN(test_unified_verify_accumulator__fails_with_incorrect_proof);
+    RUN(test_kzg_handle_from_bytes__validates_point);
+    RUN(test_verify_blob_kzg_proof_batch_with_handles__matches_bytes);
+    RUN(test_verify_cell_kzg_proof_batch_with_handles__matches_bytes);
+    RUN(test_verify_cache__insert_and_evict);
+    RUN(test_verify_cache__skips_verified_proofs);
 
     /*
      * These functions are only executed if we're profiling. To me, it makes sense to put these in
@@ -2361,6 +3966,8 @@ int main(void) {
     profile_compute_cells_and_kzg_proofs();
     profile_recover_cells_and_kzg_proofs();
     profile_verify_cell_kzg_proof_batch();
+    profile_verify_blob_cell_kzg_proofs();
+    profile_deduplicate_commitments();
 #endif
     teardown();
 
@@ -220,6 +220,107 @@ static void test_verify_cell_kzg_proof_succeeds_random_blob(void) {
     assert(strcmp(verify_result, "true") == 0);
 }
 
+static void test_bin_variants_match_core_functions(void) {
+    printf("Running test: binary variants match the core functions\n");
+
+    C_KZG_RET ret;
+    const uint32_t num_blobs = 5;
+    const size_t num_cells = num_blobs * CELLS_PER_EXT_BLOB;
+    Blob *blobs = malloc(num_blobs * sizeof(Blob));
+    KZGCommitment *commitments = malloc(num_blobs * sizeof(KZGCommitment));
+    KZGProof *blob_proofs = malloc(num_blobs * sizeof(KZGProof));
+    Cell *cells = malloc(num_cells * sizeof(Cell));
+    KZGProof *proofs = malloc(num_cells * sizeof(KZGProof));
+    Cell *expected_cells = malloc(CELLS_PER_EXT_BLOB * sizeof(Cell));
+    KZGProof *expected_proofs = malloc(CELLS_PER_EXT_BLOB * sizeof(KZGProof));
+    Bytes48 *cell_commitments = malloc(num_cells * sizeof(Bytes48));
+    uint64_t *cell_indices = malloc(num_cells * sizeof(uint64_t));
+    assert(blobs && commitments && blob_proofs && cells && proofs && expected_cells);
+    assert(expected_proofs && cell_commitments && cell_indices);
+
+    for (size_t i = 0; i < num_blobs; i++) {
+        get_rand_blob(&blobs[i]);
+    }
+
+    /* Batched commitments match the one-by-one results */
+    ret = blob_to_kzg_commitments_bin_wasm(commitments, blobs, num_blobs);
+    assert(ret == C_KZG_OK);
+    for (size_t i = 0; i < num_blobs; i++) {
+        KZGCommitment expected;
+        ret = blob_to_kzg_commitment(&expected, &blobs[i], get_settings_wasm());
+        assert(ret == C_KZG_OK);
+        assert(memcmp(&commitments[i], &expected, sizeof(KZGCommitment)) == 0);
+
+        KZGCommitment single;
+        ret = blob_to_kzg_commitment_bin_wasm(&single, &blobs[i]);
+        assert(ret == C_KZG_OK);
+        assert(memcmp(&single, &expected, sizeof(KZGCommitment)) == 0);
+
+        ret = compute_blob_kzg_proof_bin_wasm(&blob_proofs[i], &blobs[i], &commitments[i]);
+        assert(ret == C_KZG_OK);
+    }
+
+    bool ok = false;
+    ret = verify_blob_kzg_proof_batch_bin_wasm(&ok, blobs, commitments, blob_proofs, num_blobs);
+    assert(ret == C_KZG_OK);
+    assert(ok);
+    ret = verify_blob_kzg_proof_bin_wasm(&ok, &blobs[0], &commitments[0], &blob_proofs[1]);
+    assert(ret == C_KZG_OK);
+    assert(!ok);
+
+    /* Batched cells and proofs match the one-by-one results */
+    ret = compute_cells_and_kzg_proofs_batch_bin_wasm(cells, proofs, blobs, num_blobs);
+    assert(ret == C_KZG_OK);
+    for (size_t i = 0; i < num_blobs; i++) {
+        ret = compute_cells_and_kzg_proofs(expected_cells, expected_proofs, &blobs[i], get_settings_wasm());
+        assert(ret == C_KZG_OK);
+        assert(memcmp(&cells[i * CELLS_PER_EXT_BLOB], expected_cells, CELLS_PER_EXT_BLOB * sizeof(Cell)) == 0);
+        assert(memcmp(&proofs[i * CELLS_PER_EXT_BLOB], expected_proofs, CELLS_PER_EXT_BLOB * sizeof(KZGProof)) == 0);
+    }
+
+    /* The hex variant encodes the same bytes */
+    char* proofs_and_cells_hex = compute_cells_and_kzg_proofs_wasm(&blobs[0]);
+    char* hex = malloc(2 * BYTES_PER_CELL + 1);
+    for (size_t i = 0; i < CELLS_PER_EXT_BLOB; i++) {
+        for (size_t j = 0; j < BYTES_PER_CELL; j++) {
+            sprintf(hex + 2 * j, "%02X", cells[i].bytes[j]);
+        }
+        size_t offset = 2 * (CELLS_PER_EXT_BLOB * sizeof(KZGProof) + i * BYTES_PER_CELL);
+        assert(strncmp(proofs_and_cells_hex + offset, hex, 2 * BYTES_PER_CELL) == 0);
+    }
+    free(hex);
+    free(proofs_and_cells_hex);
+
+    /* Every cell of every blob verifies in one batch, which is split across threads */
+    for (size_t i = 0; i < num_cells; i++) {
+        memcpy(&cell_commitments[i], &commitments[i / CELLS_PER_EXT_BLOB], sizeof(Bytes48));
+        cell_indices[i] = i % CELLS_PER_EXT_BLOB;
+    }
+    ret = verify_cell_kzg_proof_batch_bin_wasm(
+        &ok, cell_commitments, cell_indices, cells, proofs, (uint32_t)num_cells);
+    assert(ret == C_KZG_OK);
+    assert(ok);
+
+    /* A bad cell in the last range fails the whole batch */
+    cell_indices[num_cells - 1] = 0;
+    ret = verify_cell_kzg_proof_batch_bin_wasm(
+        &ok, cell_commitments, cell_indices, cells, proofs, (uint32_t)num_cells);
+    assert(ret == C_KZG_OK);
+    assert(!ok);
+
+    free(blobs);
+    free(commitments);
+    free(blob_proofs);
+    free(cells);
+    free(proofs);
+    free(expected_cells);
+    free(expected_proofs);
+    free(cell_commitments);
+    free(cell_indices);
+
+    printf("✓ Test passed: binary variants match the core functions\n\n");
+}
+
 int main(void) {
     printf("=== C-KZG-4844 WASM Test Suite ===\n\n");
 
@@ -247,6 +348,7 @@ int main(void) {
     test_recover_cells_and_kzg_proofs__succeeds_random_blob();
     test_verify_cell_kzg_proof_batch__succeeds_random_blob();
     test_verify_cell_kzg_proof_succeeds_random_blob();
+    test_bin_variants_match_core_functions();
 
     // Clean up
     free_trusted_setup_wasm();
@@ -0,0 +1,200 @@
+// Checks that the WASM builds produce the same results as the native library.
+//
+// Run from src/ with `make wasm-node-test`, after building the node.js binding
+// (`make build` in bindings/node.js).
+
+import assert from "node:assert/strict";
+import { randomBytes } from "node:crypto";
+import { readFileSync } from "node:fs";
+import { createRequire } from "node:module";
+
+const require = createRequire(import.meta.url);
+const native = require("../../bindings/node.js/lib/kzg.js");
+
+const TRUSTED_SETUP = "trusted_setup.txt";
+const BYTES_PER_BLOB = 131072;
+const BYTES_PER_CELL = 2048;
+const BYTES_PER_COMMITMENT = 48;
+const BYTES_PER_PROOF = 48;
+const CELLS_PER_EXT_BLOB = 128;
+const C_KZG_OK = 0;
+const NUM_BLOBS = 6;
+
+// A blob of random field elements, each with a zero top byte so it is canonical.
+function randomBlob() {
+  const blob = randomBytes(BYTES_PER_BLOB);
+  for (let i = 0; i < BYTES_PER_BLOB; i += 32) blob[i] = 0;
+  return blob;
+}
+
+function chunks(bytes, size) {
+  const out = [];
+  for (let i = 0; i < bytes.length; i += size) out.push(bytes.subarray(i, i + size));
+  return out;
+}
+
+class Wasm {
+  constructor(module) {
+    this.m = module;
+  }
+
+  static async load(path) {
+    const { default: factory } = await import(path);
+    const wasm = new Wasm(await factory());
+    wasm.loadTrustedSetup();
+    return wasm;
+  }
+
+  alloc(size) {
+    return this.m._malloc(size || 1);
+  }
+
+  copyIn(bytes) {
+    const ptr = this.alloc(bytes.length);
+    this.m.HEAPU8.set(bytes, ptr);
+    return ptr;
+  }
+
+  copyOut(ptr, size) {
+    return Buffer.from(this.m.HEAPU8.slice(ptr, ptr + size));
+  }
+
+  copyInIndices(indices) {
+    const ptr = this.alloc(indices.length * 8);
+    const view = new DataView(this.m.HEAPU8.buffer, ptr, indices.length * 8);
+    indices.forEach((index, i) => view.setBigUint64(i * 8, BigInt(index), true));
+    return ptr;
+  }
+
+  // Run fn with the given inputs copied in, and free everything afterwards.
+  call(inputs, outputSizes, fn) {
+    const inPtrs = inputs.map((input) => this.copyIn(input));
+    const outPtrs = outputSizes.map((size) => this.alloc(size));
+    try {
+      const ret = fn(...outPtrs, ...inPtrs);
+      assert.equal(ret, C_KZG_OK);
+      return outPtrs.map((ptr, i) => this.copyOut(ptr, outputSizes[i]));
+    } finally {
+      [...inPtrs, ...outPtrs].forEach((ptr) => this.m._free(ptr));
+    }
+  }
+
+  loadTrustedSetup() {
+    const lines = readFileSync(TRUSTED_SETUP, "utf8").trim().split("\n");
+    const numG1 = Number(lines[0]);
+    const numG2 = Number(lines[1]);
+    const hex = (from, count) => Buffer.from(lines.slice(from, from + count).join(""), "hex");
+    const g1Lagrange = hex(2, numG1);
+    const g2Monomial = hex(2 + numG1, numG2);
+    const g1Monomial = hex(2 + numG1 + numG2, numG1);
+
+    const ptrs = [g1Monomial, g1Lagrange, g2Monomial].map((bytes) => this.copyIn(bytes));
+    const ret = this.m._load_trusted_setup_wasm(...ptrs, 0n);
+    ptrs.forEach((ptr) => this.m._free(ptr));
+    assert.equal(ret, C_KZG_OK);
+  }
+
+  blobToKzgCommitments(blobs) {
+    const [out] = this.call([Buffer.concat(blobs)], [blobs.length * BYTES_PER_COMMITMENT], (o, b) =>
+      this.m._blob_to_kzg_commitments_bin_wasm(o, b, blobs.length)
+    );
+    return chunks(out, BYTES_PER_COMMITMENT);
+  }
+
+  computeBlobKzgProof(blob, commitment) {
+    const [out] = this.call([blob, commitment], [BYTES_PER_PROOF], (o, b, c) =>
+      this.m._compute_blob_kzg_proof_bin_wasm(o, b, c)
+    );
+    return out;
+  }
+
+  computeCellsAndKzgProofsBatch(blobs) {
+    const numCells = blobs.length * CELLS_PER_EXT_BLOB;
+    const [cells, proofs] = this.call(
+      [Buffer.concat(blobs)],
+      [numCells * BYTES_PER_CELL, numCells * BYTES_PER_PROOF],
+      (c, p, b) => this.m._compute_cells_and_kzg_proofs_batch_bin_wasm(c, p, b, blobs.length)
+    );
+    return [chunks(cells, BYTES_PER_CELL), chunks(proofs, BYTES_PER_PROOF)];
+  }
+
+  recoverCellsAndKzgProofs(cellIndices, cells) {
+    const indicesPtr = this.copyInIndices(cellIndices);
+    try {
+      const [recoveredCells, recoveredProofs] = this.call(
+        [Buffer.concat(cells)],
+        [CELLS_PER_EXT_BLOB * BYTES_PER_CELL, CELLS_PER_EXT_BLOB * BYTES_PER_PROOF],
+        (c, p, i) => this.m._recover_cells_and_kzg_proofs_bin_wasm(c, p, indicesPtr, i, cells.length)
+      );
+      return [chunks(recoveredCells, BYTES_PER_CELL), chunks(recoveredProofs, BYTES_PER_PROOF)];
+    } finally {
+      this.m._free(indicesPtr);
+    }
+  }
+
+  verifyBlobKzgProofBatch(blobs, commitments, proofs) {
+    const inputs = [blobs, commitments, proofs].map((items) => Buffer.concat(items));
+    const [ok] = this.call(inputs, [1], (o, b, c, p) =>
+      this.m._verify_blob_kzg_proof_batch_bin_wasm(o, b, c, p, blobs.length)
+    );
+    return ok[0] === 1;
+  }
+
+  verifyCellKzgProofBatch(commitments, cellIndices, cells, proofs) {
+    const indicesPtr = this.copyInIndices(cellIndices);
+    try {
+      const inputs = [commitments, cells, proofs].map((items) => Buffer.concat(items));
+      const [ok] = this.call(inputs, [1], (o, c, cs, p) =>
+        this.m._verify_cell_kzg_proof_batch_bin_wasm(o, c, indicesPtr, cs, p, cells.length)
+      );
+      return ok[0] === 1;
+    } finally {
+      this.m._free(indicesPtr);
+    }
+  }
+}
+
+function check(name, wasm) {
+  const blobs = Array.from({ length: NUM_BLOBS }, randomBlob);
+
+  const commitments = wasm.blobToKzgCommitments(blobs);
+  blobs.forEach((blob, i) => assert.deepEqual(commitments[i], Buffer.from(native.blobToKzgCommitment(blob))));
+
+  const blobProofs = blobs.map((blob, i) => wasm.computeBlobKzgProof(blob, commitments[i]));
+  blobs.forEach((blob, i) =>
+    assert.deepEqual(blobProofs[i], Buffer.from(native.computeBlobKzgProof(blob, commitments[i])))
+  );
+
+  assert.equal(wasm.verifyBlobKzgProofBatch(blobs, commitments, blobProofs), true);
+  const swapped = [blobProofs[1], blobProofs[0], ...blobProofs.slice(2)];
+  assert.equal(wasm.verifyBlobKzgProofBatch(blobs, commitments, swapped), false);
+  assert.equal(native.verifyBlobKzgProofBatch(blobs, commitments, swapped), false);
+
+  const [cells, proofs] = wasm.computeCellsAndKzgProofsBatch(blobs);
+  blobs.forEach((blob, i) => {
+    const [nativeCells, nativeProofs] = native.computeCellsAndKzgProofs(blob);
+    const range = [i * CELLS_PER_EXT_BLOB, (i + 1) * CELLS_PER_EXT_BLOB];
+    assert.deepEqual(cells.slice(...range), nativeCells.map((cell) => Buffer.from(cell)));
+    assert.deepEqual(proofs.slice(...range), nativeProofs.map((proof) => Buffer.from(proof)));
+  });
+
+  const cellCommitments = cells.map((_, i) => commitments[Math.floor(i / CELLS_PER_EXT_BLOB)]);
+  const cellIndices = cells.map((_, i) => i % CELLS_PER_EXT_BLOB);
+  assert.equal(wasm.verifyCellKzgProofBatch(cellCommitments, cellIndices, cells, proofs), true);
+  const wrongIndices = [...cellIndices.slice(0, -1), 0];
+  assert.equal(wasm.verifyCellKzgProofBatch(cellCommitments, wrongIndices, cells, proofs), false);
+  assert.equal(native.verifyCellKzgProofBatch(cellCommitments, wrongIndices, cells, proofs), false);
+
+  const halfIndices = Array.from({ length: CELLS_PER_EXT_BLOB / 2 }, (_, i) => i * 2);
+  const halfCells = halfIndices.map((i) => cells[i]);
+  const [recoveredCells, recoveredProofs] = wasm.recoverCellsAndKzgProofs(halfIndices, halfCells);
+  assert.deepEqual(recoveredCells, cells.slice(0, CELLS_PER_EXT_BLOB));
+  assert.deepEqual(recoveredProofs, proofs.slice(0, CELLS_PER_EXT_BLOB));
+
+  console.log(`✓ ${name} matches the native library`);
+}
+
+native.loadTrustedSetup(0, TRUSTED_SETUP);
+check("kzg-node.js", await Wasm.load("../kzg-node.js"));
+check("kzg-mt.js", await Wasm.load("../kzg-mt.js"));
+process.exit(0);